@@ -10,17 +10,89 @@
 
 
 
+namespace
+{
+
+void checkIsVic2Save(const std::string& saveFileName)
+{
+	const auto length = saveFileName.find_last_of('.');
+	if ((length == std::string::npos) || (".v2" != saveFileName.substr(length, saveFileName.length())))
+	{
+		throw std::invalid_argument("The save was not a Vic2 save. Choose a save ending in '.v2' and convert again.");
+	}
+}
+
+
+std::string determineOutputName(const std::string& V2SaveFileName, const std::string& customOutputName)
+{
+	std::string outputName;
+	if (customOutputName.empty())
+	{
+		outputName = trimPath(V2SaveFileName);
+		if (getExtension(outputName) != "v2")
+		{
+			throw std::invalid_argument("The save was not a Vic2 save. Choose a save ending in '.v2' and convert again.");
+		}
+		outputName = trimExtension(outputName);
+	}
+	else
+	{
+		outputName = customOutputName;
+	}
+	if (outputName.empty())
+	{
+		return outputName;
+	}
+
+	return normalizeStringPath(outputName);
+}
+
+
+class BatchSaveParser: commonItems::parser
+{
+  public:
+	BatchSaveParser()
+	{
+		registerKeyword("SaveGame", [this](std::istream& theStream) {
+			batchSave.inputFile = commonItems::singleString{theStream}.getString();
+			checkIsVic2Save(batchSave.inputFile);
+		});
+		registerKeyword("output_name", [this](std::istream& theStream) {
+			batchSave.outputName = commonItems::singleString{theStream}.getString();
+		});
+		registerRegex(commonItems::catchallRegex, commonItems::ignoreItem);
+	}
+
+	BatchSave importBatchSave(std::istream& theStream)
+	{
+		batchSave = BatchSave{};
+		parseStream(theStream);
+		if (batchSave.inputFile.empty())
+		{
+			throw std::invalid_argument("A save in the batch had no SaveGame.");
+		}
+		batchSave.outputName = determineOutputName(batchSave.inputFile, batchSave.outputName);
+		if (batchSave.outputName.empty())
+		{
+			throw std::invalid_argument("Could not determine an output name for " + batchSave.inputFile);
+		}
+		return batchSave;
+	}
+
+  private:
+	BatchSave batchSave;
+};
+
+} // namespace
+
+
+
 Configuration::Factory::Factory()
 {
 	registerKeyword("SaveGame", [this](std::istream& theStream) {
 		const commonItems::singleString filenameString(theStream);
 		configuration->inputFile = filenameString.getString();
-		const auto length = configuration->inputFile.find_last_of('.');
-		if ((length == std::string::npos) ||
-			 (".v2" != configuration->inputFile.substr(length, configuration->inputFile.length())))
-		{
-			throw std::invalid_argument("The save was not a Vic2 save. Choose a save ending in '.v2' and convert again.");
-		}
+		checkIsVic2Save(configuration->inputFile);
 		Log(LogLevel::Info) << "\tVic2 save is " << configuration->inputFile;
 	});
 	registerKeyword("HoI4directory", [this](std::istream& theStream) {
@@ -165,6 +237,17 @@ Configuration::Factory::Factory()
 	registerKeyword("output_name", [this](const std::string& unused, std::istream& theStream) {
 		configuration->customOutputName = commonItems::singleString(theStream).getString();
 	});
+	registerKeyword("batch", [this](std::istream& theStream) {
+		commonItems::parser batchParser;
+		BatchSaveParser batchSaveParser;
+		batchParser.registerKeyword("save", [this, &batchSaveParser](std::istream& saveStream) {
+			configuration->batchSaves.push_back(batchSaveParser.importBatchSave(saveStream));
+			Log(LogLevel::Info) << "\tBatch save " << configuration->batchSaves.back().inputFile << " to "
+									  << configuration->batchSaves.back().outputName;
+		});
+		batchParser.registerRegex(commonItems::catchallRegex, commonItems::ignoreItem);
+		batchParser.parseStream(theStream);
+	});
 	registerRegex(commonItems::catchallRegex, commonItems::ignoreItem);
 }
 
@@ -195,27 +278,12 @@ std::unique_ptr<Configuration> Configuration::Factory::importConfiguration(std::
 
 void Configuration::Factory::setOutputName(const std::string& V2SaveFileName, const std::string& customOutputName)
 {
-	std::string outputName;
-	if (customOutputName.empty())
-	{
-		outputName = trimPath(V2SaveFileName);
-		if (getExtension(outputName) != "v2")
-		{
-			throw std::invalid_argument("The save was not a Vic2 save. Choose a save ending in '.v2' and convert again.");
-		}
-		outputName = trimExtension(outputName);
-	}
-	else
-	{
-		outputName = customOutputName;
-	}
+	const auto outputName = determineOutputName(V2SaveFileName, customOutputName);
 	if (outputName.empty())
 	{
 		return;
 	}
 
-	outputName = normalizeStringPath(outputName);
-
 	Log(LogLevel::Info) << "Using output name " << outputName;
 	configuration->outputName = outputName;
 }
@@ -21,6 +21,15 @@ enum class ideologyOptions
 
 
 
+// a save converted in batch mode, with the name of the mod it is converted to
+typedef struct BatchSave
+{
+	std::string inputFile;
+	std::string outputName;
+} BatchSave;
+
+
+
 class Configuration
 {
   public:
@@ -44,10 +53,12 @@ class Configuration
 	[[nodiscard]] const auto& getRemoveCores() const { return removeCores; }
 	[[nodiscard]] const auto& getCreateFactions() const { return createFactions; }
 	[[nodiscard]] const auto& getPercentOfCommanders() const { return percentOfCommanders; }
+	[[nodiscard]] const auto& getBatchSaves() const { return batchSaves; }
 
 	[[nodiscard]] auto getNextLeaderID() { return leaderID++; }
 
 	void setForceMultiplier(const float multiplier) { forceMultiplier = multiplier; }
+	void setInputFile(const std::string& file) { inputFile = file; }
 	void setOutputName(const std::string& name) { outputName = name; }
 
   private:
@@ -70,6 +81,7 @@ class Configuration
 	bool removeCores = true;
 	bool createFactions = true;
 	float percentOfCommanders = 0.05F;
+	std::vector<BatchSave> batchSaves;
 
 	// set later
 	unsigned int leaderID = 1000;
@@ -0,0 +1,50 @@
+#ifndef FOLDER_IMPORT_H
+#define FOLDER_IMPORT_H
+
+
+
+#include "OSCompatibilityLayer.h"
+#include "ParallelMap.h"
+#include <optional>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+
+// Parses every file in folder on a pool of worker threads. parseFile is called with the path to a file and the file's
+// name, and returns what it read from that file without touching shared state. The results come back paired with
+// their file names and sorted by file name, so merging them front to back gives the same outcome as importing the
+// files one after the other.
+template <typename Function>
+auto importFolder(const std::string& folder,
+	 Function&& parseFile,
+	 unsigned int numThreads = std::thread::hardware_concurrency())
+{
+	using Result = std::decay_t<std::invoke_result_t<Function&, const std::string&, const std::string&>>;
+
+	const auto files = commonItems::GetAllFilesInFolder(folder);
+	const std::vector<std::string> fileNames(files.begin(), files.end());
+
+	// wrapped in optional so that results need not be default constructible
+	auto results = parallelMap(
+		 fileNames,
+		 [&folder, &parseFile](const std::string& fileName) {
+			 return std::optional<Result>(parseFile(folder + "/" + fileName, fileName));
+		 },
+		 numThreads);
+
+	std::vector<std::pair<std::string, Result>> imported;
+	imported.reserve(fileNames.size());
+	for (size_t i = 0; i < fileNames.size(); ++i)
+	{
+		imported.emplace_back(fileNames[i], std::move(*results[i]));
+	}
+	return imported;
+}
+
+
+
+#endif // FOLDER_IMPORT_H
@@ -25,14 +25,14 @@ HoI4::decisions::decisions(const Configuration& theConfiguration)
 
 
 void HoI4::decisions::updateDecisions(const std::set<std::string>& majorIdeologies,
-	 const std::map<int, int>& provinceToStateIdMap,
+	 const Geography& geography,
 	 const std::map<int, DefaultState>& defaultStates,
 	 const Events& theEvents,
 	 const std::set<std::string>& southAsianCountries)
 {
 	Log(LogLevel::Info) << "\tUpdating decisions";
 
-	generateIdeologicalCategories(majorIdeologies, provinceToStateIdMap);
+	generateIdeologicalCategories(majorIdeologies, geography);
 
 	agentRecruitmentDecisions.updateDecisions(southAsianCountries);
 	stabilityDecisions.updateDecisions(majorIdeologies);
@@ -40,14 +40,14 @@ void HoI4::decisions::updateDecisions(const std::set<std::string>& majorIdeologi
 	exiledGovernmentsDecisions.updateDecisions(majorIdeologies);
 	foreignInfluenceDecisions.updateDecisions(majorIdeologies);
 	navalTreatyDecisions.updateDecisions(majorIdeologies);
-	resourceProspectingDecisions.updateDecisions(provinceToStateIdMap, defaultStates);
-	genericDecisions.updateDecisions(provinceToStateIdMap, majorIdeologies);
+	resourceProspectingDecisions.updateDecisions(geography, defaultStates);
+	genericDecisions.updateDecisions(geography, majorIdeologies);
 }
 
 
 
 void HoI4::decisions::generateIdeologicalCategories(const std::set<std::string>& majorIdeologies,
-	 const std::map<int, int>& provinceToStateIdMap) const
+	 const Geography& geography) const
 {
 	DecisionsCategory::Factory decisionsCategoryFactory;
 
@@ -77,7 +77,7 @@ void HoI4::decisions::generateIdeologicalCategories(const std::set<std::string>&
 			 decisionsCategoryFactory.getDecisionsCategory(majorIdeology + "_on_the_rise", input));
 	}
 
-	ideologicalCategories->replaceCategory(createLocalRecruitmentCategory(provinceToStateIdMap));
+	ideologicalCategories->replaceCategory(createLocalRecruitmentCategory(geography));
 }
 
 
@@ -96,7 +96,7 @@ std::string HoI4::decisions::getIdeologicalIcon(const std::string& ideology)
 }
 
 
-HoI4::DecisionsCategory HoI4::decisions::createLocalRecruitmentCategory(const std::map<int, int>& provinceToStateIdMap)
+HoI4::DecisionsCategory HoI4::decisions::createLocalRecruitmentCategory(const Geography& geography)
 {
 	std::stringstream input;
 	input << "= {\n";
@@ -104,7 +104,7 @@ HoI4::DecisionsCategory HoI4::decisions::createLocalRecruitmentCategory(const st
 	input << "\tvisible = { has_done_agency_upgrade = upgrade_training_centers }\n";
 	input << "\tvisibility_type = map_and_decisions_view\n";
 
-	auto europeanState = getRelevantStateFromProvince(6583, provinceToStateIdMap);
+	auto europeanState = geography.getStateOfProvince(6583);
 	if (europeanState)
 	{
 		input << "\ton_map_area = {\n";
@@ -121,7 +121,7 @@ HoI4::DecisionsCategory HoI4::decisions::createLocalRecruitmentCategory(const st
 		input << "\t}\n";
 	}
 
-	auto northAmericanState = getRelevantStateFromProvince(10717, provinceToStateIdMap);
+	auto northAmericanState = geography.getStateOfProvince(10717);
 	if (northAmericanState)
 	{
 		input << "\ton_map_area = {\n";
@@ -138,7 +138,7 @@ HoI4::DecisionsCategory HoI4::decisions::createLocalRecruitmentCategory(const st
 		input << "\t}\n";
 	}
 
-	auto southAmericanState = getRelevantStateFromProvince(10924, provinceToStateIdMap);
+	auto southAmericanState = geography.getStateOfProvince(10924);
 	if (southAmericanState)
 	{
 		input << "\ton_map_area = {\n";
@@ -155,7 +155,7 @@ HoI4::DecisionsCategory HoI4::decisions::createLocalRecruitmentCategory(const st
 		input << "\t}\n";
 	}
 
-	auto africanState = getRelevantStateFromProvince(5117, provinceToStateIdMap);
+	auto africanState = geography.getStateOfProvince(5117);
 	if (africanState)
 	{
 		input << "\ton_map_area = {\n";
@@ -172,7 +172,7 @@ HoI4::DecisionsCategory HoI4::decisions::createLocalRecruitmentCategory(const st
 		input << "\t}\n";
 	}
 
-	auto asianState = getRelevantStateFromProvince(9843, provinceToStateIdMap);
+	auto asianState = geography.getStateOfProvince(9843);
 	if (asianState)
 	{
 		input << "\ton_map_area = {\n";
@@ -192,7 +192,7 @@ HoI4::DecisionsCategory HoI4::decisions::createLocalRecruitmentCategory(const st
 		input << "\t}\n";
 	}
 
-	auto australianState = getRelevantStateFromProvince(4864, provinceToStateIdMap);
+	auto australianState = geography.getStateOfProvince(4864);
 	if (australianState)
 	{
 		input << "\ton_map_area = {\n";
@@ -209,7 +209,7 @@ HoI4::DecisionsCategory HoI4::decisions::createLocalRecruitmentCategory(const st
 		input << "\t}\n";
 	}
 
-	auto southAsianState = getRelevantStateFromProvince(2086, provinceToStateIdMap);
+	auto southAsianState = geography.getStateOfProvince(2086);
 	if (southAsianState)
 	{
 		input << "\ton_map_area = {\n";
@@ -227,7 +227,7 @@ HoI4::DecisionsCategory HoI4::decisions::createLocalRecruitmentCategory(const st
 		input << "\t}\n";
 	}
 
-	auto middleEasternState = getRelevantStateFromProvince(8085, provinceToStateIdMap);
+	auto middleEasternState = geography.getStateOfProvince(8085);
 	if (middleEasternState)
 	{
 		input << "\ton_map_area = {\n";
@@ -246,15 +246,3 @@ HoI4::DecisionsCategory HoI4::decisions::createLocalRecruitmentCategory(const st
 
 	return DecisionsCategory::Factory{}.getDecisionsCategory("lar_local_recruitment", input);
 }
-
-
-std::optional<int> HoI4::decisions::getRelevantStateFromProvince(int province,
-	 const std::map<int, int>& provinceToStateIdMap)
-{
-	if (const auto& mapping = provinceToStateIdMap.find(province); mapping != provinceToStateIdMap.end())
-	{
-		return mapping->second;
-	}
-
-	return std::nullopt;
-}
\ No newline at end of file
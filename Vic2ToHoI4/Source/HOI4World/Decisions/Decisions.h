@@ -12,6 +12,7 @@
 #include "GenericDecisions.h"
 #include "HOI4World/Events/Events.h"
 #include "HOI4World/States/DefaultState.h"
+#include "HOI4World/States/Geography.h"
 #include "NavalTreatyDecisions.h"
 #include "Parser.h"
 #include "PoliticalDecisions.h"
@@ -33,7 +34,7 @@ class decisions: commonItems::parser
 	explicit decisions(const Configuration& theConfiguration);
 
 	void updateDecisions(const std::set<std::string>& majorIdeologies,
-		 const std::map<int, int>& provinceToStateIdMap,
+		 const Geography& geography,
 		 const std::map<int, DefaultState>& defaultStates,
 		 const Events& theEvents,
 		 const std::set<std::string>& southAsianCountries);
@@ -74,10 +75,9 @@ class decisions: commonItems::parser
 
   private:
 	void generateIdeologicalCategories(const std::set<std::string>& majorIdeologies,
-		 const std::map<int, int>& provinceToStateIdMap) const;
+		 const Geography& geography) const;
 	static std::string getIdeologicalIcon(const std::string& ideology);
-	static DecisionsCategory createLocalRecruitmentCategory(const std::map<int, int>& provinceToStateIdMap);
-	static std::optional<int> getRelevantStateFromProvince(int province, const std::map<int, int>& provinceToStateIdMap);
+	static DecisionsCategory createLocalRecruitmentCategory(const Geography& geography);
 
 	std::unique_ptr<DecisionsCategories> ideologicalCategories;
 
@@ -2,12 +2,12 @@
 
 
 
-HoI4::decision&& updateBlowSuez(HoI4::decision&& blowSuezDecision, const std::map<int, int>& provinceToStateIdMap);
-HoI4::decision&& updateBlowPanama(HoI4::decision&& blowPanamaDecision, const std::map<int, int>& provinceToStateIdMap);
+HoI4::decision&& updateBlowSuez(HoI4::decision&& blowSuezDecision, const HoI4::Geography& geography);
+HoI4::decision&& updateBlowPanama(HoI4::decision&& blowPanamaDecision, const HoI4::Geography& geography);
 HoI4::decision&& updateRebuildSuez(HoI4::decision&& rebuildSuezDecision,
-	 const std::map<int, int>& provinceToStateIdMap);
+	 const HoI4::Geography& geography);
 HoI4::decision&& updateRebuildPanama(HoI4::decision&& rebuildPanamaDecision,
-	 const std::map<int, int>& provinceToStateIdMap);
+	 const HoI4::Geography& geography);
 HoI4::decision&& updateWomenInTheWorkforce(HoI4::decision&& womenInTheWorkforceDecision,
 	 const std::set<std::string>& majorIdeologies);
 HoI4::decision&& updateWarBonds(HoI4::decision&& warBondsDecision, const std::set<std::string>& majorIdeologies);
@@ -19,7 +19,7 @@ HoI4::decision&& updateObjectToAttaches(HoI4::decision&& objectToAttachesDecisio
 
 
 
-void HoI4::GenericDecisions::updateDecisions(const std::map<int, int>& provinceToStateIdMap,
+void HoI4::GenericDecisions::updateDecisions(const Geography& geography,
 	 const std::set<std::string>& majorIdeologies)
 {
 	for (auto& category: decisions)
@@ -40,19 +40,19 @@ void HoI4::GenericDecisions::updateDecisions(const std::map<int, int>& provinceT
 		{
 			if (decision.getName() == "blow_suez_canal")
 			{
-				category.replaceDecision(updateBlowSuez(std::move(decision), provinceToStateIdMap));
+				category.replaceDecision(updateBlowSuez(std::move(decision), geography));
 			}
 			else if (decision.getName() == "blow_panama_canal")
 			{
-				category.replaceDecision(updateBlowPanama(std::move(decision), provinceToStateIdMap));
+				category.replaceDecision(updateBlowPanama(std::move(decision), geography));
 			}
 			else if (decision.getName() == "rebuild_suez_canal")
 			{
-				category.replaceDecision(updateRebuildSuez(std::move(decision), provinceToStateIdMap));
+				category.replaceDecision(updateRebuildSuez(std::move(decision), geography));
 			}
 			else if (decision.getName() == "rebuild_panama_canal")
 			{
-				category.replaceDecision(updateRebuildPanama(std::move(decision), provinceToStateIdMap));
+				category.replaceDecision(updateRebuildPanama(std::move(decision), geography));
 			}
 			else if (decision.getName() == "women_in_the_workforce")
 			{
@@ -96,10 +96,10 @@ void HoI4::GenericDecisions::updateDecisions(const std::map<int, int>& provinceT
 
 std::set<int> getRelevantStatesFromProvinces(const std::set<int>& provinces,
 	 const std::set<int>& statesToExclude,
-	 const std::map<int, int>& provinceToStateIdMap);
+	 const HoI4::Geography& geography);
 
 
-HoI4::decision&& updateBlowSuez(HoI4::decision&& blowSuezDecision, const std::map<int, int>& provinceToStateIdMap)
+HoI4::decision&& updateBlowSuez(HoI4::decision&& blowSuezDecision, const HoI4::Geography& geography)
 {
 	auto relevantCanalStates = getRelevantStatesFromProvinces(
 		 {
@@ -109,7 +109,7 @@ HoI4::decision&& updateBlowSuez(HoI4::decision&& blowSuezDecision, const std::ma
 			  9947	// south-east suez canal
 		 },
 		 {},
-		 provinceToStateIdMap);
+		 geography);
 
 	auto relevantOtherStates = getRelevantStatesFromProvinces(
 		 {
@@ -195,7 +195,7 @@ HoI4::decision&& updateBlowSuez(HoI4::decision&& blowSuezDecision, const std::ma
 			  4603 // Jordan (455)
 		 },
 		 relevantCanalStates,
-		 provinceToStateIdMap);
+		 geography);
 
 	auto relevantNileStates = getRelevantStatesFromProvinces(
 		 {
@@ -225,11 +225,11 @@ HoI4::decision&& updateBlowSuez(HoI4::decision&& blowSuezDecision, const std::ma
 			  4910, // Eastern Desert (457)
 		 },
 		 {},
-		 provinceToStateIdMap);
+		 geography);
 
 	auto relevantLandRouteStates = getRelevantStatesFromProvinces({1977, 12725, 2003}, // Khartoum
 		 {},
-		 provinceToStateIdMap);
+		 geography);
 
 	auto relevantSupplyStates = getRelevantStatesFromProvinces(
 		 {
@@ -254,13 +254,9 @@ HoI4::decision&& updateBlowSuez(HoI4::decision&& blowSuezDecision, const std::ma
 			  12941 // Somaliland
 		 },
 		 {},
-		 provinceToStateIdMap);
+		 geography);
 
-	std::optional<int> gibraltar;
-	if (auto mapping = provinceToStateIdMap.find(4135); mapping != provinceToStateIdMap.end())
-	{
-		gibraltar = mapping->second;
-	}
+	const auto gibraltar = geography.getStateOfProvince(4135);
 
 	std::string available;
 	available += "= {\n";
@@ -399,14 +395,14 @@ HoI4::decision&& updateBlowSuez(HoI4::decision&& blowSuezDecision, const std::ma
 }
 
 
-HoI4::decision&& updateBlowPanama(HoI4::decision&& blowPanamaDecision, const std::map<int, int>& provinceToStateIdMap)
+HoI4::decision&& updateBlowPanama(HoI4::decision&& blowPanamaDecision, const HoI4::Geography& geography)
 {
 	auto canalState = getRelevantStatesFromProvinces(
 		 {
 			  7617 // Panama province
 		 },
 		 {},
-		 provinceToStateIdMap);
+		 geography);
 
 	auto peninsulaState = getRelevantStatesFromProvinces(
 		 {
@@ -418,7 +414,7 @@ HoI4::decision&& updateBlowPanama(HoI4::decision&& blowPanamaDecision, const std
 			  4611 // Panama state
 		 },
 		 {},
-		 provinceToStateIdMap);
+		 geography);
 
 	std::string available;
 	available += "= {\n";
@@ -498,15 +494,14 @@ HoI4::decision&& updateBlowPanama(HoI4::decision&& blowPanamaDecision, const std
 
 std::set<int> getRelevantStatesFromProvinces(const std::set<int>& provinces,
 	 const std::set<int>& statesToExclude,
-	 const std::map<int, int>& provinceToStateIdMap)
+	 const HoI4::Geography& geography)
 {
 	std::set<int> relevantStates;
 	for (const auto& province: provinces)
 	{
-		if (auto mapping = provinceToStateIdMap.find(province);
-			 mapping != provinceToStateIdMap.end() && !statesToExclude.contains(mapping->second))
+		if (const auto state = geography.getStateOfProvince(province); state && !statesToExclude.contains(*state))
 		{
-			relevantStates.insert(mapping->second);
+			relevantStates.insert(*state);
 		}
 	}
 
@@ -514,7 +509,7 @@ std::set<int> getRelevantStatesFromProvinces(const std::set<int>& provinces,
 }
 
 
-HoI4::decision&& updateRebuildSuez(HoI4::decision&& rebuildSuezDecision, const std::map<int, int>& provinceToStateIdMap)
+HoI4::decision&& updateRebuildSuez(HoI4::decision&& rebuildSuezDecision, const HoI4::Geography& geography)
 {
 	auto relevantCanalStates = getRelevantStatesFromProvinces(
 		 {
@@ -524,7 +519,7 @@ HoI4::decision&& updateRebuildSuez(HoI4::decision&& rebuildSuezDecision, const s
 			  9947	// south-east suez canal
 		 },
 		 {},
-		 provinceToStateIdMap);
+		 geography);
 
 	std::string available;
 	available += "= {\n";
@@ -571,14 +566,14 @@ HoI4::decision&& updateRebuildSuez(HoI4::decision&& rebuildSuezDecision, const s
 
 
 HoI4::decision&& updateRebuildPanama(HoI4::decision&& rebuildPanamaDecision,
-	 const std::map<int, int>& provinceToStateIdMap)
+	 const HoI4::Geography& geography)
 {
 	auto canalState = getRelevantStatesFromProvinces(
 		 {
 			  7617 // Panama province
 		 },
 		 {},
-		 provinceToStateIdMap);
+		 geography);
 
 	auto peninsulaState = getRelevantStatesFromProvinces(
 		 {
@@ -590,7 +585,7 @@ HoI4::decision&& updateRebuildPanama(HoI4::decision&& rebuildPanamaDecision,
 			  4611 // Panama state
 		 },
 		 canalState,
-		 provinceToStateIdMap);
+		 geography);
 
 	std::string available;
 	available += "= {\n";
@@ -4,7 +4,7 @@
 
 
 #include "DecisionsFile.h"
-#include <map>
+#include "HOI4World/States/Geography.h"
 #include <set>
 #include <string>
 
@@ -17,7 +17,7 @@ class GenericDecisions: public DecisionsFile
 {
 	public:
 		void updateDecisions(
-			const std::map<int, int>& provinceToStateIdMap,
+			const Geography& geography,
 			const std::set<std::string>& majorIdeologies
 		);
 };
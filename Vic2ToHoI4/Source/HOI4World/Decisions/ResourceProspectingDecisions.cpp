@@ -6,7 +6,7 @@
 
 
 std::optional<int> getRelevantStateFromOldState(const int oldStateNum,
-	 const std::map<int, int>& provinceToStateIdMap,
+	 const HoI4::Geography& geography,
 	 const std::map<int, HoI4::DefaultState>& defaultStates)
 {
 	const auto& oldState = defaultStates.find(oldStateNum);
@@ -21,13 +21,7 @@ std::optional<int> getRelevantStateFromOldState(const int oldStateNum,
 		return std::nullopt;
 	}
 
-	const auto& mapping = provinceToStateIdMap.find(*provinces.begin());
-	if (mapping == provinceToStateIdMap.end())
-	{
-		return std::nullopt;
-	}
-
-	return mapping->second;
+	return geography.getStateOfProvince(*provinces.begin());
 }
 
 
@@ -55,46 +49,56 @@ bool allowedNeedsStripping(const std::string_view decisionName)
 }
 
 
-HoI4::decision updateDecision(HoI4::decision decisionToUpdate,
-	 const std::map<int, int>& provinceToStateIdMap,
-	 const std::map<int, HoI4::DefaultState>& defaultStates)
+void HoI4::ResourceProspectingDecisions::importDecisions(const std::string& filename)
 {
-	auto highlightStates = decisionToUpdate.getHighlightStateTargets();
+	DecisionsFile::importDecisions(filename);
 
-	std::regex stateNumRegex(".+ (\\d+).*");
-	std::smatch match;
-	std::regex_search(highlightStates, match, stateNumRegex);
-	auto oldStateNum = std::stoi(match[1]);
+	const std::regex stateNumRegex(".+ (\\d+).*");
+	for (const auto& category: decisions)
+	{
+		for (const auto& theDecision: category.getDecisions())
+		{
+			const auto highlightStates = theDecision.getHighlightStateTargets();
+			std::smatch match;
+			std::regex_search(highlightStates, match, stateNumRegex);
+			const auto oldStateNum = std::stoi(match[1]);
+			const std::vector<std::string> oldState{std::to_string(oldStateNum)};
+
+			stateScripts.emplace(theDecision.getName(),
+				 StateScripts{oldStateNum,
+					  ScriptTemplate(highlightStates, oldState),
+					  ScriptTemplate(theDecision.getAvailable(), oldState),
+					  ScriptTemplate(theDecision.getVisible(), oldState),
+					  ScriptTemplate(theDecision.getRemoveEffect(), oldState)});
+		}
+	}
+}
 
-	auto possibleNewStateNum = getRelevantStateFromOldState(oldStateNum, provinceToStateIdMap, defaultStates);
+
+HoI4::decision HoI4::ResourceProspectingDecisions::updateDecision(decision decisionToUpdate,
+	 const Geography& geography,
+	 const std::map<int, DefaultState>& defaultStates) const
+{
+	const auto& scripts = stateScripts.at(decisionToUpdate.getName());
+
+	auto possibleNewStateNum = getRelevantStateFromOldState(scripts.oldStateNum, geography, defaultStates);
 	if (!possibleNewStateNum)
 	{
 		return decisionToUpdate;
 	}
-	auto newStateNum = *possibleNewStateNum;
+	const ScriptTemplate::Bindings stateBindings{
+		 {std::to_string(scripts.oldStateNum), std::to_string(*possibleNewStateNum)}};
 
-	auto newHighlightStates =
-		 std::regex_replace(highlightStates, std::regex(std::to_string(oldStateNum)), std::to_string(newStateNum));
-	decisionToUpdate.setHighlightStateTargets(newHighlightStates);
+	decisionToUpdate.setHighlightStateTargets(scripts.highlightStates.render(stateBindings));
 
 	if (allowedNeedsStripping(decisionToUpdate.getName()))
 	{
 		decisionToUpdate.setAllowed("= {\n\n\t\t}");
 	}
 
-	auto available = decisionToUpdate.getAvailable();
-	auto newAvailable =
-		 std::regex_replace(available, std::regex(std::to_string(oldStateNum)), std::to_string(newStateNum));
-	decisionToUpdate.setAvailable(newAvailable);
-
-	auto visible = decisionToUpdate.getVisible();
-	auto newVisible = std::regex_replace(visible, std::regex(std::to_string(oldStateNum)), std::to_string(newStateNum));
-	decisionToUpdate.setVisible(newVisible);
-
-	auto removeEffect = decisionToUpdate.getRemoveEffect();
-	auto newRemoveEffect =
-		 std::regex_replace(removeEffect, std::regex(std::to_string(oldStateNum)), std::to_string(newStateNum));
-	decisionToUpdate.setRemoveEffect(newRemoveEffect);
+	decisionToUpdate.setAvailable(scripts.available.render(stateBindings));
+	decisionToUpdate.setVisible(scripts.visible.render(stateBindings));
+	decisionToUpdate.setRemoveEffect(scripts.removeEffect.render(stateBindings));
 
 	if (aiWillDoNeedsStripping(decisionToUpdate.getName()))
 	{
@@ -105,14 +109,14 @@ HoI4::decision updateDecision(HoI4::decision decisionToUpdate,
 }
 
 
-void HoI4::ResourceProspectingDecisions::updateDecisions(const std::map<int, int>& _provinceToStateIdMap,
+void HoI4::ResourceProspectingDecisions::updateDecisions(const Geography& geography,
 	 const std::map<int, DefaultState>& defaultStates)
 {
 	for (auto& category: decisions)
 	{
 		for (const auto& decisionToUpdate: category.getDecisions())
 		{
-			category.replaceDecision(updateDecision(decisionToUpdate, _provinceToStateIdMap, defaultStates));
+			category.replaceDecision(updateDecision(decisionToUpdate, geography, defaultStates));
 		}
 	}
 }
\ No newline at end of file
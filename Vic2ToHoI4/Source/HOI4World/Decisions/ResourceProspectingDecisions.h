@@ -4,7 +4,11 @@
 
 
 #include "DecisionsFile.h"
+#include "HOI4World/ScriptTemplate.h"
 #include "HOI4World/States/DefaultState.h"
+#include "HOI4World/States/Geography.h"
+#include <map>
+#include <string>
 
 
 
@@ -14,8 +18,27 @@ namespace HoI4
 class ResourceProspectingDecisions: public DecisionsFile
 {
   public:
-	void updateDecisions(const std::map<int, int>& _provinceToStateIdMap,
+	void importDecisions(const std::string& filename);
+
+	void updateDecisions(const Geography& geography,
 		 const std::map<int, DefaultState>& defaultStates);
+
+  private:
+	// the scripts that name the decision's original state, compiled once with that state number as their slot
+	typedef struct StateScripts
+	{
+		int oldStateNum;
+		ScriptTemplate highlightStates;
+		ScriptTemplate available;
+		ScriptTemplate visible;
+		ScriptTemplate removeEffect;
+	} StateScripts;
+
+	[[nodiscard]] decision updateDecision(decision decisionToUpdate,
+		 const Geography& geography,
+		 const std::map<int, DefaultState>& defaultStates) const;
+
+	std::map<std::string, StateScripts> stateScripts;
 };
 
 } // namespace HoI4
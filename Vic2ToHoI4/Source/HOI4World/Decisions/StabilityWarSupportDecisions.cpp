@@ -5,13 +5,31 @@
 std::pair<std::string, std::string> determineIdeologiesForStabilityDecisions(
 	 const std::set<std::string>& majorIdeologies);
 bool stabilityDecisionToUpdate(const std::string& decisionName);
-std::string updateTimeoutEffect(std::string& originalEffect,
-	 const std::pair<std::string, std::string>& ideologiesForStabilityDecisions);
+
+
+void HoI4::StabilityWarSupportDecisions::importDecisions(const std::string& filename)
+{
+	DecisionsFile::importDecisions(filename);
+
+	for (const auto& category: decisions)
+	{
+		for (const auto& decision: category.getDecisions())
+		{
+			if (stabilityDecisionToUpdate(decision.getName()))
+			{
+				timeoutEffects.emplace(decision.getName(),
+					 ScriptTemplate(decision.getTimeoutEffect(), {"communism", "democratic"}));
+			}
+		}
+	}
+}
 
 
 void HoI4::StabilityWarSupportDecisions::updateDecisions(const std::set<std::string>& majorIdeologies)
 {
 	const auto ideologiesForStabilityDecisions = determineIdeologiesForStabilityDecisions(majorIdeologies);
+	const ScriptTemplate::Bindings ideologyBindings{{"communism", ideologiesForStabilityDecisions.first},
+		 {"democratic", ideologiesForStabilityDecisions.second}};
 
 	for (auto category: decisions)
 	{
@@ -20,9 +38,7 @@ void HoI4::StabilityWarSupportDecisions::updateDecisions(const std::set<std::str
 		{
 			if (stabilityDecisionToUpdate(decision.getName()))
 			{
-				auto timeoutEffect = decision.getTimeoutEffect();
-				timeoutEffect = updateTimeoutEffect(timeoutEffect, ideologiesForStabilityDecisions);
-				decision.setTimeoutEffect(timeoutEffect);
+				decision.setTimeoutEffect(timeoutEffects.at(decision.getName()).render(ideologyBindings));
 				category.replaceDecision(decision);
 				updated = true;
 			}
@@ -75,25 +91,4 @@ bool stabilityDecisionToUpdate(const std::string& decisionName)
 	return decisionName == "draft_dodging_mission" || decisionName == "strikes_mission" ||
 			 decisionName == "mutiny_mission" || decisionName == "demob_economic_mission" ||
 			 decisionName == "demob_manpower_mission";
-}
-
-
-std::string updateTimeoutEffect(std::string& originalEffect,
-	 const std::pair<std::string, std::string>& ideologiesForStabilityDecisions)
-{
-	auto index = originalEffect.find("communism");
-	while (index != std::string::npos)
-	{
-		originalEffect.replace(index, 9, ideologiesForStabilityDecisions.first);
-		index = originalEffect.find("communism", index + ideologiesForStabilityDecisions.first.length());
-	}
-
-	index = originalEffect.find("democratic");
-	while (index != std::string::npos)
-	{
-		originalEffect.replace(index, 10, ideologiesForStabilityDecisions.second);
-		index = originalEffect.find("democratic", index + ideologiesForStabilityDecisions.second.length());
-	}
-
-	return originalEffect;
 }
\ No newline at end of file
@@ -4,6 +4,8 @@
 
 
 #include "DecisionsFile.h"
+#include "HOI4World/ScriptTemplate.h"
+#include <map>
 #include <set>
 #include <string>
 
@@ -15,7 +17,13 @@ namespace HoI4
 class StabilityWarSupportDecisions: public DecisionsFile
 {
 	public:
+		void importDecisions(const std::string& filename);
+
 		void updateDecisions(const std::set<std::string>& majorIdeologies);
+
+	private:
+		// timeout effects of the decisions that name the communism and democratic ideologies, keyed by decision name
+		std::map<std::string, ScriptTemplate> timeoutEffects;
 };
 
 }
@@ -4,5 +4,5 @@
 
 std::string HoI4::getElectionsAllowedString(const std::string& ideology)
 {
-	return (ideology == "democratic") ? "yes\n" : "no\n";
+	return (ideology == "democratic") ? "yes" : "no";
 }
\ No newline at end of file
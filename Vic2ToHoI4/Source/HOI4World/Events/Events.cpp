@@ -8,12 +8,14 @@
 #include "HOI4World/HoI4Country.h"
 #include "HOI4World/HoI4Localisation.h"
 #include "HOI4World/OnActions.h"
+#include "HOI4World/ScriptWriter.h"
 #include "LarOccupationEvents.h"
 #include "Log.h"
 #include "ParserHelpers.h"
 #include "V2World/Countries/Country.h"
 #include "V2World/Politics/Party.h"
 #include <fstream>
+#include <string_view>
 
 
 
@@ -53,49 +55,40 @@ void HoI4::Events::createFactionEvents(const Country& leader, const Country& new
 	nfEvent.setTriggeredOnly();
 	EventOption yesOption;
 	yesOption.giveName("\"Yes\"");
+	ScriptWriter script(2);
 	if (leader.isInFaction())
 	{
-		auto allyStrategy = newAlly.getTag() + " = {\n";
-		allyStrategy += "\t\t\tadd_ai_strategy = {\n";
-		allyStrategy += "\t\t\t\ttype = alliance\n";
-		allyStrategy += "\t\t\t\tid = \"" + leader.getTag() + "\"\n";
-		allyStrategy += "\t\t\t\tvalue = 200\n";
-		allyStrategy += "\t\t\t}\n";
-		allyStrategy += "\t\t\tdismantle_faction = yes\n";
-		allyStrategy += "\t\t}";
-		yesOption.giveScriptBlock(std::move(allyStrategy));
-		std::string createFaction = "if = {\n";
-		createFaction += "\t\t\tlimit = {\n";
-		createFaction += "\t\t\t\t" + leader.getTag() + " = {\n";
-		createFaction += "\t\t\t\t\tis_in_faction = no\n";
-		createFaction += "\t\t\t\t}\n";
-		createFaction += "\t\t\t}\n";
-		createFaction += "\t\t\t" + leader.getTag() + " = {\n";
-		createFaction += "\t\t\t\tcreate_faction = \"" + leaderName + "\"\n";
-		createFaction += "\t\t\t}\n";
-		createFaction += "\t\t}";
-		yesOption.giveScriptBlock(std::move(createFaction));
-		auto addToFaction = leader.getTag() + " = {\n";
-		addToFaction += "\t\t\tadd_to_faction = " + newAlly.getTag() + "\n";
-		addToFaction += "\t\t}";
-		yesOption.giveScriptBlock(std::move(addToFaction));
+		script.open(newAlly.getTag())
+			 .open("add_ai_strategy")
+			 .set("type", "alliance")
+			 .set("id", '"', leader.getTag(), '"')
+			 .set("value", 200)
+			 .close()
+			 .set("dismantle_faction", "yes")
+			 .close();
+		yesOption.giveScriptBlock(script.finish());
+		script.open("if")
+			 .open("limit")
+			 .open(leader.getTag())
+			 .set("is_in_faction", "no")
+			 .close()
+			 .close()
+			 .open(leader.getTag())
+			 .set("create_faction", '"', leaderName, '"')
+			 .close()
+			 .close();
+		yesOption.giveScriptBlock(script.finish());
+		script.open(leader.getTag()).set("add_to_faction", newAlly.getTag()).close();
+		yesOption.giveScriptBlock(script.finish());
 	}
-	yesOption.giveHiddenEffect(
-		 "= {\n"
-		 "\t\t\tnews_event = { id = news." +
-		 std::to_string(newsEventNumber) +
-		 " }\n"
-		 "\t\t}");
+	script.open().line("news_event = { id = news.", newsEventNumber, " }").close();
+	yesOption.giveHiddenEffect(script.finish());
 	nfEvent.giveOption(std::move(yesOption));
 	EventOption noOption;
 	noOption.giveName("\"No\"");
 	noOption.giveAiChance("= { factor = 0 }");
-	noOption.giveHiddenEffect(
-		 "= {\n"
-		 "\t\t\tnews_event = { id = news." +
-		 std::to_string(newsEventNumber + 1) +
-		 " }\n"
-		 "\t\t}");
+	script.open().line("news_event = { id = news.", newsEventNumber + 1, " }").close();
+	noOption.giveHiddenEffect(script.finish());
 	nfEvent.giveOption(std::move(noOption));
 	nationalFocusEvents.push_back(nfEvent);
 
@@ -169,62 +162,50 @@ void HoI4::Events::createAnnexEvent(const Country& annexer, const Country& annex
 	annexEvent.givePicture("GFX_report_event_hitler_parade");
 	annexEvent.setTriggeredOnly();
 
+	ScriptWriter script(2);
 	EventOption acceptOption;
 	acceptOption.giveName("\"We accept the Union\"");
-	std::string acceptAiChance = "= {\n";
-	acceptAiChance += "\t\t\tbase = 30\n";
-	acceptAiChance += "\t\t\tmodifier = {\n";
-	acceptAiChance += "\t\t\t\tadd = -15\n";
-	acceptAiChance += "\t\t\t\t" + annexed.getTag() + " = { has_army_size = { size < 40 } }\n";
-	acceptAiChance += "\t\t\t}\n";
-	acceptAiChance += "\t\t\tmodifier = {\n";
-	acceptAiChance += "\t\t\t\tadd = 45\n";
-	acceptAiChance += "\t\t\t\t" + annexed.getTag() + " = { has_army_size = { size > 39 } }\n";
-	acceptAiChance += "\t\t\t}\n";
-	acceptAiChance += "\t\t}";
-	acceptOption.giveAiChance(std::move(acceptAiChance));
-	auto acceptNewsEvent = annexed.getTag() + " = {\n";
-	acceptNewsEvent +=
-		 "\t\t\tcountry_event = { "
-		 "hours = 2 "
-		 "id = NFEvents." +
-		 std::to_string(nationalFocusEventNumber + 1) +
-		 " "
-		 "}\n";
-	acceptNewsEvent += "\t\t}";
-	acceptOption.giveScriptBlock(std::move(acceptNewsEvent));
-	std::string tooltip = "custom_effect_tooltip = GAME_OVER_TT";
-	acceptOption.giveScriptBlock(std::move(tooltip));
+	script.open()
+		 .set("base", 30)
+		 .open("modifier")
+		 .set("add", -15)
+		 .line(annexed.getTag(), " = { has_army_size = { size < 40 } }")
+		 .close()
+		 .open("modifier")
+		 .set("add", 45)
+		 .line(annexed.getTag(), " = { has_army_size = { size > 39 } }")
+		 .close()
+		 .close();
+	acceptOption.giveAiChance(script.finish());
+	script.open(annexed.getTag())
+		 .line("country_event = { hours = 2 id = NFEvents.", nationalFocusEventNumber + 1, " }")
+		 .close();
+	acceptOption.giveScriptBlock(script.finish());
+	acceptOption.giveScriptBlock("custom_effect_tooltip = GAME_OVER_TT");
 	annexEvent.giveOption(std::move(acceptOption));
 
 	EventOption refuseOption;
 	refuseOption.giveName("\"We Refuse!\"");
-	std::string refuseAiChance = "= {\n";
-	refuseAiChance += "\t\t\tbase = 10\n";
-	refuseAiChance += "\t\t\tmodifier = {\n";
-	refuseAiChance += "\t\t\t\tfactor = 0\n";
-	refuseAiChance += "\t\t\t\t" + annexed.getTag() + " = { has_army_size = { size > 39 } }\n";
-	refuseAiChance += "\t\t\t}\n";
-	refuseAiChance += "\t\t\tmodifier = {\n";
-	refuseAiChance += "\t\t\t\tadd = 20\n";
-	refuseAiChance += "\t\t\t\t" + annexed.getTag() + " = { has_army_size = { size < 30 } }\n";
-	refuseAiChance += "\t\t\t}\n";
-	refuseAiChance += "\t\t}";
-	refuseOption.giveAiChance(std::move(refuseAiChance));
-	auto removeFromFaction = annexed.getTag() + " = {\n";
-	removeFromFaction +=
-		 "\t\t\tcountry_event = { "
-		 "hours = 2 "
-		 "id = NFEvents." +
-		 std::to_string(nationalFocusEventNumber + 2) +
-		 " "
-		 "}\n";
-	removeFromFaction += "\t\t\tif = {\n";
-	removeFromFaction += "\t\t\t\tlimit = { is_in_faction_with = " + annexed.getTag() + " }\n";
-	removeFromFaction += "\t\t\t\tremove_from_faction = " + annexed.getTag() + "\n";
-	removeFromFaction += "\t\t\t}\n";
-	removeFromFaction += "\t\t}";
-	refuseOption.giveScriptBlock(std::move(removeFromFaction));
+	script.open()
+		 .set("base", 10)
+		 .open("modifier")
+		 .set("factor", 0)
+		 .line(annexed.getTag(), " = { has_army_size = { size > 39 } }")
+		 .close()
+		 .open("modifier")
+		 .set("add", 20)
+		 .line(annexed.getTag(), " = { has_army_size = { size < 30 } }")
+		 .close()
+		 .close();
+	refuseOption.giveAiChance(script.finish());
+	script.open(annexed.getTag())
+		 .line("country_event = { hours = 2 id = NFEvents.", nationalFocusEventNumber + 2, " }")
+		 .open("if")
+		 .line("limit = { is_in_faction_with = ", annexed.getTag(), " }")
+		 .set("remove_from_faction", annexed.getTag())
+		 .close()
+		 .close();
+	refuseOption.giveScriptBlock(script.finish());
 	annexEvent.giveOption(std::move(refuseOption));
 
 	nationalFocusEvents.push_back(annexEvent);
@@ -241,11 +222,8 @@ void HoI4::Events::createAnnexEvent(const Country& annexer, const Country& annex
 
 	EventOption refusedOption;
 	refusedOption.giveName("\"It's time for war\"");
-	std::string wargoal = "create_wargoal = {\n";
-	wargoal += "\t\t\ttype = annex_everything\n";
-	wargoal += "\t\t\ttarget = " + annexed.getTag() + "\n";
-	wargoal += "\t\t}";
-	refusedOption.giveScriptBlock(std::move(wargoal));
+	script.open("create_wargoal").set("type", "annex_everything").set("target", annexed.getTag()).close();
+	refusedOption.giveScriptBlock(script.finish());
 	refusedEvent.giveOption(std::move(refusedOption));
 
 	nationalFocusEvents.push_back(refusedEvent);
@@ -264,13 +242,13 @@ void HoI4::Events::createAnnexEvent(const Country& annexer, const Country& annex
 	acceptedOption.giveName("\"A stronger Union!\"");
 	for (auto state: annexed.getStates())
 	{
-		auto addCore = std::to_string(state) + " = {\n";
-		addCore += "\t\t\tif = {\n";
-		addCore += "\t\t\t\tlimit = { is_owned_by = " + annexed.getTag() + " }\n";
-		addCore += "\t\t\t\tadd_core_of = " + annexed.getTag() + "\n";
-		addCore += "\t\t\t}\n";
-		addCore += "\t\t}";
-		acceptedOption.giveScriptBlock(std::move(addCore));
+		script.open(state)
+			 .open("if")
+			 .line("limit = { is_owned_by = ", annexed.getTag(), " }")
+			 .set("add_core_of", annexed.getTag())
+			 .close()
+			 .close();
+		acceptedOption.giveScriptBlock(script.finish());
 	}
 	acceptedOption.giveScriptBlock("annex_country = { target = " + annexed.getTag() + " transfer_troops = yes }");
 	acceptedOption.giveScriptBlock("add_political_power = 50");
@@ -345,60 +323,49 @@ void HoI4::Events::createSudetenEvent(const Country& annexer,
 	sudetenEvent.givePicture("GFX_report_event_hitler_parade");
 	sudetenEvent.setTriggeredOnly();
 
+	ScriptWriter script(2);
 	EventOption acceptOption;
 	acceptOption.giveName("\"We Accept\"");
-	std::string acceptAiChance = "= {\n";
-	acceptAiChance += "\t\t\tbase = 30\n";
-	acceptAiChance += "\t\t\tmodifier = {\n";
-	acceptAiChance += "\t\t\t\tadd = -15\n";
-	acceptAiChance += "\t\t\t\t" + annexer.getTag() + " = { has_army_size = { size < 40 } }\n";
-	acceptAiChance += "\t\t\t}\n";
-	acceptAiChance += "\t\t\tmodifier = {\n";
-	acceptAiChance += "\t\t\t\tadd = 45\n";
-	acceptAiChance += "\t\t\t\t" + annexer.getTag() + " = { has_army_size = { size > 39 } }\n";
-	acceptAiChance += "\t\t\t}\n";
-	acceptAiChance += "\t\t}";
-	acceptOption.giveAiChance(std::move(acceptAiChance));
-	auto acceptNewsEvent = annexer.getTag() + " = {\n";
-	acceptNewsEvent +=
-		 "\t\t\tcountry_event = { "
-		 "hours = 2 "
-		 "id = NFEvents." +
-		 std::to_string(nationalFocusEventNumber + 1) +
-		 " "
-		 "}\n";
-	acceptNewsEvent += "\t\t}";
-	acceptOption.giveScriptBlock(std::move(acceptNewsEvent));
+	script.open()
+		 .set("base", 30)
+		 .open("modifier")
+		 .set("add", -15)
+		 .line(annexer.getTag(), " = { has_army_size = { size < 40 } }")
+		 .close()
+		 .open("modifier")
+		 .set("add", 45)
+		 .line(annexer.getTag(), " = { has_army_size = { size > 39 } }")
+		 .close()
+		 .close();
+	acceptOption.giveAiChance(script.finish());
+	script.open(annexer.getTag())
+		 .line("country_event = { hours = 2 id = NFEvents.", nationalFocusEventNumber + 1, " }")
+		 .close();
+	acceptOption.giveScriptBlock(script.finish());
 	sudetenEvent.giveOption(std::move(acceptOption));
 
 	EventOption refuseOption;
 	refuseOption.giveName("\"We Refuse!\"");
-	std::string refuseAiChance = " = {\n";
-	refuseAiChance += "\t\t\tbase = 10\n";
-	refuseAiChance += "\t\t\tmodifier = {\n";
-	refuseAiChance += "\t\t\t\tfactor = 0\n";
-	refuseAiChance += "\t\t\t\t" + annexer.getTag() + " = { has_army_size = { size > 39 } }\n";
-	refuseAiChance += "\t\t\t}\n";
-	refuseAiChance += "\t\t\tmodifier = {\n";
-	refuseAiChance += "\t\t\t\tadd = 20\n";
-	refuseAiChance += "\t\t\t\t" + annexer.getTag() + " = { has_army_size = { size < 30 } }\n";
-	refuseAiChance += "\t\t\t}\n";
-	refuseAiChance += "\t\t}";
-	refuseOption.giveAiChance(std::move(refuseAiChance));
-	auto removeFromFaction = annexer.getTag() + " = {\n";
-	removeFromFaction +=
-		 "\t\t\tcountry_event = { "
-		 "hours = 2 "
-		 "id = NFEvents." +
-		 std::to_string(nationalFocusEventNumber + 2) +
-		 " "
-		 "}\n";
-	removeFromFaction += "\t\t\tif = {\n";
-	removeFromFaction += "\t\t\t\tlimit = { is_in_faction_with = " + annexed.getTag() + " }\n";
-	removeFromFaction += "\t\t\t\tremove_from_faction = " + annexed.getTag() + "\n";
-	removeFromFaction += "\t\t\t}\n";
-	removeFromFaction += "\t\t}";
-	refuseOption.giveScriptBlock(std::move(removeFromFaction));
+	script.open()
+		 .set("base", 10)
+		 .open("modifier")
+		 .set("factor", 0)
+		 .line(annexer.getTag(), " = { has_army_size = { size > 39 } }")
+		 .close()
+		 .open("modifier")
+		 .set("add", 20)
+		 .line(annexer.getTag(), " = { has_army_size = { size < 30 } }")
+		 .close()
+		 .close();
+	refuseOption.giveAiChance(script.finish());
+	script.open(annexer.getTag())
+		 .line("country_event = { hours = 2 id = NFEvents.", nationalFocusEventNumber + 2, " }")
+		 .open("if")
+		 .line("limit = { is_in_faction_with = ", annexed.getTag(), " }")
+		 .set("remove_from_faction", annexed.getTag())
+		 .close()
+		 .close();
+	refuseOption.giveScriptBlock(script.finish());
 	sudetenEvent.giveOption(std::move(refuseOption));
 
 	nationalFocusEvents.push_back(sudetenEvent);
@@ -416,11 +383,8 @@ void HoI4::Events::createSudetenEvent(const Country& annexer,
 
 	EventOption refusedOption;
 	refusedOption.giveName("\"It's time for war\"");
-	std::string createWargoal = "create_wargoal = {\n";
-	createWargoal += "\t\t\ttype = annex_everything\n";
-	createWargoal += "\t\t\ttarget = " + annexed.getTag() + "\n";
-	createWargoal += "\t\t}";
-	refusedOption.giveScriptBlock(std::move(createWargoal));
+	script.open("create_wargoal").set("type", "annex_everything").set("target", annexed.getTag()).close();
+	refusedOption.giveScriptBlock(script.finish());
 	refusedEvent.giveOption(std::move(refusedOption));
 
 	nationalFocusEvents.push_back(refusedEvent);
@@ -475,25 +439,27 @@ void HoI4::Events::createTradeEvent(const Country& leader, const Country& greatP
 	tradeIncidentEvent.giveDescription("= \"One of our convoys was sunk by " + aggressorName + "\"");
 	tradeIncidentEvent.givePicture("GFX_report_event_chinese_soldiers_fighting");
 	tradeIncidentEvent.setTriggeredOnly();
-	std::string trigger = "= {\n";
-	trigger += "\t\thas_country_flag = established_traders\n";
-	trigger += "\t\tNOT = { has_country_flag = established_traders_activated }\n";
-	trigger += "\t}";
-	tradeIncidentEvent.giveTrigger(std::move(trigger));
+	ScriptWriter trigger(1);
+	trigger.open()
+		 .set("has_country_flag", "established_traders")
+		 .line("NOT = { has_country_flag = established_traders_activated }")
+		 .close();
+	tradeIncidentEvent.giveTrigger(trigger.finish());
 
 	EventOption option;
 	option.giveName("\"They will Pay!\"");
 	option.giveAiChance("= { factor = 85 }");
-	std::string effectTooltip = "effect_tooltip = {\n";
-	effectTooltip += "\t\t\t" + leader.getTag() + " = {\n";
-	effectTooltip += "\t\t\t\tset_country_flag = established_traders_activated\n";
-	effectTooltip += "\t\t\t\tcreate_wargoal = {\n";
-	effectTooltip += "\t\t\t\t\ttype = annex_everything\n";
-	effectTooltip += "\t\t\t\t\ttarget = " + greatPower.getTag() + "\n";
-	effectTooltip += "\t\t\t\t}\n";
-	effectTooltip += "\t\t\t}\n";
-	effectTooltip += "\t\t}";
-	option.giveScriptBlock(std::move(effectTooltip));
+	ScriptWriter effect(2);
+	effect.open("effect_tooltip")
+		 .open(leader.getTag())
+		 .set("set_country_flag", "established_traders_activated")
+		 .open("create_wargoal")
+		 .set("type", "annex_everything")
+		 .set("target", greatPower.getTag())
+		 .close()
+		 .close()
+		 .close();
+	option.giveScriptBlock(effect.finish());
 	tradeIncidentEvent.giveOption(std::move(option));
 
 	nationalFocusEvents.push_back(tradeIncidentEvent);
@@ -530,35 +496,36 @@ void HoI4::Events::addOnTheRise(const std::set<std::string>& majorIdeologies, Lo
 		onTheRise.giveDescription("= " + description);
 		localisation.copyEventLocalisations(ideology + "_on_the_rise.d", description);
 		onTheRise.givePicture(getIdeologicalPicture(ideology));
-		std::string addOnTheRiseTrigger = "= {\n";
-		addOnTheRiseTrigger += "\t\tNOT = { has_government = " + ideology + " }\n";
-		addOnTheRiseTrigger += "\t\t" + ideology + " > 0.6\n";
-		addOnTheRiseTrigger += "\t\tNOT = { " + ideology + " > 0.7 }\n";
-		addOnTheRiseTrigger += "\t}";
-		onTheRise.giveTrigger(std::move(addOnTheRiseTrigger));
+		ScriptWriter eventScript(1);
+		eventScript.open()
+			 .line("NOT = { has_government = ", ideology, " }")
+			 .line(ideology, " > 0.6")
+			 .line("NOT = { ", ideology, " > 0.7 }")
+			 .close();
+		onTheRise.giveTrigger(eventScript.finish());
 		onTheRise.setFireOnlyOnce();
-		std::string onTheRiseMtth = "= {\n";
-		onTheRiseMtth += "\t\tdays = 30\n";
-		onTheRiseMtth += "\t}";
-		onTheRise.giveMeanTimeToHappen(std::move(onTheRiseMtth));
+		eventScript.open().set("days", 30).close();
+		onTheRise.giveMeanTimeToHappen(eventScript.finish());
 
 		EventOption onTheRiseOptionA;
 		auto optionAName = "conv.political." + std::to_string(politicalEventNumber) + ".a";
 		localisation.copyEventLocalisations(ideology + "_on_the_rise.a", optionAName);
 		onTheRiseOptionA.giveName(std::move(optionAName));
 		onTheRiseOptionA.giveScriptBlock("add_political_power = -100");
-		std::string setPoliticsEffect = "set_politics = {\n";
-		setPoliticsEffect += "\t\t\truling_party = " + ideology + "\n";
-		setPoliticsEffect += "\t\t\telections_allowed = " + getElectionsAllowedString(ideology);
-		setPoliticsEffect += "\t\t}";
-		onTheRiseOptionA.giveScriptBlock(std::move(setPoliticsEffect));
+		ScriptWriter optionScript(2);
+		optionScript.open("set_politics")
+			 .set("ruling_party", ideology)
+			 .set("elections_allowed", getElectionsAllowedString(ideology))
+			 .close();
+		onTheRiseOptionA.giveScriptBlock(optionScript.finish());
 		onTheRise.giveOption(std::move(onTheRiseOptionA));
 
 		EventOption onTheRiseOptionB;
 		auto optionBName = "conv.political." + std::to_string(politicalEventNumber) + ".b";
 		localisation.copyEventLocalisations(ideology + "_on_the_rise.b", optionBName);
 		onTheRiseOptionB.giveName(std::move(optionBName));
-		onTheRiseOptionB.giveAiChance("= {\n\t\t\tfactor = 0\n\t\t}");
+		optionScript.open().set("factor", 0).close();
+		onTheRiseOptionB.giveAiChance(optionScript.finish());
 		onTheRiseOptionB.giveScriptBlock("custom_effect_tooltip = impending_civil_war_tt");
 		onTheRise.giveOption(std::move(onTheRiseOptionB));
 
@@ -587,30 +554,29 @@ void HoI4::Events::addMinisterRevolutionEvents(const std::set<std::string>& majo
 		addPopularity.giveDescription("= " + description);
 		localisation.copyEventLocalisations(ideology + "_add_popularity.d", description);
 		addPopularity.givePicture(getIdeologicalPicture(ideology));
-		std::string addPopularityTrigger = "= {\n";
-		addPopularityTrigger += "\t\thas_idea_with_trait = " + ideology + "_minister\n";
-		addPopularityTrigger += "\t\tNOT = { has_government = " + ideology + " }\n";
-		addPopularityTrigger += "\t\t" + ideology + " > 0.2\n";
-		addPopularityTrigger += "\t\tNOT = { " + ideology + " > 0.59 }\n";
-		addPopularityTrigger += "\t}";
-		addPopularity.giveTrigger(std::move(addPopularityTrigger));
-		std::string addPopularityMtth = "= {\n";
-		addPopularityMtth += "\t\tdays = 365\n";
-		addPopularityMtth += "\t\tmodifier = {\n";
-		addPopularityMtth += "\t\t\tfactor = 0.5\n";
-		addPopularityMtth += "\t\t\thas_country_flag = " + ideology + "_popular_movement\n";
-		addPopularityMtth += "\t\t}\n";
-		addPopularityMtth += "\t}";
-		addPopularity.giveMeanTimeToHappen(std::move(addPopularityMtth));
+		ScriptWriter eventScript(1);
+		eventScript.open()
+			 .set("has_idea_with_trait", ideology, "_minister")
+			 .line("NOT = { has_government = ", ideology, " }")
+			 .line(ideology, " > 0.2")
+			 .line("NOT = { ", ideology, " > 0.59 }")
+			 .close();
+		addPopularity.giveTrigger(eventScript.finish());
+		eventScript.open()
+			 .set("days", 365)
+			 .open("modifier")
+			 .set("factor", "0.5")
+			 .set("has_country_flag", ideology, "_popular_movement")
+			 .close()
+			 .close();
+		addPopularity.giveMeanTimeToHappen(eventScript.finish());
 		EventOption addPopularityOptionA;
 		auto optionName = "conv.political." + std::to_string(politicalEventNumber) + ".a";
 		localisation.copyEventLocalisations(ideology + "_add_popularity.a", optionName);
 		addPopularityOptionA.giveName(std::move(optionName));
-		std::string addPopularityEffect = "add_popularity = {\n";
-		addPopularityEffect += "\t\t\tideology = " + ideology + "\n";
-		addPopularityEffect += "\t\t\tpopularity = 0.05\n";
-		addPopularityEffect += "\t\t}";
-		addPopularityOptionA.giveScriptBlock(std::move(addPopularityEffect));
+		ScriptWriter optionScript(2);
+		optionScript.open("add_popularity").set("ideology", ideology).set("popularity", "0.05").close();
+		addPopularityOptionA.giveScriptBlock(optionScript.finish());
 		addPopularityOptionA.giveScriptBlock("add_stability = -0.05");
 		addPopularity.giveOption(std::move(addPopularityOptionA));
 		politicalEvents.push_back(addPopularity);
@@ -625,31 +591,28 @@ void HoI4::Events::addMinisterRevolutionEvents(const std::set<std::string>& majo
 		militaryDefections.giveDescription("= " + description2);
 		localisation.copyEventLocalisations(ideology + "_military_defections.d", description2);
 		militaryDefections.givePicture(getIdeologicalPicture(ideology));
-		std::string militaryDefectionsTrigger = "= {\n";
-		militaryDefectionsTrigger += "\t\thas_idea_with_trait = " + ideology + "_minister\n";
-		militaryDefectionsTrigger += "\t\tNOT = { has_government = " + ideology + " }\n";
-		militaryDefectionsTrigger += "\t\t" + ideology + " > 0.3\n";
-		militaryDefectionsTrigger += "\t\tNOT = { " + ideology + " > 0.59 }\n";
-		militaryDefectionsTrigger += "\t\tNOT = { has_idea = " + ideology + "_partisans_recruiting }\n";
-		militaryDefectionsTrigger += "\t}";
-		militaryDefections.giveTrigger(std::move(militaryDefectionsTrigger));
-		std::string militaryDefectionsMtth = "= {\n";
-		militaryDefectionsMtth += "\t\tdays = 365\n";
-		militaryDefectionsMtth += "\t\tmodifier = {\n";
-		militaryDefectionsMtth += "\t\t\tfactor = 0.5\n";
-		militaryDefectionsMtth += "\t\t\thas_country_flag = " + ideology + "_popular_movement\n";
-		militaryDefectionsMtth += "\t\t}\n";
-		militaryDefectionsMtth += "\t}";
-		militaryDefections.giveMeanTimeToHappen(std::move(militaryDefectionsMtth));
+		eventScript.open()
+			 .set("has_idea_with_trait", ideology, "_minister")
+			 .line("NOT = { has_government = ", ideology, " }")
+			 .line(ideology, " > 0.3")
+			 .line("NOT = { ", ideology, " > 0.59 }")
+			 .line("NOT = { has_idea = ", ideology, "_partisans_recruiting }")
+			 .close();
+		militaryDefections.giveTrigger(eventScript.finish());
+		eventScript.open()
+			 .set("days", 365)
+			 .open("modifier")
+			 .set("factor", "0.5")
+			 .set("has_country_flag", ideology, "_popular_movement")
+			 .close()
+			 .close();
+		militaryDefections.giveMeanTimeToHappen(eventScript.finish());
 		EventOption militaryDefectionsOptionA;
 		optionName = "conv.political." + std::to_string(politicalEventNumber) + ".a";
 		localisation.copyEventLocalisations(ideology + "_military_defections.a", optionName);
 		militaryDefectionsOptionA.giveName(std::move(optionName));
-		std::string militaryDefectionsAddPopularity = "add_popularity = {\n";
-		militaryDefectionsAddPopularity += "\t\t\tideology = " + ideology + "\n";
-		militaryDefectionsAddPopularity += "\t\t\tpopularity = 0.05\n";
-		militaryDefectionsAddPopularity += "\t\t}";
-		militaryDefectionsOptionA.giveScriptBlock(std::move(militaryDefectionsAddPopularity));
+		optionScript.open("add_popularity").set("ideology", ideology).set("popularity", "0.05").close();
+		militaryDefectionsOptionA.giveScriptBlock(optionScript.finish());
 		militaryDefectionsOptionA.giveScriptBlock("add_ideas = " + ideology + "_partisans_recruiting");
 		militaryDefections.giveOption(std::move(militaryDefectionsOptionA));
 		politicalEvents.push_back(militaryDefections);
@@ -674,31 +637,30 @@ void HoI4::Events::addDemocraticMinisterRevolutionEvents(Localisation& localisat
 	opposition.giveDescription("= " + description);
 	localisation.copyEventLocalisations("democratic_opposition_forming.d", description);
 	opposition.givePicture(getIdeologicalPicture("democratic"));
-	std::string oppositionTrigger = "= {\n";
-	oppositionTrigger += "\t\thas_idea_with_trait = democratic_reformer\n";
-	oppositionTrigger += "\t\tNOT = { has_government = democratic }\n";
-	oppositionTrigger += "\t\tNOT = { has_country_flag = democracy_opposition_formed }\n";
-	oppositionTrigger += "\t\tis_puppet = no\n";
-	oppositionTrigger += "\t\tNOT = { democratic > 0.59 }\n";
-	oppositionTrigger += "\t}";
-	opposition.giveTrigger(std::move(oppositionTrigger));
-	std::string oppositionMtth = "= {\n";
-	oppositionMtth += "\t\tdays = 300\n";
-	oppositionMtth += "\t\tmodifier = {\n";
-	oppositionMtth += "\t\t\tfactor = 0.5\n";
-	oppositionMtth += "\t\t\thas_country_flag = democracy_popular_movement\n";
-	oppositionMtth += "\t\t}\n";
-	oppositionMtth += "\t}";
-	opposition.giveMeanTimeToHappen(std::move(oppositionMtth));
+	ScriptWriter eventScript(1);
+	eventScript.open()
+		 .set("has_idea_with_trait", "democratic_reformer")
+		 .line("NOT = { has_government = democratic }")
+		 .line("NOT = { has_country_flag = democracy_opposition_formed }")
+		 .set("is_puppet", "no")
+		 .line("NOT = { democratic > 0.59 }")
+		 .close();
+	opposition.giveTrigger(eventScript.finish());
+	eventScript.open()
+		 .set("days", 300)
+		 .open("modifier")
+		 .set("factor", "0.5")
+		 .set("has_country_flag", "democracy_popular_movement")
+		 .close()
+		 .close();
+	opposition.giveMeanTimeToHappen(eventScript.finish());
 	EventOption oppositionOptionA;
 	auto optionName = "conv.political." + std::to_string(politicalEventNumber) + ".a";
 	localisation.copyEventLocalisations("democratic_opposition_forming.a", optionName);
 	oppositionOptionA.giveName(std::move(optionName));
-	std::string addPopularity = "add_popularity = {\n";
-	addPopularity += "\t\t\tideology = democratic\n";
-	addPopularity += "\t\t\tpopularity = 0.05\n";
-	addPopularity += "\t\t}";
-	oppositionOptionA.giveScriptBlock(std::move(addPopularity));
+	ScriptWriter optionScript(2);
+	optionScript.open("add_popularity").set("ideology", "democratic").set("popularity", "0.05").close();
+	oppositionOptionA.giveScriptBlock(optionScript.finish());
 	oppositionOptionA.giveScriptBlock("add_stability = -0.05");
 	oppositionOptionA.giveScriptBlock("set_country_flag = democracy_opposition_formed");
 	opposition.giveOption(std::move(oppositionOptionA));
@@ -714,17 +676,15 @@ void HoI4::Events::addDemocraticMinisterRevolutionEvents(Localisation& localisat
 	callForElections.giveDescription("= " + description2);
 	localisation.copyEventLocalisations("democratic_call_for_elections.d", description2);
 	callForElections.givePicture(getIdeologicalPicture("democratic"));
-	std::string callForElectionsTrigger = "= {\n";
-	callForElectionsTrigger += "\t\thas_idea_with_trait = democratic_reformer\n";
-	callForElectionsTrigger += "\t\tNOT = { has_government = democratic }\n";
-	callForElectionsTrigger += "\t\thas_country_flag = democracy_opposition_formed\n";
-	callForElectionsTrigger += "\t\tNOT = { has_idea = democratic_opposition_voicing_protests }\n";
-	callForElectionsTrigger += "\t}";
-	callForElections.giveTrigger(std::move(callForElectionsTrigger));
-	std::string callForElectionsMtth = "= {\n";
-	callForElectionsMtth += "\t\tdays = 150\n";
-	callForElectionsMtth += "\t}";
-	callForElections.giveMeanTimeToHappen(std::move(callForElectionsMtth));
+	eventScript.open()
+		 .set("has_idea_with_trait", "democratic_reformer")
+		 .line("NOT = { has_government = democratic }")
+		 .set("has_country_flag", "democracy_opposition_formed")
+		 .line("NOT = { has_idea = democratic_opposition_voicing_protests }")
+		 .close();
+	callForElections.giveTrigger(eventScript.finish());
+	eventScript.open().set("days", 150).close();
+	callForElections.giveMeanTimeToHappen(eventScript.finish());
 	EventOption callForElectionsOptionA;
 	optionName = "conv.political." + std::to_string(politicalEventNumber) + ".a";
 	localisation.copyEventLocalisations("democratic_call_for_elections.a", optionName);
@@ -769,6 +729,7 @@ void HoI4::Events::addFiftyPercentEvents(const std::set<std::string>& majorIdeol
 		auto optionName = "conv.political." + std::to_string(politicalEventNumber) + ".c";
 		localisation.copyEventLocalisations(ideology + "_fifty_percent.c", optionName);
 		optionC.giveName(std::move(optionName));
+		ScriptWriter optionScript(2);
 		if (ideology == "democratic")
 		{
 			for (const auto& ideology2: majorIdeologies)
@@ -777,18 +738,18 @@ void HoI4::Events::addFiftyPercentEvents(const std::set<std::string>& majorIdeol
 				{
 					continue;
 				}
-				std::string timedIdeaScript = "if = {\n";
-				timedIdeaScript += "\t\t\tlimit = { has_government = " + ideology2 + " }\n";
-				timedIdeaScript += "\t\t\tadd_timed_idea = { idea = " + ideology2 + "_defeated days = 730 }\n";
-				timedIdeaScript += "\t\t}";
-				optionC.giveScriptBlock(std::move(timedIdeaScript));
+				optionScript.open("if")
+					 .line("limit = { has_government = ", ideology2, " }")
+					 .line("add_timed_idea = { idea = ", ideology2, "_defeated days = 730 }")
+					 .close();
+				optionC.giveScriptBlock(optionScript.finish());
 			}
 		}
-		std::string setPoliticsScript = "set_politics = {\n";
-		setPoliticsScript += "\t\t\truling_party = " + ideology + "\n";
-		setPoliticsScript += "\t\t\telections_allowed = " + getElectionsAllowedString(ideology);
-		setPoliticsScript += "\t\t}";
-		optionC.giveScriptBlock(std::move(setPoliticsScript));
+		optionScript.open("set_politics")
+			 .set("ruling_party", ideology)
+			 .set("elections_allowed", getElectionsAllowedString(ideology))
+			 .close();
+		optionC.giveScriptBlock(optionScript.finish());
 		if (ideology == "democratic")
 		{
 			optionC.giveScriptBlock("hold_election = ROOT");
@@ -820,69 +781,57 @@ void HoI4::Events::addRevolutionEvents(const std::set<std::string>& majorIdeolog
 		revolutionEvent.giveDescription("= " + description);
 		localisation.copyEventLocalisations(ideology + "_revolution_event.d", description);
 		revolutionEvent.givePicture(getIdeologicalPicture(ideology));
-		std::string trigger = "= {\n";
-		trigger += "\t\t" + ideology + " > 0.7\n";
-		trigger += "\t\tnum_of_controlled_states > 1\n";
-		trigger += "\t\tNOT = { has_government = " + ideology + " }\n";
-		trigger += "\t\thas_civil_war = no\n";
-		trigger += "\t}";
-		revolutionEvent.giveTrigger(std::move(trigger));
-
-		std::string mtth = "= {\n";
-		mtth += "\t\tdays = 2\n";
-		mtth += "\t}";
-		revolutionEvent.giveMeanTimeToHappen(std::move(mtth));
-		std::string immediate = "= {\n";
-		immediate += "\t\thidden_effect = { remove_ideas = " + ideology + "_revolutionaries }\n";
-		immediate += "\t}";
-		revolutionEvent.giveImmediate(std::move(immediate));
+		ScriptWriter eventScript(1);
+		eventScript.open()
+			 .line(ideology, " > 0.7")
+			 .line("num_of_controlled_states > 1")
+			 .line("NOT = { has_government = ", ideology, " }")
+			 .set("has_civil_war", "no")
+			 .close();
+		revolutionEvent.giveTrigger(eventScript.finish());
+
+		eventScript.open().set("days", 2).close();
+		revolutionEvent.giveMeanTimeToHappen(eventScript.finish());
+		eventScript.open().line("hidden_effect = { remove_ideas = ", ideology, "_revolutionaries }").close();
+		revolutionEvent.giveImmediate(eventScript.finish());
 		EventOption optionA;
 		auto optionName = "conv.political." + std::to_string(politicalEventNumber) + ".a";
 		localisation.copyEventLocalisations(ideology + "_revolution_event.a", optionName);
 		optionA.giveName(std::move(optionName));
-		std::string aiChanceA = "= {\n";
-		aiChanceA += "\t\t\tfactor = 0\n";
-		aiChanceA += "\t\t}";
-		optionA.giveAiChance(std::move(aiChanceA));
-		std::string startCivilWar = "start_civil_war = {\n";
-		startCivilWar += "\t\t\tideology = " + ideology + "\n";
-		startCivilWar += "\t\t\tsize = 0.5\n";
-		startCivilWar += "\t\t}";
-		optionA.giveScriptBlock(std::move(startCivilWar));
+		ScriptWriter optionScript(2);
+		optionScript.open().set("factor", 0).close();
+		optionA.giveAiChance(optionScript.finish());
+		optionScript.open("start_civil_war").set("ideology", ideology).set("size", "0.5").close();
+		optionA.giveScriptBlock(optionScript.finish());
 		revolutionEvent.giveOption(std::move(optionA));
 		EventOption optionB;
 		optionName = "conv.political." + std::to_string(politicalEventNumber) + ".b";
 		localisation.copyEventLocalisations(ideology + "_revolution_event.b", optionName);
 		optionB.giveName(std::move(optionName));
-		std::string aiChanceB = "ai_chance = {\n";
-		aiChanceB += "\t\t\tfactor = 0\n";
-		aiChanceB += "\t\t}";
-		optionB.giveScriptBlock(std::move(aiChanceB));
+		optionScript.open("ai_chance").set("factor", 0).close();
+		optionB.giveScriptBlock(optionScript.finish());
 		for (const auto& ideology2: majorIdeologies)
 		{
 			if (ideology2 == ideology)
 			{
 				continue;
 			}
-			std::string startCivilWar2 = "if = {\n";
-			startCivilWar2 += "\t\t\tlimit = {\n";
-			startCivilWar2 += "\t\t\t\thas_government = " + ideology2 + "\n";
-			startCivilWar2 += "\t\t\t}\n";
+			optionScript.open("if").open("limit").set("has_government", ideology2).close();
 			if ((ideology == "democratic") && (ideology2 != "neutrality"))
 			{
-				startCivilWar2 += "\t\t\tadd_timed_idea = { idea = " + ideology2 + "_defeated days = 730 }\n";
+				optionScript.line("add_timed_idea = { idea = ", ideology2, "_defeated days = 730 }");
 			}
-			startCivilWar2 += "\t\t\tstart_civil_war = {\n";
-			startCivilWar2 += "\t\t\t\truling_party = " + ideology + "\n";
-			startCivilWar2 += "\t\t\t\tideology = " + ideology2 + "\n";
-			startCivilWar2 += "\t\t\t\tsize = 0.5\n";
-			startCivilWar2 += "\t\t\t}\n";
+			optionScript.open("start_civil_war")
+				 .set("ruling_party", ideology)
+				 .set("ideology", ideology2)
+				 .set("size", "0.5")
+				 .close();
 			if (ideology == "democratic")
 			{
-				startCivilWar2 += "\t\t\thold_election = ROOT\n";
+				optionScript.set("hold_election", "ROOT");
 			}
-			startCivilWar2 += "\t\t}";
-			optionB.giveScriptBlock(std::move(startCivilWar2));
+			optionScript.close();
+			optionB.giveScriptBlock(optionScript.finish());
 		}
 		revolutionEvent.giveOption(std::move(optionB));
 
@@ -892,11 +841,11 @@ void HoI4::Events::addRevolutionEvents(const std::set<std::string>& majorIdeolog
 		optionC.giveName(std::move(optionName));
 		optionC.giveTrigger("is_ai = yes");
 		optionC.giveScriptBlock("add_political_power = -100");
-		std::string setPoliticsScript = "set_politics = {\n";
-		setPoliticsScript += "\t\t\truling_party = " + ideology + "\n";
-		setPoliticsScript += "\t\t\telections_allowed = " + getElectionsAllowedString(ideology);
-		setPoliticsScript += "\t\t}";
-		optionC.giveScriptBlock(std::move(setPoliticsScript));
+		optionScript.open("set_politics")
+			 .set("ruling_party", ideology)
+			 .set("elections_allowed", getElectionsAllowedString(ideology))
+			 .close();
+		optionC.giveScriptBlock(optionScript.finish());
 		revolutionEvent.giveOption(std::move(optionC));
 
 		politicalEvents.push_back(revolutionEvent);
@@ -907,6 +856,7 @@ void HoI4::Events::addRevolutionEvents(const std::set<std::string>& majorIdeolog
 
 void HoI4::Events::addSuppressedEvents(const std::set<std::string>& majorIdeologies, Localisation& localisation)
 {
+	ScriptWriter eventScript(1);
 	for (const auto& ideology: majorIdeologies)
 	{
 		if (ideology == "neutrality")
@@ -922,15 +872,10 @@ void HoI4::Events::addSuppressedEvents(const std::set<std::string>& majorIdeolog
 		suppressedEvent.giveDescription("= " + description);
 		localisation.copyEventLocalisations(ideology + "_suppressed_event.d", description);
 		suppressedEvent.givePicture(getIdeologicalPicture(ideology));
-		std::string trigger = "= {\n";
-		trigger += "\t\t" + ideology + " < 0.3\n";
-		trigger += "\t\thas_idea = " + ideology + "_revolutionaries\n";
-		trigger += "\t}";
-		suppressedEvent.giveTrigger(std::move(trigger));
-		std::string mtth = "= {\n";
-		mtth += "\t\tdays = 2\n";
-		mtth += "\t}";
-		suppressedEvent.giveMeanTimeToHappen(std::move(mtth));
+		eventScript.open().line(ideology, " < 0.3").set("has_idea", ideology, "_revolutionaries").close();
+		suppressedEvent.giveTrigger(eventScript.finish());
+		eventScript.open().set("days", 2).close();
+		suppressedEvent.giveMeanTimeToHappen(eventScript.finish());
 		EventOption option;
 		auto optionName = "conv.political." + std::to_string(politicalEventNumber) + ".a";
 		localisation.copyEventLocalisations(ideology + "_suppressed_event.a", optionName);
@@ -963,33 +908,28 @@ void HoI4::Events::addSuppressedEvents(const std::set<std::string>& majorIdeolog
 			{
 				continue;
 			}
-			std::string description = "= {\n";
-			description += "\t\ttext = political." + std::to_string(politicalEventNumber) + ".d_" + ideology + "\n";
-			description += "\t\ttrigger = { has_government = " + ideology + " }\n";
-			description += "\t}";
-			removeNeutral.giveDescription(std::move(description));
+			eventScript.open()
+				 .set("text", "political.", politicalEventNumber, ".d_", ideology)
+				 .line("trigger = { has_government = ", ideology, " }")
+				 .close();
+			removeNeutral.giveDescription(eventScript.finish());
 			localisation.copyEventLocalisations("abandon_neutral.d_" + ideology,
 				 "conv.political." + std::to_string(politicalEventNumber) + "_" + ideology);
 		}
 		removeNeutral.givePicture("GFX_report_event_journalists_speech");
-		std::string trigger = "= {\n";
-		trigger += "\t\tOR = {\n";
+		eventScript.open().open("OR");
 		for (const auto& ideology: majorIdeologies)
 		{
 			if ((ideology == "democratic") || (ideology == "neutrality"))
 			{
 				continue;
 			}
-			trigger += "\t\t\thas_government = " + ideology + "\n";
+			eventScript.set("has_government", ideology);
 		}
-		trigger += "\t\t}\n";
-		trigger += "\t\thas_idea = neutrality_idea\n";
-		trigger += "\t}";
-		removeNeutral.giveTrigger(std::move(trigger));
-		std::string mtth = "= {\n";
-		mtth += "\t\tdays = 2\n";
-		mtth += "\t}";
-		removeNeutral.giveMeanTimeToHappen(std::move(mtth));
+		eventScript.close().set("has_idea", "neutrality_idea").close();
+		removeNeutral.giveTrigger(eventScript.finish());
+		eventScript.open().set("days", 2).close();
+		removeNeutral.giveMeanTimeToHappen(eventScript.finish());
 		EventOption option;
 		auto optionName = "conv.political." + std::to_string(politicalEventNumber) + ".a";
 		localisation.copyEventLocalisations("abandon_neutral.a", optionName);
@@ -1033,6 +973,7 @@ void HoI4::Events::createWarJustificationEvents(const std::set<std::string>& maj
 {
 	Log(LogLevel::Info) << "\tCreating war justification events";
 
+	ScriptWriter eventScript(1);
 	auto eventNum = 21;
 	for (const auto& majorIdeology: majorIdeologies)
 	{
@@ -1045,12 +986,12 @@ void HoI4::Events::createWarJustificationEvents(const std::set<std::string>& maj
 			warJustification.giveDescription("= war_justification." + std::to_string(eventNum) + ".d");
 			warJustification.givePicture("GFX_report_event_iww_demonstration");
 			warJustification.setTriggeredOnly();
-			std::string trigger = "= {\n";
-			trigger += "\t\thas_government = " + majorIdeology + "\n";
-			trigger += "\t\tFROM = { has_government = " + majorIdeology2 + " }\n";
-			trigger += "\t\tNOT = { has_country_flag = war_justification_last_event_political }\n";
-			trigger += "\t}";
-			warJustification.giveTrigger(std::move(trigger));
+			eventScript.open()
+				 .set("has_government", majorIdeology)
+				 .line("FROM = { has_government = ", majorIdeology2, " }")
+				 .line("NOT = { has_country_flag = war_justification_last_event_political }")
+				 .close();
+			warJustification.giveTrigger(eventScript.finish());
 			EventOption option;
 			option.giveName("war_justification." + std::to_string(eventNum) + ".a");
 			option.giveScriptBlock(
@@ -1098,11 +1039,10 @@ void HoI4::Events::createWarJustificationEvents(const std::set<std::string>& maj
 	warGoalExpired.giveDescription("= war_justification.301.d");
 	warGoalExpired.givePicture("GFX_report_event_iww_demonstration");
 	warGoalExpired.setTriggeredOnly();
-	std::string trigger = "= {\n";
-	trigger += "\t\thas_war = no\n";
-	trigger += "\t}";
-	warGoalExpired.giveTrigger(std::move(trigger));
+	eventScript.open().set("has_war", "no").close();
+	warGoalExpired.giveTrigger(eventScript.finish());
 
+	ScriptWriter optionScript(2);
 	auto letter = 'a';
 	for (const auto& ideology: majorIdeologies)
 	{
@@ -1113,11 +1053,8 @@ void HoI4::Events::createWarJustificationEvents(const std::set<std::string>& maj
 		option.giveScriptBlock("add_war_support = -0.03");
 		if (ideology != "neutrality")
 		{
-			std::string addPopularity = "add_popularity = {\n";
-			addPopularity += "\t\t\tideology = " + ideology + "\n";
-			addPopularity += "\t\t\tpopularity = -0.05\n";
-			addPopularity += "\t\t}";
-			option.giveScriptBlock(std::move(addPopularity));
+			optionScript.open("add_popularity").set("ideology", ideology).set("popularity", "-0.05").close();
+			option.giveScriptBlock(optionScript.finish());
 		}
 		warGoalExpired.giveOption(std::move(option));
 		letter++;
@@ -1177,133 +1114,66 @@ void HoI4::Events::addPartyChoiceEvent(const std::string& countryTag,
 	hoi4Localisations.copyEventLocalisations("party_choice.d", description);
 	partyChoiceEvent.givePicture("GFX_report_event_usa_election_generic");
 	partyChoiceEvent.setTriggeredOnly();
-	std::string trigger = "= {\n";
-	trigger += "\t\ttag = " + countryTag + "\n";
+	ScriptWriter eventScript(1);
+	eventScript.open().set("tag", countryTag);
 	if (majorIdeologies.contains("democratic"))
 	{
-		trigger += "\t\tOR = {\n";
-		trigger += "\t\t\tdemocratic > 0.5\n";
-		trigger += "\t\t\tneutrality > 0.5\n";
-		trigger += "\t\t}\n";
+		eventScript.open("OR").line("democratic > 0.5").line("neutrality > 0.5").close();
 	}
 	else
 	{
-		trigger += "\t\tneutrality > 0.5\n";
+		eventScript.line("neutrality > 0.5");
 	}
-	trigger += "\t}";
-	partyChoiceEvent.giveTrigger(std::move(trigger));
+	eventScript.close();
+	partyChoiceEvent.giveTrigger(eventScript.finish());
 
+	const std::string partyIdeology = majorIdeologies.contains("democratic") ? "democratic" : "neutrality";
+	const std::string leaderSuffix = majorIdeologies.contains("democratic") ? "" : "_neutral";
+	ScriptWriter optionScript(2);
 	auto optionLetter = 'a';
 	for (const auto& party: parties)
 	{
+		std::string leaderIdeology;
 		if (party.getIdeology() == "conservative")
 		{
-			auto partyName = party.getName();
-			auto trimmedName = partyName.substr(tagAndDashSize, partyName.size());
-
-			auto optionName = "election." + std::to_string(electionEventNumber) + optionLetter;
-			hoi4Localisations.addEventLocalisationFromVic2(partyName, optionName, vic2Localisations);
-			EventOption option;
-			option.giveName(std::move(optionName));
-			if (majorIdeologies.contains("democratic"))
-			{
-				option.giveScriptBlock(
-					 "set_party_name = { "
-					 "ideology = democratic "
-					 "long_name = " +
-					 countryTag + "_" + trimmedName + "_party " + "name = " + countryTag + "_" + trimmedName +
-					 "_party "
-					 "}");
-				option.giveScriptBlock("retire_country_leader = yes");
-				option.giveScriptBlock("set_country_leader_ideology = conservatism");
-			}
-			else
-			{
-				option.giveScriptBlock(
-					 "set_party_name = { "
-					 "ideology = neutrality "
-					 "long_name = " +
-					 countryTag + "_" + trimmedName + "_party " + "name = " + countryTag + "_" + trimmedName +
-					 "_party "
-					 "}");
-				option.giveScriptBlock("retire_country_leader = yes");
-				option.giveScriptBlock("set_country_leader_ideology = conservatism_neutral");
-			}
-			partyChoiceEvent.giveOption(std::move(option));
-			optionLetter++;
+			leaderIdeology = "conservatism";
 		}
-		if (party.getIdeology() == "liberal")
+		else if (party.getIdeology() == "liberal")
 		{
-			auto partyName = party.getName();
-			auto trimmedName = partyName.substr(tagAndDashSize, partyName.size());
-
-			auto optionName = "election." + std::to_string(electionEventNumber) + optionLetter;
-			EventOption option;
-			hoi4Localisations.addEventLocalisationFromVic2(partyName, optionName, vic2Localisations);
-			option.giveName(std::move(optionName));
-			if (majorIdeologies.contains("democratic"))
-			{
-				option.giveScriptBlock(
-					 "set_party_name = { "
-					 "ideology = democratic "
-					 "long_name = " +
-					 countryTag + "_" + trimmedName + "_party " + "name = " + countryTag + "_" + trimmedName +
-					 "_party "
-					 "}");
-				option.giveScriptBlock("retire_country_leader = yes");
-				option.giveScriptBlock("set_country_leader_ideology = liberalism");
-			}
-			else
-			{
-				option.giveScriptBlock(
-					 "set_party_name = { "
-					 "ideology = neutrality "
-					 "long_name = " +
-					 countryTag + "_" + trimmedName + "_party " + "name = " + countryTag + "_" + trimmedName +
-					 "_party "
-					 "}");
-				option.giveScriptBlock("retire_country_leader = yes");
-				option.giveScriptBlock("set_country_leader_ideology = liberalism_neutral");
-			}
-			partyChoiceEvent.giveOption(std::move(option));
-			optionLetter++;
+			leaderIdeology = "liberalism";
 		}
-		if (party.getIdeology() == "socialist")
+		else if (party.getIdeology() == "socialist")
 		{
-			auto partyName = party.getName();
-			auto trimmedName = partyName.substr(tagAndDashSize, partyName.size());
-
-			auto optionName = "election." + std::to_string(electionEventNumber) + optionLetter;
-			hoi4Localisations.addEventLocalisationFromVic2(partyName, optionName, vic2Localisations);
-			EventOption option;
-			option.giveName(std::move(optionName));
-			if (majorIdeologies.contains("democratic"))
-			{
-				option.giveScriptBlock(
-					 "set_party_name = { "
-					 "ideology = democratic "
-					 "long_name = " +
-					 countryTag + "_" + trimmedName + "_party " + "name = " + countryTag + "_" + trimmedName +
-					 "_party "
-					 "}");
-				option.giveScriptBlock("retire_country_leader = yes");
-				option.giveScriptBlock("set_country_leader_ideology = socialism");
-			}
-			else
-			{
-				option.giveScriptBlock(
-					 "set_party_name = { "
-					 "ideology = neutrality "
-					 "long_name = " +
-					 countryTag + "_" + trimmedName + "_party " + "name = " + countryTag + "_" + trimmedName +
-					 "_party "
-					 "}");
-				option.giveScriptBlock("retire_country_leader = yes");
-				option.giveScriptBlock("set_country_leader_ideology = socialism_neutral");
-			}
-			partyChoiceEvent.giveOption(std::move(option));
-			optionLetter++;
+			leaderIdeology = "socialism";
+		}
+		else
+		{
+			continue;
 		}
+
+		const auto partyName = party.getName();
+		const auto trimmedName = std::string_view(partyName).substr(tagAndDashSize);
+
+		auto optionName = "election." + std::to_string(electionEventNumber) + optionLetter;
+		hoi4Localisations.addEventLocalisationFromVic2(partyName, optionName, vic2Localisations);
+		EventOption option;
+		option.giveName(std::move(optionName));
+		optionScript.line("set_party_name = { ideology = ",
+			 partyIdeology,
+			 " long_name = ",
+			 countryTag,
+			 "_",
+			 trimmedName,
+			 "_party name = ",
+			 countryTag,
+			 "_",
+			 trimmedName,
+			 "_party }");
+		option.giveScriptBlock(optionScript.finish());
+		option.giveScriptBlock("retire_country_leader = yes");
+		option.giveScriptBlock("set_country_leader_ideology = " + leaderIdeology + leaderSuffix);
+		partyChoiceEvent.giveOption(std::move(option));
+		optionLetter++;
 	}
 
 	onActions.addElectionEvent(partyChoiceEvent.getId());
@@ -1338,96 +1208,76 @@ void HoI4::Events::createStabilityEvents(const std::set<std::string>& majorIdeol
 	parseFile(theConfiguration.getHoI4Path() + "/events/stability_events.txt");
 
 	auto lowStabilitySelector = stabilityEvents.find("stability.3");
-	std::stringstream trigger;
-	trigger << "= {\n";
-	trigger << "\t\thas_war = yes\n";
-	trigger << "\t\thas_civil_war = no\n";
-	trigger << "\t\tOR = {\n";
-	trigger << "\t\t\thas_stability < 0.5\n";
-	trigger << "\t\t\thas_war_support < 0.5\n";
-	trigger << "\t\t}\n";
-	trigger << "\t\tNOT = {\n";
-	trigger << "\t\t\tAND = {\n";
-	trigger << "\t\t\t\tis_major = yes\n";
-	trigger << "\t\t\t\tall_enemy_country = {\n";
-	trigger << "\t\t\t\t\tis_major = no\n";
-	trigger << "\t\t\t\t}\n";
-	trigger << "\t\t\t}\n";
-	trigger << "\t\t}\n";
-	trigger << "\t\tNOT = { \n";
-	trigger << "\t\t\thas_country_flag = crisis_in_progress\n";
-	trigger << "\t\t}\n";
-	trigger << "\t\tNOT = { # Don't fire stability events if the country is not mobilising at all\n";
-	trigger << "\t\t\tOR = {\n";
-	trigger << "\t\t\t\thas_idea = disarmed_nation\n";
-	trigger << "\t\t\t\thas_idea = volunteer_only\n";
-	trigger << "\t\t\t}\n";
-	trigger << "\t\t\tOR = {\n";
-	trigger << "\t\t\t\thas_idea = undisturbed_isolation\n";
-	trigger << "\t\t\t\thas_idea = isolation\n";
-	trigger << "\t\t\t\thas_idea = civilian_economy\n";
-	trigger << "\t\t\t}\n";
-	trigger << "\t\t}\n";
-	trigger << "\t}";
-	lowStabilitySelector->second.giveTrigger(trigger.str());
+	ScriptWriter eventScript(1);
+	eventScript.open()
+		 .set("has_war", "yes")
+		 .set("has_civil_war", "no")
+		 .open("OR")
+		 .line("has_stability < 0.5")
+		 .line("has_war_support < 0.5")
+		 .close()
+		 .open("NOT")
+		 .open("AND")
+		 .set("is_major", "yes")
+		 .open("all_enemy_country")
+		 .set("is_major", "no")
+		 .close()
+		 .close()
+		 .close()
+		 .open("NOT")
+		 .set("has_country_flag", "crisis_in_progress")
+		 .close()
+		 .line("# Don't fire stability events if the country is not mobilising at all")
+		 .open("NOT")
+		 .open("OR")
+		 .set("has_idea", "disarmed_nation")
+		 .set("has_idea", "volunteer_only")
+		 .close()
+		 .open("OR")
+		 .set("has_idea", "undisturbed_isolation")
+		 .set("has_idea", "isolation")
+		 .set("has_idea", "civilian_economy")
+		 .close()
+		 .close()
+		 .close();
+	lowStabilitySelector->second.giveTrigger(eventScript.finish());
 	if (!majorIdeologies.contains("democratic"))
 	{
-		std::string mtth = "= {\n";
-		mtth += "\t\tdays = 360\n";
-		mtth += "\t\tmodifier = {\n";
-		mtth += "\t\t\tfactor = 0.75\n";
-		mtth += "\t\t\tOR = {\n";
-		mtth += "\t\t\t\thas_stability < 0.4\n";
-		mtth += "\t\t\t\thas_war_support < 0.4\n";
-		mtth += "\t\t\t}\n";
-		mtth += "\t\t}\n";
-		mtth += "\t\tmodifier = {\n";
-		mtth += "\t\t\tfactor = 0.75\n";
-		mtth += "\t\t\tOR = {\n";
-		mtth += "\t\t\t\thas_stability < 0.2\n";
-		mtth += "\t\t\t\thas_war_support < 0.2\n";
-		mtth += "\t\t\t}\n";
-		mtth += "\t\t}\n";
-		mtth += "\t}";
-		lowStabilitySelector->second.giveMeanTimeToHappen(std::move(mtth));
+		eventScript.open().set("days", 360);
+		for (const auto* threshold: {"0.4", "0.2"})
+		{
+			eventScript.open("modifier")
+				 .set("factor", "0.75")
+				 .open("OR")
+				 .line("has_stability < ", threshold)
+				 .line("has_war_support < ", threshold)
+				 .close()
+				 .close();
+		}
+		eventScript.close();
+		lowStabilitySelector->second.giveMeanTimeToHappen(eventScript.finish());
 	}
 
 	auto conscriptionRebellion = stabilityEvents.find("stability.33");
 	conscriptionRebellion->second.clearOptions();
 	EventOption option;
 	option.giveName("stability.33.a");
-	std::string startExtremistCivilWar = "if = {\n";
-	if (majorIdeologies.contains("democratic"))
-	{
-		startExtremistCivilWar += "\t\t\tlimit = { has_government = democratic }\n";
-	}
-	else
+	ScriptWriter optionScript(2);
+	optionScript.open("if").line(
+		 "limit = { has_government = ", majorIdeologies.contains("democratic") ? "democratic" : "neutrality", " }");
+	for (const auto* extremistIdeology: {"communism", "radical", "fascism", "absolutist"})
 	{
-		startExtremistCivilWar += "\t\t\tlimit = { has_government = neutrality }\n";
-	}
-	if (majorIdeologies.contains("communism"))
-	{
-		startExtremistCivilWar += "\t\t\tstart_civil_war = { ideology = communism size = 0.35 }\n";
-	}
-	else if (majorIdeologies.contains("radical"))
-	{
-		startExtremistCivilWar += "\t\t\tstart_civil_war = { ideology = radical size = 0.35 }\n";
-	}
-	else if (majorIdeologies.contains("fascism"))
-	{
-		startExtremistCivilWar += "\t\t\tstart_civil_war = { ideology = fascism size = 0.35 }\n";
-	}
-	else if (majorIdeologies.contains("absolutist"))
-	{
-		startExtremistCivilWar += "\t\t\tstart_civil_war = { ideology = absolutist size = 0.35 }\n";
+		if (majorIdeologies.contains(extremistIdeology))
+		{
+			optionScript.line("start_civil_war = { ideology = ", extremistIdeology, " size = 0.35 }");
+			break;
+		}
 	}
-	startExtremistCivilWar += "\t\t}";
-	option.giveScriptBlock(std::move(startExtremistCivilWar));
+	optionScript.close();
+	option.giveScriptBlock(optionScript.finish());
 	if (majorIdeologies.contains("democratic"))
 	{
-		std::string startDemocraticCivilWar = "if = {\n";
-		startDemocraticCivilWar += "\t\t\tlimit = {\n";
-		startDemocraticCivilWar += "\t\t\t\tOR = {\n";
+		optionScript.open("if").open("limit").open("OR");
 		for (const auto& majorIdeology: majorIdeologies)
 		{
 			if ((majorIdeology == "democratic") || (majorIdeology == "neutrality"))
@@ -1435,13 +1285,10 @@ void HoI4::Events::createStabilityEvents(const std::set<std::string>& majorIdeol
 				continue;
 			}
 
-			startDemocraticCivilWar += "\t\t\t\t\thas_government = " + majorIdeology + "\n";
+			optionScript.set("has_government", majorIdeology);
 		}
-		startDemocraticCivilWar += "\t\t\t\t}\n";
-		startDemocraticCivilWar += "\t\t\t}\n";
-		startDemocraticCivilWar += "\t\t\tstart_civil_war = { ideology = democratic size = 0.45 }\n";
-		startDemocraticCivilWar += "\t\t}\n";
-		option.giveScriptBlock(std::move(startDemocraticCivilWar));
+		optionScript.close().close().line("start_civil_war = { ideology = democratic size = 0.45 }").close();
+		option.giveScriptBlock(optionScript.finish());
 	}
 	option.giveScriptBlock("clr_country_flag = crisis_in_progress");
 	option.giveScriptBlock("clr_country_flag = crisis_solution_in_progress");
@@ -1,6 +1,23 @@
 #include "Event.h"
 #include "EventOption.h"
 #include "GenericEventUpdaters.h"
+#include "HOI4World/ScriptWriter.h"
+#include <array>
+#include <utility>
+
+
+
+namespace
+{
+
+// the text shown by generic.2 when both countries have the ideology
+constexpr std::array<std::pair<const char*, const char*>, 5> sameIdeologyDescriptions{{{"democratic", "generic.2.d.a"},
+	 {"fascism", "generic.2.d.b"},
+	 {"communism", "generic.2.d.c"},
+	 {"radical", "generic.2.d.f"},
+	 {"absolutist", "generic.2.d.g"}}};
+
+} // namespace
 
 
 
@@ -24,103 +41,43 @@ void HoI4::updateGenericEventTwo(Event& eventTwo, const std::set<std::string>& m
 {
 	eventTwo.clearDescriptions();
 
-	if (majorIdeologies.contains("democratic"))
-	{
-		std::string description = "= {\n";
-		description += "\t\ttext = generic.2.d.a\n";
-		description += "\t\ttrigger = {\n";
-		description += "\t\t\tAND = {\n";
-		description += "\t\t\t\tFROM = {\n";
-		description += "\t\t\t\t\thas_government = democratic\n";
-		description += "\t\t\t\t}\n";
-		description += "\t\t\t\thas_government = democratic\n";
-		description += "\t\t\t}\n";
-		description += "\t\t}\n";
-		description += "\t}";
-		eventTwo.giveDescription(std::move(description));
-	}
-	if (majorIdeologies.contains("fascism"))
-	{
-		std::string description = "= {\n";
-		description += "\t\ttext = generic.2.d.b\n";
-		description += "\t\ttrigger = {\n";
-		description += "\t\t\tAND = {\n";
-		description += "\t\t\t\tFROM = {\n";
-		description += "\t\t\t\t\thas_government = fascism\n";
-		description += "\t\t\t\t}\n";
-		description += "\t\t\t\thas_government = fascism\n";
-		description += "\t\t\t}\n";
-		description += "\t\t}\n";
-		description += "\t}";
-		eventTwo.giveDescription(std::move(description));
-	}
-	if (majorIdeologies.contains("communism"))
-	{
-		std::string description = "= {\n";
-		description += "\t\ttext = generic.2.d.c\n";
-		description += "\t\ttrigger = {\n";
-		description += "\t\t\tAND = {\n";
-		description += "\t\t\t\tFROM = {\n";
-		description += "\t\t\t\t\thas_government = communism\n";
-		description += "\t\t\t\t}\n";
-		description += "\t\t\t\thas_government = communism\n";
-		description += "\t\t\t}\n";
-		description += "\t\t}\n";
-		description += "\t}";
-		eventTwo.giveDescription(std::move(description));
-	}
-	if (majorIdeologies.contains("radical"))
+	ScriptWriter description(1);
+	for (const auto& [ideology, text]: sameIdeologyDescriptions)
 	{
-		std::string description = "= {\n";
-		description += "\t\ttext = generic.2.d.f\n";
-		description += "\t\ttrigger = {\n";
-		description += "\t\t\tAND = {\n";
-		description += "\t\t\t\tFROM = {\n";
-		description += "\t\t\t\t\thas_government = radical\n";
-		description += "\t\t\t\t}\n";
-		description += "\t\t\t\thas_government = radical\n";
-		description += "\t\t\t}\n";
-		description += "\t\t}\n";
-		description += "\t}";
-		eventTwo.giveDescription(std::move(description));
-	}
-	if (majorIdeologies.contains("absolutist"))
-	{
-		std::string description = "= {\n";
-		description += "\t\ttext = generic.2.d.g\n";
-		description += "\t\ttrigger = {\n";
-		description += "\t\t\tAND = {\n";
-		description += "\t\t\t\tFROM = {\n";
-		description += "\t\t\t\t\thas_government = absolutist\n";
-		description += "\t\t\t\t}\n";
-		description += "\t\t\t\thas_government = absolutist\n";
-		description += "\t\t\t}\n";
-		description += "\t\t}\n";
-		description += "\t}";
-		eventTwo.giveDescription(std::move(description));
+		if (!majorIdeologies.contains(ideology))
+		{
+			continue;
+		}
+		description.open()
+			 .set("text", text)
+			 .open("trigger")
+			 .open("AND")
+			 .open("FROM")
+			 .set("has_government", ideology)
+			 .close()
+			 .set("has_government", ideology)
+			 .close()
+			 .close()
+			 .close();
+		eventTwo.giveDescription(description.finish());
 	}
 
-	std::string description = "= {\n";
-	description += "\t\ttext = generic.2.d.e\n";
-	description += "\t\ttrigger = {\n";
-	description += "\t\t\tNOT = {\n";
+	description.open().set("text", "generic.2.d.e").open("trigger").open("NOT");
 	for (const auto& ideology: majorIdeologies)
 	{
 		if (ideology == "neutrality")
 		{
 			continue;
 		}
-		description += "\t\t\t\tAND = {\n";
-		description += "\t\t\t\t\tFROM = {\n";
-		description += "\t\t\t\t\t\thas_government = " + ideology + "\n";
-		description += "\t\t\t\t\t}\n";
-		description += "\t\t\t\t\thas_government = " + ideology + "\n";
-		description += "\t\t\t\t}\n";
+		description.open("AND")
+			 .open("FROM")
+			 .set("has_government", ideology)
+			 .close()
+			 .set("has_government", ideology)
+			 .close();
 	}
-	description += "\t\t\t}\n";
-	description += "\t\t}\n";
-	description += "\t}";
-	eventTwo.giveDescription(std::move(description));
+	description.close().close().close();
+	eventTwo.giveDescription(description.finish());
 
 	eventTwo.clearOptions();
 	if (majorIdeologies.contains("democratic"))
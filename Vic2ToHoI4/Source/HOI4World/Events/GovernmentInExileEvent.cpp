@@ -41,6 +41,7 @@ HoI4::Event HoI4::createGovernmentInExileEvent(const std::set<std::string>& majo
 			 "\n"
 			 "\t\t\t\t\telections_allowed = " +
 			 getElectionsAllowedString(ideology) +
+			 "\n"
 			 "\t\t\t\t}\n"
 			 "\t\t\t}\n"
 			 "\t\t}");
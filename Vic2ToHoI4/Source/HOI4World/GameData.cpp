@@ -0,0 +1,16 @@
+#include "GameData.h"
+#include "Map/HoI4Provinces.h"
+#include "MilitaryMappings/MilitaryMappingsFile.h"
+
+
+
+HoI4::GameData::GameData(const Configuration& theConfiguration):
+	 provinceDefinitions(ProvinceDefinitions::Importer{}.importProvinceDefinitions(theConfiguration)),
+	 theMapData(std::make_unique<MapData>(provinceDefinitions, theConfiguration)),
+	 theProvinces(importProvinces(theConfiguration))
+{
+	theCoastalProvinces.init(*theMapData, theProvinces);
+
+	militaryMappingsFile importedMilitaryMappings;
+	theMilitaryMappings = importedMilitaryMappings.takeAllMilitaryMappings();
+}
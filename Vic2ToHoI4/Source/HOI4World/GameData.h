@@ -0,0 +1,45 @@
+#ifndef HOI4_GAME_DATA_H
+#define HOI4_GAME_DATA_H
+
+
+
+#include "Configuration.h"
+#include "Map/CoastalProvinces.h"
+#include "Map/Hoi4Province.h"
+#include "Map/MapData.h"
+#include "MilitaryMappings/AllMilitaryMappings.h"
+#include "ProvinceDefinitions.h"
+#include <map>
+#include <memory>
+
+
+
+namespace HoI4
+{
+
+// The parts of the HoI4 install and the converter's own mappings that do not depend on the save being converted. They
+// are only read during a conversion, so one instance can serve every save converted with the same configuration.
+class GameData
+{
+  public:
+	explicit GameData(const Configuration& theConfiguration);
+
+	[[nodiscard]] const auto& getProvinceDefinitions() const { return provinceDefinitions; }
+	[[nodiscard]] const auto& getMapData() const { return *theMapData; }
+	[[nodiscard]] const auto& getProvinces() const { return theProvinces; }
+	[[nodiscard]] const auto& getCoastalProvinces() const { return theCoastalProvinces; }
+	[[nodiscard]] const auto& getMilitaryMappings() const { return *theMilitaryMappings; }
+
+  private:
+	ProvinceDefinitions provinceDefinitions;
+	std::unique_ptr<MapData> theMapData;
+	std::map<int, Province> theProvinces;
+	CoastalProvinces theCoastalProvinces;
+	std::unique_ptr<allMilitaryMappings> theMilitaryMappings;
+};
+
+} // namespace HoI4
+
+
+
+#endif // HOI4_GAME_DATA_H
@@ -23,11 +23,9 @@
 
 HoI4::Country::Country(std::string tag,
 	 const Vic2::Country& sourceCountry,
-	 Names& names,
-	 graphicsMapper& theGraphics,
+	 const graphicsMapper& theGraphics,
 	 const CountryMapper& countryMap,
-	 const Mappers::FlagsToIdeasMapper& flagsToIdeasMapper,
-	 Localisation& hoi4Localisations):
+	 const Mappers::FlagsToIdeasMapper& flagsToIdeasMapper):
 	 tag(std::move(tag)),
 	 name(sourceCountry.getName("english")), adjective(sourceCountry.getAdjective("english")),
 	 oldTag(sourceCountry.getTag()), human(human = sourceCountry.isHuman()), threat(sourceCountry.getBadBoy() / 10.0),
@@ -55,15 +53,6 @@ HoI4::Country::Country(std::string tag,
 	{
 		graphicalCulture2d = *possibleGraphicalCulture2d;
 	}
-	communistAdvisorPortrait = theGraphics.getIdeologyMinisterPortrait(primaryCultureGroup, "communism");
-	democraticAdvisorPortrait = theGraphics.getIdeologyMinisterPortrait(primaryCultureGroup, "democratic");
-	neutralityAdvisorPortrait = theGraphics.getIdeologyMinisterPortrait(primaryCultureGroup, "neutrality");
-	absolutistAdvisorPortrait = theGraphics.getIdeologyMinisterPortrait(primaryCultureGroup, "absolutist");
-	radicalAdvisorPortrait = theGraphics.getIdeologyMinisterPortrait(primaryCultureGroup, "radical");
-	fascistAdvisorPortrait = theGraphics.getIdeologyMinisterPortrait(primaryCultureGroup, "fascism");
-
-	initIdeas(names, hoi4Localisations);
-
 	stability = 60;
 	warSupport = 60;
 
@@ -92,11 +81,11 @@ HoI4::Country::Country(std::string tag,
 
 	oldTechnologiesAndInventions = sourceCountry.getTechnologiesAndInventions();
 
+	determineAdvisorPortraits(theGraphics);
 	convertLeaders(theGraphics, sourceCountry);
 	convertRelations(countryMap, sourceCountry);
 	convertStrategies(countryMap, sourceCountry);
 	atWar = sourceCountry.isAtWar();
-	convertWars(sourceCountry, countryMap);
 
 	employedWorkers = sourceCountry.getEmployedWorkers();
 
@@ -106,6 +95,16 @@ HoI4::Country::Country(std::string tag,
 }
 
 
+void HoI4::Country::convertSharedElements(const Vic2::Country& sourceCountry,
+	 Names& names,
+	 const CountryMapper& countryMap,
+	 Localisation& hoi4Localisations)
+{
+	initIdeas(names, hoi4Localisations);
+	convertWars(sourceCountry, countryMap); // logs unmapped participants
+}
+
+
 void HoI4::Country::determineFilename()
 {
 	if (name)
@@ -202,25 +201,40 @@ void HoI4::Country::convertParties(const std::set<std::string>& majorIdeologies,
 }
 
 
+void HoI4::Country::determineAdvisorPortraits(const graphicsMapper& theGraphics)
+{
+	communistAdvisorPortrait = theGraphics.getIdeologyMinisterPortrait(primaryCultureGroup, "communism", tag);
+	democraticAdvisorPortrait = theGraphics.getIdeologyMinisterPortrait(primaryCultureGroup, "democratic", tag);
+	neutralityAdvisorPortrait = theGraphics.getIdeologyMinisterPortrait(primaryCultureGroup, "neutrality", tag);
+	absolutistAdvisorPortrait = theGraphics.getIdeologyMinisterPortrait(primaryCultureGroup, "absolutist", tag);
+	radicalAdvisorPortrait = theGraphics.getIdeologyMinisterPortrait(primaryCultureGroup, "radical", tag);
+	fascistAdvisorPortrait = theGraphics.getIdeologyMinisterPortrait(primaryCultureGroup, "fascism", tag);
+}
+
+
 void HoI4::Country::initIdeas(Names& names, Localisation& hoi4Localisations) const
 {
-	hoi4Localisations.addIdeaLocalisation(tag + "_tank_manufacturer", names.takeCarCompanyName(primaryCulture));
-	hoi4Localisations.addIdeaLocalisation(tag + "_motorized_equipment_manufacturer",
-		 names.takeCarCompanyName(primaryCulture));
-	hoi4Localisations.addIdeaLocalisation(tag + "_infantry_equipment_manufacturer",
-		 names.takeWeaponCompanyName(primaryCulture));
-	hoi4Localisations.addIdeaLocalisation(tag + "_artillery_manufacturer", names.takeWeaponCompanyName(primaryCulture));
-	hoi4Localisations.addIdeaLocalisation(tag + "_light_aircraft_manufacturer",
-		 names.takeAircraftCompanyName(primaryCulture));
-	hoi4Localisations.addIdeaLocalisation(tag + "_medium_aircraft_manufacturer",
-		 names.takeAircraftCompanyName(primaryCulture));
-	hoi4Localisations.addIdeaLocalisation(tag + "_heavy_aircraft_manufacturer",
-		 names.takeAircraftCompanyName(primaryCulture));
-	hoi4Localisations.addIdeaLocalisation(tag + "_naval_aircraft_manufacturer",
-		 names.takeAircraftCompanyName(primaryCulture));
-	hoi4Localisations.addIdeaLocalisation(tag + "_naval_manufacturer", names.takeNavalCompanyName(primaryCulture));
-	hoi4Localisations.addIdeaLocalisation(tag + "_industrial_concern", names.takeIndustryCompanyName(primaryCulture));
-	hoi4Localisations.addIdeaLocalisation(tag + "_electronics_concern", names.takeElectronicCompanyName(primaryCulture));
+	for (const auto& idea: {"_tank_manufacturer", "_motorized_equipment_manufacturer"})
+	{
+		hoi4Localisations.addIdeaLocalisation(tag + idea, names.takeCarCompanyName(primaryCulture, tag + idea));
+	}
+	for (const auto& idea: {"_infantry_equipment_manufacturer", "_artillery_manufacturer"})
+	{
+		hoi4Localisations.addIdeaLocalisation(tag + idea, names.takeWeaponCompanyName(primaryCulture, tag + idea));
+	}
+	for (const auto& idea: {"_light_aircraft_manufacturer",
+			  "_medium_aircraft_manufacturer",
+			  "_heavy_aircraft_manufacturer",
+			  "_naval_aircraft_manufacturer"})
+	{
+		hoi4Localisations.addIdeaLocalisation(tag + idea, names.takeAircraftCompanyName(primaryCulture, tag + idea));
+	}
+	hoi4Localisations.addIdeaLocalisation(tag + "_naval_manufacturer",
+		 names.takeNavalCompanyName(primaryCulture, tag + "_naval_manufacturer"));
+	hoi4Localisations.addIdeaLocalisation(tag + "_industrial_concern",
+		 names.takeIndustryCompanyName(primaryCulture, tag + "_industrial_concern"));
+	hoi4Localisations.addIdeaLocalisation(tag + "_electronics_concern",
+		 names.takeElectronicCompanyName(primaryCulture, tag + "_electronics_concern"));
 }
 
 
@@ -592,7 +606,7 @@ void HoI4::Country::setGovernmentToExistingIdeology(const std::set<std::string>&
 }
 
 
-void HoI4::Country::createLeader(Names& names, graphicsMapper& theGraphics)
+void HoI4::Country::createLeader(const Names& names, const graphicsMapper& theGraphics)
 {
 	for (const auto& configuredLeader: leaders)
 	{
@@ -606,6 +620,7 @@ void HoI4::Country::createLeader(Names& names, graphicsMapper& theGraphics)
 		 primaryCultureGroup,
 		 governmentIdeology,
 		 leaderIdeology,
+		 tag,
 		 names,
 		 theGraphics));
 }
@@ -664,34 +679,16 @@ void HoI4::Country::determineShipVariants(const PossibleShipVariants& possibleVa
 
 void HoI4::Country::convertNavies(const UnitMappings& unitMap,
 	 const MtgUnitMappings& mtgUnitMap,
-	 const std::map<int, int>& provinceToStateIDMap,
-	 const std::map<int, State>& allStates,
-	 const ProvinceDefinitions& provinceDefinitions,
+	 const NavalLocations& navalLocations,
 	 const Mappers::ProvinceMapper& provinceMapper)
 {
-	auto backupNavalLocation = 0;
-	for (const auto& state: allStates)
-	{
-		if (state.second.getOwner() == tag)
-		{
-			auto mainNavalLocation = state.second.getMainNavalLocation();
-			if (mainNavalLocation)
-			{
-				// Mapped ships will be placed in a single large fleet
-				backupNavalLocation = *mainNavalLocation;
-			}
-		}
-	}
-
 	theNavies = std::make_unique<Navies>(oldArmies,
-		 backupNavalLocation,
+		 navalLocations.getBackupNavalLocation(tag),
 		 unitMap,
 		 mtgUnitMap,
 		 *theShipVariants,
-		 provinceToStateIDMap,
-		 allStates,
+		 navalLocations,
 		 tag,
-		 provinceDefinitions,
 		 provinceMapper);
 
 	navyNames.addLegacyShipTypeNames(LegacyShipTypeNames{"submarine", "Submarine", getShipNames("frigate")});
@@ -902,13 +899,11 @@ void HoI4::Country::calculateIndustry(const std::map<int, State>& allStates)
 }
 
 
-void HoI4::Country::addGenericFocusTree(const std::set<std::string>& majorIdeologies)
+void HoI4::Country::addGenericFocusTree(const HoI4FocusTree& genericFocusTree)
 {
 	if (!nationalFocus)
 	{
-		HoI4FocusTree genericNationalFocus(*this);
-		genericNationalFocus.addGenericFocusTree(majorIdeologies);
-		nationalFocus = genericNationalFocus.makeCustomizedCopy(*this);
+		nationalFocus = genericFocusTree.makeCustomizedCopy(*this);
 	}
 }
 
@@ -970,31 +965,6 @@ bool HoI4::Country::areElectionsAllowed() const
 }
 
 
-std::optional<HoI4::Faction> HoI4::Country::getFaction() const
-{
-	if (faction)
-	{
-		return std::make_optional(*faction);
-	}
-	else
-	{
-		return std::nullopt;
-	}
-}
-
-
-std::optional<HoI4FocusTree> HoI4::Country::getNationalFocus() const
-{
-	if (nationalFocus)
-	{
-		return std::make_optional(*nationalFocus);
-	}
-	else
-	{
-		return std::nullopt;
-	}
-}
-
 // Calculates Influence Factor = Σ Outside Influence - 1.5 * Leader Influence
 double HoI4::Country::calculateInfluenceFactor()
 {
@@ -54,11 +54,9 @@ class Country
   public:
 	explicit Country(std::string tag,
 		 const Vic2::Country& sourceCountry,
-		 Names& names,
-		 graphicsMapper& theGraphics,
+		 const graphicsMapper& theGraphics,
 		 const CountryMapper& countryMap,
-		 const Mappers::FlagsToIdeasMapper& flagsToIdeasMapper,
-		 Localisation& hoi4Localisations);
+		 const Mappers::FlagsToIdeasMapper& flagsToIdeasMapper);
 	Country() = delete;
 	Country(const Country&) = delete;
 	Country& operator=(const Country&) = delete;
@@ -66,6 +64,12 @@ class Country
 	Country& operator=(Country&&) = delete;
 	~Country() = default;
 
+	// The constructor only reads shared data, so countries can be built concurrently. Everything that takes from or
+	// writes to state shared between countries happens here instead, and must be done one country at a time.
+	void convertSharedElements(const Vic2::Country& sourceCountry,
+		 Names& names,
+		 const CountryMapper& countryMap,
+		 Localisation& hoi4Localisations);
 	void determineCapitalFromVic2(const Mappers::ProvinceMapper& theProvinceMapper,
 		 const std::map<int, int>& provinceToStateIDMap,
 		 const std::map<int, State>& allStates);
@@ -74,7 +78,7 @@ class Country
 		 const Ideologies& ideologies,
 		 const governmentMapper& governmentMap,
 		 bool debug);
-	void createLeader(Names& names, graphicsMapper& theGraphics);
+	void createLeader(const Names& names, const graphicsMapper& theGraphics);
 	void convertGovernment(const Vic2::World& sourceWorld,
 		 const governmentMapper& governmentMap,
 		 const Vic2::Localisations& vic2Localisations,
@@ -88,9 +92,7 @@ class Country
 	void determineShipVariants(const PossibleShipVariants& possibleVariants);
 	void convertNavies(const UnitMappings& unitMap,
 		 const MtgUnitMappings& mtgUnitMap,
-		 const std::map<int, int>& provinceToStateIDMap,
-		 const std::map<int, State>& allStates,
-		 const ProvinceDefinitions& provinceDefinitions,
+		 const NavalLocations& navalLocations,
 		 const Mappers::ProvinceMapper& provinceMapper);
 	void convertConvoys(const UnitMappings& unitMap);
 	void convertAirForce(const UnitMappings& unitMap);
@@ -102,7 +104,7 @@ class Country
 	void addState(const State& state);
 	void addCoreState(const int stateId) { coreStates.insert(stateId); }
 	void calculateIndustry(const std::map<int, State>& allStates);
-	void addGenericFocusTree(const std::set<std::string>& majorIdeologies);
+	void addGenericFocusTree(const HoI4FocusTree& genericFocusTree);
 	void adjustResearchFocuses() const;
 
 	void setSphereLeader(const std::string& SphereLeader) { sphereLeader = SphereLeader; }
@@ -118,8 +120,8 @@ class Country
 	[[nodiscard]] float getNavalStrength() const;
 	[[nodiscard]] double getEconomicStrength(const double& years) const;
 	[[nodiscard]] bool areElectionsAllowed() const;
-	[[nodiscard]] std::optional<Faction> getFaction() const;
-	[[nodiscard]] std::optional<HoI4FocusTree> getNationalFocus() const;
+	[[nodiscard]] const std::shared_ptr<const Faction>& getFaction() const { return faction; }
+	[[nodiscard]] const std::unique_ptr<HoI4FocusTree>& getNationalFocus() const { return nationalFocus; }
 
 	[[nodiscard]] const std::string& getTag() const { return tag; }
 	[[nodiscard]] const auto& getOldTag() const { return oldTag; }
@@ -225,6 +227,7 @@ class Country
 
   private:
 	void determineFilename();
+	void determineAdvisorPortraits(const graphicsMapper& theGraphics);
 	void initIdeas(Names& names, Localisation& hoi4Localisations) const;
 	void convertLaws();
 	void convertLeaders(const graphicsMapper& theGraphics, const Vic2::Country& sourceCountry);
@@ -2,7 +2,42 @@
 #include "CommonRegexes.h"
 #include "HoI4Localisation.h"
 #include "ParserHelpers.h"
-#include <regex>
+
+
+
+namespace
+{
+
+// Appends country to every focus referenced in a block such as "= { focus = a focus = b }". There can be several
+// focuses in one block, so each " focus = " is followed to the end of its id, all in a single pass.
+std::string customizeFocusReferences(std::string_view block, std::string_view country)
+{
+	constexpr std::string_view focusKey = " focus = ";
+
+	std::string customized;
+	customized.reserve(block.size() + 4 * country.size());
+
+	size_t position = 0;
+	for (auto focusPosition = block.find(focusKey); focusPosition != std::string_view::npos;
+		  focusPosition = block.find(focusKey, position))
+	{
+		const auto idStart = focusPosition + focusKey.size();
+		auto idEnd = block.find_first_of(" }", idStart);
+		if (idEnd == std::string_view::npos)
+		{
+			idEnd = block.size();
+		}
+
+		customized += block.substr(position, idEnd - position);
+		customized += country;
+		position = idEnd;
+	}
+	customized += block.substr(position);
+
+	return customized;
+}
+
+} // namespace
 
 
 
@@ -100,13 +135,13 @@ std::shared_ptr<HoI4Focus> HoI4Focus::makeCustomizedCopy(const std::string& coun
 	}
 	if (newFocus->mutuallyExclusive != "")
 	{
-		customizeMutualExclusion(newFocus, country);
+		newFocus->mutuallyExclusive = customizeFocusReferences(mutuallyExclusive, country);
 	}
 
 	newFocus->prerequisites.clear();
-	for (auto prerequisite: prerequisites)
+	for (const auto& prerequisite: prerequisites)
 	{
-		customizePrerequisite(newFocus, prerequisite, country);
+		newFocus->prerequisites.push_back(customizeFocusReferences(prerequisite, country));
 	}
 
 	return newFocus;
@@ -131,80 +166,14 @@ std::shared_ptr<HoI4Focus> HoI4Focus::makeTargetedCopy(const std::string& countr
 	}
 	if (newFocus->mutuallyExclusive != "")
 	{
-		customizeMutualExclusion(newFocus, country);
+		newFocus->mutuallyExclusive = customizeFocusReferences(mutuallyExclusive, country);
 	}
 
 	newFocus->prerequisites.clear();
-	for (auto prerequisite: prerequisites)
+	for (const auto& prerequisite: prerequisites)
 	{
-		customizePrerequisite(newFocus, prerequisite, country);
+		newFocus->prerequisites.push_back(customizeFocusReferences(prerequisite, country));
 	}
 
 	return newFocus;
-}
-
-
-void HoI4Focus::customizeMutualExclusion(std::shared_ptr<HoI4Focus> newFocus, const std::string& country) const
-{
-	// have to account for several foci in one mututal exclusion, so need to look for occurences of " focus" and insert
-	// country before that
-	std::string::size_type stringPosition = 0;
-	do
-	{
-		auto& mutuallyExclusive = newFocus->mutuallyExclusive;
-		auto focusPosition = mutuallyExclusive.find(" focus = ", stringPosition);
-		if (focusPosition != std::string::npos)
-		{
-			auto spacePosition = mutuallyExclusive.find(" ", focusPosition + static_cast<size_t>(9));
-			if (spacePosition == std::string::npos)
-			{
-				spacePosition = mutuallyExclusive.find("}", focusPosition + static_cast<size_t>(9));
-			}
-			mutuallyExclusive.insert(spacePosition, country);
-			stringPosition = focusPosition + country.size() + static_cast<size_t>(9);
-		}
-		else
-		{
-			stringPosition = mutuallyExclusive.size();
-		}
-	} while (stringPosition < newFocus->mutuallyExclusive.size());
-}
-
-
-void HoI4Focus::customizePrerequisite(std::shared_ptr<HoI4Focus> newFocus,
-	 std::string& prerequisite,
-	 const std::string& country) const
-{
-	// have to account for several foci in one prerequisite, so need to look for occurences of " focus" and insert
-	// country before that
-	size_t stringPosition = 0;
-	do
-	{
-		auto focusPosition = prerequisite.find(" focus = ", stringPosition);
-		if (focusPosition != std::string::npos)
-		{
-			auto spacePosition = prerequisite.find(' ', focusPosition + static_cast<size_t>(9));
-			prerequisite.insert(spacePosition, country);
-			stringPosition = focusPosition + country.size() + static_cast<size_t>(9);
-		}
-		else
-		{
-			stringPosition = prerequisite.size();
-		}
-	} while (stringPosition < prerequisite.size());
-	newFocus->prerequisites.push_back(prerequisite);
-}
-
-void HoI4Focus::updateFocusElement(std::string& element, std::string_view oldText, std::string_view newText)
-{
-	while (element.find(oldText) != std::string::npos)
-	{
-		element.replace(element.find(oldText), oldText.size(), newText);
-	}
-}
-
-void HoI4Focus::removePlaceholder(std::string& element, const std::string& placeholder)
-{
-	std::regex placeholderLine("\n.*" + placeholder);
-	element = std::regex_replace(element, placeholderLine, "");
 }
\ No newline at end of file
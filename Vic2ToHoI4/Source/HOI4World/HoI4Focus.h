@@ -24,8 +24,6 @@ class HoI4Focus: commonItems::parser
 		 const std::string& target,
 		 HoI4::Localisation& localisation) const;
 
-	void updateFocusElement(std::string& element, std::string_view oldText, std::string_view newText);
-	void removePlaceholder(std::string& element, const std::string& placeholder);
 	std::string id;
 	std::string icon;
 	std::string text;
@@ -47,11 +45,6 @@ class HoI4Focus: commonItems::parser
 
   private:
 	HoI4Focus& operator=(const HoI4Focus&) = delete;
-
-	void customizeMutualExclusion(std::shared_ptr<HoI4Focus> newFocus, const std::string& country) const;
-	void customizePrerequisite(std::shared_ptr<HoI4Focus> newFocus,
-		 std::string& prerequisite,
-		 const std::string& country) const;
 };
 
 
@@ -5,7 +5,9 @@
 #include "HoI4World.h"
 #include "Log.h"
 #include "ParserHelpers.h"
+#include "ScriptTemplate.h"
 #include "SharedFocus.h"
+#include "States/Geography.h"
 #include "V2World/Countries/Country.h"
 #include "V2World/Politics/Party.h"
 using namespace std;
@@ -13,7 +15,150 @@ using namespace std;
 
 
 // this is used to cache focuses that can be just loaded from a file
-static std::map<std::string, HoI4Focus> loadedFocuses;
+static std::unordered_map<std::string, HoI4Focus> loadedFocuses;
+
+// the placeholders used in the scripts of the loaded focuses
+static const std::vector<std::string> focusPlaceholders{"#COMMUNISM",
+	 "#FASCISM",
+	 "#RADICAL",
+	 "#FASCPOP",
+	 "#FASCGOV",
+	 "$TARGET",
+	 "$TAG",
+	 "$AICHANCE",
+	 "$STARTDATE",
+	 "$REVANCHISM",
+	 "$POPULARITY",
+	 "$WARSUPPORT",
+	 "$STABILITY",
+	 "var:neighbor_war_defender",
+	 "var:ROOT.neighbor_war_defender"};
+
+// the scripts that branches customize, compiled alongside each loaded focus and keyed by its id
+typedef struct CompiledFocusScripts
+{
+	HoI4::ScriptTemplate available;
+	HoI4::ScriptTemplate aiWillDo;
+	HoI4::ScriptTemplate selectEffect;
+	HoI4::ScriptTemplate completionReward;
+	HoI4::ScriptTemplate bypass;
+} CompiledFocusScripts;
+static std::unordered_map<std::string, CompiledFocusScripts> compiledFocusScripts;
+
+
+
+namespace
+{
+
+void loadFocus(HoI4Focus&& newFocus)
+{
+	if (loadedFocuses.contains(newFocus.id))
+	{
+		return;
+	}
+
+	compiledFocusScripts.emplace(newFocus.id,
+		 CompiledFocusScripts{HoI4::ScriptTemplate(newFocus.available, focusPlaceholders),
+			  HoI4::ScriptTemplate(newFocus.aiWillDo, focusPlaceholders),
+			  HoI4::ScriptTemplate(newFocus.selectEffect, focusPlaceholders),
+			  HoI4::ScriptTemplate(newFocus.completionReward, focusPlaceholders),
+			  HoI4::ScriptTemplate(newFocus.bypass, focusPlaceholders)});
+	loadedFocuses.emplace(newFocus.id, std::move(newFocus));
+}
+
+
+std::string createTargetEligibility(const std::string& ideology, const std::string& targetTrigger)
+{
+	std::string eligibility = "if = {\n";
+	eligibility += "\t\t\t\t\t\tlimit = { ROOT = { has_government = " + ideology + " } }\n";
+	eligibility += "\t\t\t\t\t\t" + targetTrigger + " = yes\n";
+	eligibility += "\t\t\t\t\t}";
+	return eligibility;
+}
+
+
+// fills the ideology placeholders of a border disputes focus, removing the lines of ideologies that are not major
+HoI4::ScriptTemplate::Bindings createTargetEligibilityBindings(const std::set<std::string>& majorIdeologies)
+{
+	HoI4::ScriptTemplate::Bindings bindings{{"#COMMUNISM", std::nullopt},
+		 {"#FASCISM", std::nullopt},
+		 {"#RADICAL", std::nullopt}};
+	if (majorIdeologies.contains("communism"))
+	{
+		bindings["#COMMUNISM"] = createTargetEligibility("communism", "potential_communist_puppet_target");
+	}
+	if (majorIdeologies.contains("fascism"))
+	{
+		bindings["#FASCISM"] = createTargetEligibility("fascism", "potential_fascist_annex_target");
+	}
+	if (majorIdeologies.contains("radical"))
+	{
+		bindings["#RADICAL"] = createTargetEligibility("radical", "potential_radical_annex_target");
+	}
+	return bindings;
+}
+
+
+// fills the ideology placeholders of the shared border disputes effect, removing the lines of ideologies that are not
+// major
+HoI4::ScriptTemplate::Bindings createTargetSelectionBindings(const std::set<std::string>& majorIdeologies)
+{
+	HoI4::ScriptTemplate::Bindings bindings{{"#COMMUNISM", std::nullopt},
+		 {"#FASCISM", std::nullopt},
+		 {"#RADICAL", std::nullopt}};
+	if (majorIdeologies.contains("communism"))
+	{
+		bindings["#COMMUNISM"] = "potential_communist_puppet_target = yes";
+	}
+	if (majorIdeologies.contains("fascism"))
+	{
+		bindings["#FASCISM"] = "potential_fascist_annex_target = yes";
+	}
+	if (majorIdeologies.contains("radical"))
+	{
+		bindings["#RADICAL"] = "potential_radical_annex_target = yes";
+	}
+	return bindings;
+}
+
+
+std::string createWarDeclaration(const std::string& targetTrigger, const std::string& wargoal, const std::string& target)
+{
+	std::string declaration = "else_if = {\n";
+	declaration += "\t\t\t\tlimit = { " + target + " = { " + targetTrigger + " = yes } }\n";
+	declaration += "\t\t\t\tdeclare_war_on = {\n";
+	declaration += "\t\t\t\t\ttarget = " + target + "\n";
+	declaration += "\t\t\t\t\ttype = " + wargoal + "\n";
+	declaration += "\t\t\t\t}\n";
+	declaration += "\t\t\t\tadd_named_threat = { threat = 3 name = neighbor_war_NF_threat }\n";
+	declaration += "\t\t\t}";
+	return declaration;
+}
+
+
+// fills the ideology placeholders of a neighbor war focus, removing the lines of ideologies that are not major
+HoI4::ScriptTemplate::Bindings createWarDeclarationBindings(const std::set<std::string>& majorIdeologies,
+	 const std::string& target)
+{
+	HoI4::ScriptTemplate::Bindings bindings{{"#COMMUNISM", std::nullopt},
+		 {"#FASCISM", std::nullopt},
+		 {"#RADICAL", std::nullopt}};
+	if (majorIdeologies.contains("communism"))
+	{
+		bindings["#COMMUNISM"] = createWarDeclaration("potential_communist_puppet_target", "puppet_wargoal_focus", target);
+	}
+	if (majorIdeologies.contains("fascism"))
+	{
+		bindings["#FASCISM"] = createWarDeclaration("potential_fascist_annex_target", "annex_everything", target);
+	}
+	if (majorIdeologies.contains("radical"))
+	{
+		bindings["#RADICAL"] = createWarDeclaration("potential_radical_annex_target", "annex_everything", target);
+	}
+	return bindings;
+}
+
+} // namespace
 
 
 
@@ -280,52 +425,10 @@ void HoI4FocusTree::addGenericFocusTree(const set<string>& majorIdeologies)
 
 	if (const auto& originalFocus = loadedFocuses.find("border_disputes_shared"); originalFocus != loadedFocuses.end())
 	{
+		const auto& compiledScripts = compiledFocusScripts.at(originalFocus->first);
 		auto newFocus = make_shared<HoI4::SharedFocus>(originalFocus->second);
-		if (majorIdeologies.contains("communism"))
-		{
-			std::string comm;
-			comm = "if = {\n";
-			comm += "\t\t\t\t\t\tlimit = { ROOT = { has_government = communism } }\n";
-			comm += "\t\t\t\t\t\tpotential_communist_puppet_target = yes\n";
-			comm += "\t\t\t\t\t}";
-			newFocus->updateFocusElement(newFocus->available, "#COMMUNISM", comm);
-			newFocus->updateFocusElement(newFocus->selectEffect, "#COMMUNISM", "potential_communist_puppet_target = yes");
-		}
-		else
-		{
-			newFocus->removePlaceholder(newFocus->available, "#COMMUNISM");
-			newFocus->removePlaceholder(newFocus->selectEffect, "#COMMUNISM");
-		}
-		if (majorIdeologies.contains("fascism"))
-		{
-			std::string fasc;
-			fasc = "if = {\n";
-			fasc += "\t\t\t\t\t\tlimit = { ROOT = { has_government = fascism } }\n";
-			fasc += "\t\t\t\t\t\tpotential_fascist_annex_target = yes\n";
-			fasc += "\t\t\t\t\t}";
-			newFocus->updateFocusElement(newFocus->available, "#FASCISM", fasc);
-			newFocus->updateFocusElement(newFocus->selectEffect, "#FASCISM", "potential_fascist_annex_target = yes");
-		}
-		else
-		{
-			newFocus->removePlaceholder(newFocus->available, "#FASCISM");
-			newFocus->removePlaceholder(newFocus->selectEffect, "#FASCISM");
-		}
-		if (majorIdeologies.contains("radical"))
-		{
-			std::string rad;
-			rad = "if = {\n";
-			rad += "\t\t\t\t\t\tlimit = { ROOT = { has_government = radical } }\n";
-			rad += "\t\t\t\t\t\tpotential_radical_annex_target = yes\n";
-			rad += "\t\t\t\t\t}";
-			newFocus->updateFocusElement(newFocus->available, "#RADICAL", rad);
-			newFocus->updateFocusElement(newFocus->selectEffect, "#RADICAL", "potential_radical_annex_target = yes");
-		}
-		else
-		{
-			newFocus->removePlaceholder(newFocus->available, "#RADICAL");
-			newFocus->removePlaceholder(newFocus->selectEffect, "#RADICAL");
-		}
+		newFocus->available = compiledScripts.available.render(createTargetEligibilityBindings(majorIdeologies));
+		newFocus->selectEffect = compiledScripts.selectEffect.render(createTargetSelectionBindings(majorIdeologies));
 		sharedFocuses.push_back(newFocus);
 	}
 	else
@@ -345,58 +448,10 @@ void HoI4FocusTree::addGenericFocusTree(const set<string>& majorIdeologies)
 
 	if (const auto& originalFocus = loadedFocuses.find("neighbor_war_shared"); originalFocus != loadedFocuses.end())
 	{
+		const auto& compiledScripts = compiledFocusScripts.at(originalFocus->first);
 		auto newFocus = make_shared<HoI4::SharedFocus>(originalFocus->second);
-		if (majorIdeologies.contains("communism"))
-		{
-			std::string comm;
-			comm = "else_if = {\n";
-			comm += "\t\t\t\tlimit = { var:neighbor_war_defender = { potential_communist_puppet_target = yes } }\n";
-			comm += "\t\t\t\tdeclare_war_on = {\n";
-			comm += "\t\t\t\t\ttarget = var:neighbor_war_defender\n";
-			comm += "\t\t\t\t\ttype = puppet_wargoal_focus\n";
-			comm += "\t\t\t\t}\n";
-			comm += "\t\t\t\tadd_named_threat = { threat = 3 name = neighbor_war_NF_threat }\n";
-			comm += "\t\t\t}";
-			newFocus->updateFocusElement(newFocus->completionReward, "#COMMUNISM", comm);
-		}
-		else
-		{
-			newFocus->removePlaceholder(newFocus->completionReward, "#COMMUNISM");
-		}
-		if (majorIdeologies.contains("fascism"))
-		{
-			std::string fasc;
-			fasc = "else_if = {\n";
-			fasc += "\t\t\t\tlimit = { var:neighbor_war_defender = { potential_fascist_annex_target = yes } }\n";
-			fasc += "\t\t\t\tdeclare_war_on = {\n";
-			fasc += "\t\t\t\t\ttarget = var:neighbor_war_defender\n";
-			fasc += "\t\t\t\t\ttype = annex_everything\n";
-			fasc += "\t\t\t\t}\n";
-			fasc += "\t\t\t\tadd_named_threat = { threat = 3 name = neighbor_war_NF_threat }\n";
-			fasc += "\t\t\t}";
-			newFocus->updateFocusElement(newFocus->completionReward, "#FASCISM", fasc);
-		}
-		else
-		{
-			newFocus->removePlaceholder(newFocus->completionReward, "#FASCISM");
-		}
-		if (majorIdeologies.contains("radical"))
-		{
-			std::string rad;
-			rad = "else_if = {\n";
-			rad += "\t\t\t\tlimit = { var:neighbor_war_defender = { potential_radical_annex_target = yes } }\n";
-			rad += "\t\t\t\tdeclare_war_on = {\n";
-			rad += "\t\t\t\t\ttarget = var:neighbor_war_defender\n";
-			rad += "\t\t\t\t\ttype = annex_everything\n";
-			rad += "\t\t\t\t}\n";
-			rad += "\t\t\t\tadd_named_threat = { threat = 3 name = neighbor_war_NF_threat }\n";
-			rad += "\t\t\t}";
-			newFocus->updateFocusElement(newFocus->completionReward, "#RADICAL", rad);
-		}
-		else
-		{
-			newFocus->removePlaceholder(newFocus->completionReward, "#RADICAL");
-		}
+		newFocus->completionReward = compiledScripts.completionReward.render(
+			 createWarDeclarationBindings(majorIdeologies, "var:neighbor_war_defender"));
 		sharedFocuses.push_back(newFocus);
 	}
 	else
@@ -418,13 +473,11 @@ void HoI4FocusTree::confirmLoadedFocuses()
 		registerKeyword("country", commonItems::ignoreObject);
 		registerKeyword("default", commonItems::ignoreString);
 		registerKeyword("reset_on_civilwar", commonItems::ignoreString);
-		registerKeyword("focus", [this](std::istream& theStream) {
-			HoI4Focus newFocus(theStream);
-			loadedFocuses.insert(make_pair(newFocus.id, newFocus));
+		registerKeyword("focus", [](std::istream& theStream) {
+			loadFocus(HoI4Focus(theStream));
 		});
-		registerKeyword("shared_focus", [this](std::istream& theStream) {
-			HoI4Focus newFocus(theStream);
-			loadedFocuses.insert(make_pair(newFocus.id, newFocus));
+		registerKeyword("shared_focus", [](std::istream& theStream) {
+			loadFocus(HoI4Focus(theStream));
 		});
 
 		parseFile("Configurables/converterFocuses.txt");
@@ -728,11 +781,19 @@ std::unique_ptr<HoI4FocusTree> HoI4FocusTree::makeCustomizedCopy(const HoI4::Cou
 {
 	HoI4FocusTree newFocusTree(country);
 
-	for (auto focus: focuses)
+	newFocusTree.genericFocuses = genericFocuses;
+	for (const auto& focus: focuses)
+	{
+		if (focus)
+		{
+			newFocusTree.genericFocuses.push_back(focus);
+		}
+	}
+	for (size_t slot = 0; slot < newFocusTree.genericFocuses.size(); ++slot)
 	{
-		auto newFocus = focus->makeCustomizedCopy(newFocusTree.dstCountryTag);
-		newFocusTree.addFocus(newFocus);
+		newFocusTree.genericFocusSlots.emplace(newFocusTree.genericFocuses[slot]->id + newFocusTree.dstCountryTag, slot);
 	}
+	newFocusTree.removedGenericFocuses.resize(newFocusTree.genericFocuses.size(), false);
 	newFocusTree.setNextFreeColumn(nextFreeColumn);
 
 	return std::make_unique<HoI4FocusTree>(std::move(newFocusTree));
@@ -775,7 +836,7 @@ void HoI4FocusTree::addDemocracyNationalFocuses(shared_ptr<HoI4::Country> Home,
 		newFocus->available += "\t\t\tthreat > " + to_string(0.20 * WTModifier / 1000) + "\n";
 		newFocus->available += "\t\t}";
 		newFocus->xPos = nextFreeColumn + static_cast<int>(CountriesToContain.size()) - 1;
-		focuses.push_back(newFocus);
+		addFocus(newFocus);
 	}
 	else
 	{
@@ -788,7 +849,7 @@ void HoI4FocusTree::addDemocracyNationalFocuses(shared_ptr<HoI4::Country> Home,
 		newFocus->available = "= {\n";
 		newFocus->available += "\t\t\tthreat > " + to_string(0.30 * WTModifier / 1000) + "\n";
 		newFocus->available += "\t\t}";
-		focuses.push_back(newFocus);
+		addFocus(newFocus);
 	}
 	else
 	{
@@ -801,7 +862,7 @@ void HoI4FocusTree::addDemocracyNationalFocuses(shared_ptr<HoI4::Country> Home,
 		newFocus->available = "= {\n";
 		newFocus->available += "\t\t\tthreat > " + to_string(0.50 * WTModifier / 1000) + "\n";
 		newFocus->available += "\t\t}";
-		focuses.push_back(newFocus);
+		addFocus(newFocus);
 	}
 	else
 	{
@@ -842,7 +903,7 @@ void HoI4FocusTree::addDemocracyNationalFocuses(shared_ptr<HoI4::Country> Home,
 			newFocus->available += "\t\t\t\t}\n";
 			newFocus->available += "\t\t\t}\n";
 			newFocus->available += "\t\t}";
-			focuses.push_back(newFocus);
+			addFocus(newFocus);
 		}
 		else
 		{
@@ -877,7 +938,7 @@ void HoI4FocusTree::addDemocracyNationalFocuses(shared_ptr<HoI4::Country> Home,
 				 "\t\t\t\tadd_opinion_modifier = { target = " + Home->getTag() + " modifier = embargo }\n";
 			newFocus->completionReward += "\t\t\t}\n";
 			newFocus->completionReward += "\t\t}";
-			focuses.push_back(newFocus);
+			addFocus(newFocus);
 		}
 		else
 		{
@@ -916,7 +977,7 @@ void HoI4FocusTree::addDemocracyNationalFocuses(shared_ptr<HoI4::Country> Home,
 			newFocus->completionReward += "\t\t\t\ttarget = " + country->getTag() + "\n";
 			newFocus->completionReward += "\t\t\t}\n";
 			newFocus->completionReward += "\t\t}";
-			focuses.push_back(newFocus);
+			addFocus(newFocus);
 
 			relativePos += 2;
 		}
@@ -950,7 +1011,7 @@ void HoI4FocusTree::addAbsolutistEmpireNationalFocuses(shared_ptr<HoI4::Country>
 		auto newFocus = originalFocus->second.makeCustomizedCopy(Home->getTag());
 		newFocus->xPos = nextFreeColumn + 5;
 		newFocus->yPos = 0;
-		focuses.push_back(newFocus);
+		addFocus(newFocus);
 	}
 	else
 	{
@@ -963,7 +1024,7 @@ void HoI4FocusTree::addAbsolutistEmpireNationalFocuses(shared_ptr<HoI4::Country>
 		newFocus->relativePositionId = "EmpireGlory" + Home->getTag();
 		newFocus->xPos = -1;
 		newFocus->yPos = 1;
-		focuses.push_back(newFocus);
+		addFocus(newFocus);
 	}
 	else
 	{
@@ -976,7 +1037,7 @@ void HoI4FocusTree::addAbsolutistEmpireNationalFocuses(shared_ptr<HoI4::Country>
 		newFocus->relativePositionId = "EmpireGlory" + Home->getTag();
 		newFocus->xPos = 1;
 		newFocus->yPos = 1;
-		focuses.push_back(newFocus);
+		addFocus(newFocus);
 	}
 	else
 	{
@@ -989,7 +1050,7 @@ void HoI4FocusTree::addAbsolutistEmpireNationalFocuses(shared_ptr<HoI4::Country>
 		newFocus->relativePositionId = "StrengthenColonies" + Home->getTag();
 		newFocus->xPos = -2;
 		newFocus->yPos = 1;
-		focuses.push_back(newFocus);
+		addFocus(newFocus);
 	}
 	else
 	{
@@ -1002,7 +1063,7 @@ void HoI4FocusTree::addAbsolutistEmpireNationalFocuses(shared_ptr<HoI4::Country>
 		newFocus->relativePositionId = "ColonialInd" + Home->getTag();
 		newFocus->xPos = -2;
 		newFocus->yPos = 1;
-		focuses.push_back(newFocus);
+		addFocus(newFocus);
 	}
 	else
 	{
@@ -1015,7 +1076,7 @@ void HoI4FocusTree::addAbsolutistEmpireNationalFocuses(shared_ptr<HoI4::Country>
 		newFocus->relativePositionId = "ColonialInd" + Home->getTag();
 		newFocus->xPos = 0;
 		newFocus->yPos = 1;
-		focuses.push_back(newFocus);
+		addFocus(newFocus);
 	}
 	else
 	{
@@ -1031,7 +1092,7 @@ void HoI4FocusTree::addAbsolutistEmpireNationalFocuses(shared_ptr<HoI4::Country>
 		newFocus->completionReward = "= {\n";
 		newFocus->completionReward += "\t\tadd_ideas = militarism_focus_absolutist\n";
 		newFocus->completionReward += "}\n";
-		focuses.push_back(newFocus);
+		addFocus(newFocus);
 	}
 	else
 	{
@@ -1088,7 +1149,7 @@ void HoI4FocusTree::addAbsolutistEmpireNationalFocuses(shared_ptr<HoI4::Country>
 			newFocus->completionReward += "\t\t\t\ttarget = " + target->getTag() + "\n";
 			newFocus->completionReward += "\t\t\t}\n";
 			newFocus->completionReward += "\t\t}";
-			focuses.push_back(newFocus);
+			addFocus(newFocus);
 		}
 		else
 		{
@@ -1145,7 +1206,7 @@ void HoI4FocusTree::addAbsolutistEmpireNationalFocuses(shared_ptr<HoI4::Country>
 			newFocus->completionReward += "\t\t\t\ttarget = " + target->getTag() + "\n";
 			newFocus->completionReward += "\t\t\t}\n";
 			newFocus->completionReward += "\t\t}";
-			focuses.push_back(newFocus);
+			addFocus(newFocus);
 		}
 		else
 		{
@@ -1159,7 +1220,7 @@ void HoI4FocusTree::addAbsolutistEmpireNationalFocuses(shared_ptr<HoI4::Country>
 		newFocus->relativePositionId = "ColonialInd" + Home->getTag();
 		newFocus->xPos = -1;
 		newFocus->yPos = 2;
-		focuses.push_back(newFocus);
+		addFocus(newFocus);
 	}
 	else
 	{
@@ -1172,7 +1233,7 @@ void HoI4FocusTree::addAbsolutistEmpireNationalFocuses(shared_ptr<HoI4::Country>
 		newFocus->relativePositionId = "StrengthenHome" + Home->getTag();
 		newFocus->xPos = 1;
 		newFocus->yPos = 1;
-		focuses.push_back(newFocus);
+		addFocus(newFocus);
 	}
 	else
 	{
@@ -1185,7 +1246,7 @@ void HoI4FocusTree::addAbsolutistEmpireNationalFocuses(shared_ptr<HoI4::Country>
 		newFocus->relativePositionId = "IndHome" + Home->getTag();
 		newFocus->xPos = -1;
 		newFocus->yPos = 1;
-		focuses.push_back(newFocus);
+		addFocus(newFocus);
 	}
 	else
 	{
@@ -1198,7 +1259,7 @@ void HoI4FocusTree::addAbsolutistEmpireNationalFocuses(shared_ptr<HoI4::Country>
 		newFocus->relativePositionId = "IndHome" + Home->getTag();
 		newFocus->xPos = 1;
 		newFocus->yPos = 1;
-		focuses.push_back(newFocus);
+		addFocus(newFocus);
 	}
 	else
 	{
@@ -1211,7 +1272,7 @@ void HoI4FocusTree::addAbsolutistEmpireNationalFocuses(shared_ptr<HoI4::Country>
 		newFocus->relativePositionId = "IndHome" + Home->getTag();
 		newFocus->xPos = 2;
 		newFocus->yPos = 2;
-		focuses.push_back(newFocus);
+		addFocus(newFocus);
 	}
 	else
 	{
@@ -1224,7 +1285,7 @@ void HoI4FocusTree::addAbsolutistEmpireNationalFocuses(shared_ptr<HoI4::Country>
 		newFocus->relativePositionId = "StrengthenHome" + Home->getTag();
 		newFocus->xPos = 4;
 		newFocus->yPos = 1;
-		focuses.push_back(newFocus);
+		addFocus(newFocus);
 	}
 	else
 	{
@@ -1237,7 +1298,7 @@ void HoI4FocusTree::addAbsolutistEmpireNationalFocuses(shared_ptr<HoI4::Country>
 		newFocus->relativePositionId = "PrepTheBorder" + Home->getTag();
 		newFocus->xPos = 0;
 		newFocus->yPos = 1;
-		focuses.push_back(newFocus);
+		addFocus(newFocus);
 	}
 	else
 	{
@@ -1294,7 +1355,7 @@ void HoI4FocusTree::addAbsolutistEmpireNationalFocuses(shared_ptr<HoI4::Country>
 			newFocus->completionReward += "\t\t\t\ttarget = " + target->getTag() + "\n";
 			newFocus->completionReward += "\t\t\t}\n";
 			newFocus->completionReward += "\t\t}";
-			focuses.push_back(newFocus);
+			addFocus(newFocus);
 		}
 		else
 		{
@@ -1350,7 +1411,7 @@ void HoI4FocusTree::addAbsolutistEmpireNationalFocuses(shared_ptr<HoI4::Country>
 			newFocus->completionReward += "\t\t\t\ttarget = " + target->getTag() + "\n";
 			newFocus->completionReward += "\t\t\t}\n";
 			newFocus->completionReward += "\t\t}";
-			focuses.push_back(newFocus);
+			addFocus(newFocus);
 		}
 		else
 		{
@@ -1371,7 +1432,7 @@ void HoI4FocusTree::addCommunistCoupBranch(shared_ptr<HoI4::Country> Home,
 			shared_ptr<HoI4Focus> newFocus = originalFocus->second.makeCustomizedCopy(Home->getTag());
 			newFocus->xPos = nextFreeColumn + static_cast<int>(coupTargets.size()) - 1;
 			newFocus->yPos = 0;
-			focuses.push_back(newFocus);
+			addFocus(newFocus);
 		}
 		else
 		{
@@ -1461,7 +1522,7 @@ void HoI4FocusTree::addCommunistCoupBranch(shared_ptr<HoI4::Country> Home,
 					newFocus->completionReward += "\t\t\t\tcountry_event = { id = generic.1 }\n";
 					newFocus->completionReward += "\t\t\t}\n";
 					newFocus->completionReward += "\t\t}";
-					focuses.push_back(newFocus);
+					addFocus(newFocus);
 				}
 				else
 				{
@@ -1489,7 +1550,7 @@ void HoI4FocusTree::addCommunistCoupBranch(shared_ptr<HoI4::Country> Home,
 					newFocus->completionReward += "\t\t\t\t}\n";
 					newFocus->completionReward += "\t\t\t}\n";
 					newFocus->completionReward += "\t\t}";
-					focuses.push_back(newFocus);
+					addFocus(newFocus);
 				}
 				else
 				{
@@ -1515,7 +1576,7 @@ void HoI4FocusTree::addCommunistWarBranch(shared_ptr<HoI4::Country> Home,
 			shared_ptr<HoI4Focus> newFocus = originalFocus->second.makeCustomizedCopy(Home->getTag());
 			newFocus->xPos = nextFreeColumn + static_cast<int>(warTargets.size()) - 1;
 			newFocus->yPos = 0;
-			focuses.push_back(newFocus);
+			addFocus(newFocus);
 		}
 		else
 		{
@@ -1534,7 +1595,7 @@ void HoI4FocusTree::addCommunistWarBranch(shared_ptr<HoI4::Country> Home,
 			newFocus->completionReward += "\t\t}";
 			// FIXME
 			// maybe add some claims?
-			focuses.push_back(newFocus);
+			addFocus(newFocus);
 		}
 		else
 		{
@@ -1603,7 +1664,7 @@ void HoI4FocusTree::addCommunistWarBranch(shared_ptr<HoI4::Country> Home,
 					newFocus->completionReward += "\t\t\t\ttarget = " + warTargets[i]->getTag() + "\n";
 					newFocus->completionReward += "\t\t\t}\n";
 					newFocus->completionReward += "\t\t}";
-					focuses.push_back(newFocus);
+					addFocus(newFocus);
 				}
 				else
 				{
@@ -1646,7 +1707,7 @@ void HoI4FocusTree::addFascistAnnexationBranch(shared_ptr<HoI4::Country> Home,
 		newFocus->completionReward += "\t\t\tadd_named_threat = { threat = 2 name = " + newFocus->text + " }\n";
 		newFocus->completionReward += "\t\t\tadd_ideas = fascist_influence\n";
 		newFocus->completionReward += "\t\t}";
-		focuses.push_back(newFocus);
+		addFocus(newFocus);
 	}
 	else
 	{
@@ -1659,7 +1720,7 @@ void HoI4FocusTree::addFascistAnnexationBranch(shared_ptr<HoI4::Country> Home,
 		newFocus->relativePositionId = "The_third_way" + Home->getTag();
 		newFocus->xPos = 0;
 		newFocus->yPos = 1;
-		focuses.push_back(newFocus);
+		addFocus(newFocus);
 	}
 	else
 	{
@@ -1713,7 +1774,7 @@ void HoI4FocusTree::addFascistAnnexationBranch(shared_ptr<HoI4::Country> Home,
 			newFocus->completionReward += "\t\t\t\t}\n";
 			newFocus->completionReward += "\t\t\t}\n";
 			newFocus->completionReward += "\t\t}";
-			focuses.push_back(newFocus);
+			addFocus(newFocus);
 
 			events.createAnnexEvent(*Home, *annexationTargets[i]);
 		}
@@ -1898,7 +1959,7 @@ void HoI4FocusTree::addGPWarBranch(shared_ptr<HoI4::Country> Home,
 				 "\t\t\tadd_named_threat = { threat = 3 name = \"Call for the " + ideology + " Summit\" }\n";
 			newFocus->completionReward += "\t\t\tadd_political_power = 150\n";
 			newFocus->completionReward += "\t\t}";
-			focuses.push_back(newFocus);
+			addFocus(newFocus);
 			hoi4Localisations.copyFocusLocalisations("_Summit", newFocus->text);
 			hoi4Localisations.updateLocalisationText(newFocus->text, "$TARGET", ideology);
 			hoi4Localisations.updateLocalisationText(newFocus->text + "_desc", "$TARGET", ideology);
@@ -1955,7 +2016,7 @@ void HoI4FocusTree::addGPWarBranch(shared_ptr<HoI4::Country> Home,
 				 "\t\t\t\tadd_opinion_modifier = { target = " + Home->getTag() + " modifier = positive_50 }\n";
 			newFocus->completionReward += "\t\t\t}\n";
 			newFocus->completionReward += "\t\t}";
-			focuses.push_back(newFocus);
+			addFocus(newFocus);
 
 			events.createFactionEvents(*Home, *newAlly);
 			i++;
@@ -2049,7 +2110,7 @@ void HoI4FocusTree::addGPWarBranch(shared_ptr<HoI4::Country> Home,
 			newFocus->completionReward += "\t\t\t\ttarget = " + GC->getTag() + "\n";
 			newFocus->completionReward += "\t\t\t}\n";
 			newFocus->completionReward += "\t\t}";
-			focuses.push_back(newFocus);
+			addFocus(newFocus);
 			hoi4Localisations.copyFocusLocalisations("GPWar", newFocus->text);
 			hoi4Localisations.updateLocalisationText(newFocus->text, "$TARGET", GC->getTag());
 			hoi4Localisations.updateLocalisationText(newFocus->text + "_desc", "$TARGET", GC->getTag());
@@ -2064,29 +2125,20 @@ void HoI4FocusTree::addGPWarBranch(shared_ptr<HoI4::Country> Home,
 }
 
 std::map<std::string, int> HoI4FocusTree::determineEnemyCoreHolders(std::shared_ptr<HoI4::Country> theCountry,
-	 const std::map<int, HoI4::State>& states
+	 const HoI4::Geography& geography
 ){
 	std::map<std::string, int> coreHolders;
 
-	for (const auto& stateID: theCountry->getCoreStates())
+	for (const auto stateID: geography.getCoredStates(theCountry->getTag()))
 	{
-		const auto& stateItr = states.find(stateID);
-		if (stateItr == states.end())
+		const auto owner = geography.getOwnerOfState(stateID);
+		if (!owner || *owner == theCountry->getTag())
 		{
 			continue;
 		}
-		const auto& state = stateItr->second;
-		if (const auto& owner = state.getOwner(); owner != theCountry->getTag())
+		if (std::string ownerTag(*owner); theCountry->isEligibleEnemy(ownerTag))
 		{
-			if (theCountry->isEligibleEnemy(owner))
-			{
-				int numProvinces = std::min(static_cast<int>(state.getProvinces().size()), 10);
-				const auto& [existing, inserted] = coreHolders.insert(make_pair(owner, numProvinces));
-				if (!inserted)
-				{
-				  existing->second += numProvinces;
-				}
-			}
+			coreHolders[ownerTag] += std::min(geography.getNumProvincesInState(stateID), 10);
 		}
 	}
 
@@ -2094,11 +2146,11 @@ std::map<std::string, int> HoI4FocusTree::determineEnemyCoreHolders(std::shared_
 }
 
 int HoI4FocusTree::calculateNumEnemyOwnedCores(std::shared_ptr<HoI4::Country> theCountry,
-	 const std::map<int, HoI4::State>& states
+	 const HoI4::Geography& geography
 ){
 	int sumUnownedCores = 0;
 
-	for (const auto& [unused, numCores]: determineEnemyCoreHolders(theCountry, states))
+	for (const auto& [unused, numCores]: determineEnemyCoreHolders(theCountry, geography))
 	{
 		sumUnownedCores += numCores;
 	}
@@ -2110,16 +2162,16 @@ int HoI4FocusTree::calculateNumEnemyOwnedCores(std::shared_ptr<HoI4::Country> th
 std::map<std::string, int> HoI4FocusTree::addReconquestBranch(std::shared_ptr<HoI4::Country> theCountry,
 	 int& numWarsWithNeighbors,
 	 const std::set<std::string>& majorIdeologies,
-	 const std::map<int, HoI4::State>& states,
+	 const HoI4::Geography& geography,
 	 HoI4::Localisation& hoi4Localisations)
 {
-	const auto& coreHolders = determineEnemyCoreHolders(theCountry, states);
+	const auto& coreHolders = determineEnemyCoreHolders(theCountry, geography);
 	if (coreHolders.empty())
 	{
 		return coreHolders;
 	}
 
-	int sumUnownedCores = calculateNumEnemyOwnedCores(theCountry, states);
+	int sumUnownedCores = calculateNumEnemyOwnedCores(theCountry, geography);
 
 	numWarsWithNeighbors = std::min(static_cast<int>(coreHolders.size()), 4);
 
@@ -2140,7 +2192,7 @@ std::map<std::string, int> HoI4FocusTree::addReconquestBranch(std::shared_ptr<Ho
 		}
 		newFocus->selectEffect += "\t\t}\n";
 		newFocus->xPos = nextFreeColumn + static_cast<int>(coreHolders.size()) - 1;
-		focuses.push_back(newFocus);
+		addFocus(newFocus);
 	}
 	else
 	{
@@ -2155,10 +2207,25 @@ std::map<std::string, int> HoI4FocusTree::addReconquestBranch(std::shared_ptr<Ho
 
 	for (const auto& [target, numProvinces]: coreHolders)
 	{
-		const auto& aiChance = std::to_string(std::max(static_cast<int>(0.1 * numProvinces), 1));
+		const auto warSupport = std::to_string(0.00001 * numProvinces);
+
+		// filled in once per target, with the values that differ between its focuses updated before each focus
+		HoI4::ScriptTemplate::Bindings bindings{{"$TARGET", target},
+			 {"$TAG", theCountry->getTag()},
+			 {"$REVANCHISM", std::to_string(std::max(static_cast<int>(0.1 * numProvinces), 1))},
+			 {"$POPULARITY", std::to_string(0.000001 * numProvinces)},
+			 {"$WARSUPPORT", warSupport},
+			 {"$STABILITY", std::to_string(0.0000005 * numProvinces)},
+			 {"#FASCGOV", std::nullopt},
+			 {"#FASCPOP", std::nullopt}};
+		if (majorIdeologies.contains("fascism"))
+		{
+			bindings["#FASCGOV"] = fascistGovernmentCheck;
+		}
 
 		if (const auto& originalFocus = loadedFocuses.find("raise_matter"); originalFocus != loadedFocuses.end())
 		{
+			const auto& compiledScripts = compiledFocusScripts.at(originalFocus->first);
 			shared_ptr<HoI4Focus> newFocus =
 				 originalFocus->second.makeTargetedCopy(theCountry->getTag(), target, hoi4Localisations);
 			newFocus->xPos = nextFreeColumn;
@@ -2170,8 +2237,8 @@ std::map<std::string, int> HoI4FocusTree::addReconquestBranch(std::shared_ptr<Ho
 				fascismPopularityCheck += "\t\t\t\tNOT = { has_government = fascism }\n";
 				fascismPopularityCheck += "\t\t\t\tNOT = { fascism > 0.35 }\n";
 				fascismPopularityCheck += "\t\t\t}";
-				newFocus->updateFocusElement(newFocus->aiWillDo, "#FASCPOP", fascismPopularityCheck);
-				newFocus->updateFocusElement(newFocus->aiWillDo, "#FASCGOV", fascistGovernmentCheck);
+				bindings["#FASCPOP"] = fascismPopularityCheck;
+				newFocus->completionReward = compiledScripts.completionReward.render(bindings);
 			}
 			else
 			{
@@ -2180,15 +2247,11 @@ std::map<std::string, int> HoI4FocusTree::addReconquestBranch(std::shared_ptr<Ho
 				newFocus->completionReward += "\t\t\tadd_political_power = 150\n";
 				newFocus->completionReward += "\t\t\tadd_timed_idea = { idea = generic_military_industry days = 180 }\n";
 				newFocus->completionReward += "\t\t}";
-				newFocus->removePlaceholder(newFocus->aiWillDo, "#FASCPOP");
-				newFocus->removePlaceholder(newFocus->aiWillDo, "#FASCGOV");
 			}
-			newFocus->updateFocusElement(newFocus->available, "$TARGET", target);
-			newFocus->updateFocusElement(newFocus->completionReward, "$POPULARITY", std::to_string(0.000001*numProvinces));
-			newFocus->updateFocusElement(newFocus->bypass, "$TARGET", target);
-			newFocus->updateFocusElement(newFocus->aiWillDo, "$TARGET", target);
-			newFocus->updateFocusElement(newFocus->aiWillDo, "$REVANCHISM", aiChance);
-			focuses.push_back(newFocus);
+			newFocus->available = compiledScripts.available.render(bindings);
+			newFocus->bypass = compiledScripts.bypass.render(bindings);
+			newFocus->aiWillDo = compiledScripts.aiWillDo.render(bindings);
+			addFocus(newFocus);
 			nextFreeColumn += 2;
 		}
 		else
@@ -2198,6 +2261,7 @@ std::map<std::string, int> HoI4FocusTree::addReconquestBranch(std::shared_ptr<Ho
 
 		if (const auto& originalFocus = loadedFocuses.find("build_public_support"); originalFocus != loadedFocuses.end())
 		{
+			const auto& compiledScripts = compiledFocusScripts.at(originalFocus->first);
 			shared_ptr<HoI4Focus> newFocus =
 				 originalFocus->second.makeTargetedCopy(theCountry->getTag(), target, hoi4Localisations);
 			newFocus->prerequisites.clear();
@@ -2211,27 +2275,21 @@ std::map<std::string, int> HoI4FocusTree::addReconquestBranch(std::shared_ptr<Ho
 				fascismPopularityCheck += "\t\t\t\tNOT = { has_government = fascism }\n";
 				fascismPopularityCheck += "\t\t\t\tNOT = { fascism > 0.4 }\n";
 				fascismPopularityCheck += "\t\t\t}";
-				newFocus->updateFocusElement(newFocus->aiWillDo, "#FASCPOP", fascismPopularityCheck);
-				newFocus->updateFocusElement(newFocus->aiWillDo, "#FASCGOV", fascistGovernmentCheck);
+				bindings["#FASCPOP"] = fascismPopularityCheck;
+				newFocus->completionReward = compiledScripts.completionReward.render(bindings);
 			}
 			else
 			{
 				newFocus->completionReward = " = {\n";
 				newFocus->completionReward += "\t\t\tadd_stability = 0.0001\n";
-				newFocus->completionReward += "\t\t\tadd_war_support = $WARSUPPORT\n";
+				newFocus->completionReward += "\t\t\tadd_war_support = " + warSupport + "\n";
 				newFocus->completionReward += "\t\t\tadd_timed_idea = { idea = generic_rapid_mobilization days = 180 }\n";
 				newFocus->completionReward += "\t\t}";
-				newFocus->removePlaceholder(newFocus->aiWillDo, "#FASCPOP");
-				newFocus->removePlaceholder(newFocus->aiWillDo, "#FASCGOV");
 			}
-			newFocus->updateFocusElement(newFocus->available, "$TARGET", target);
-			newFocus->updateFocusElement(newFocus->completionReward, "$POPULARITY", std::to_string(0.000001*numProvinces));
-			newFocus->updateFocusElement(newFocus->completionReward, "$WARSUPPORT", std::to_string(0.00001*numProvinces));
-			newFocus->updateFocusElement(newFocus->bypass, "$TARGET", target);
-			newFocus->updateFocusElement(newFocus->aiWillDo, "$TARGET", target);
-			newFocus->updateFocusElement(newFocus->aiWillDo, "$TAG", theCountry->getTag());
-			newFocus->updateFocusElement(newFocus->aiWillDo, "$REVANCHISM", aiChance);
-			focuses.push_back(newFocus);
+			newFocus->available = compiledScripts.available.render(bindings);
+			newFocus->bypass = compiledScripts.bypass.render(bindings);
+			newFocus->aiWillDo = compiledScripts.aiWillDo.render(bindings);
+			addFocus(newFocus);
 		}
 		else
 		{
@@ -2240,26 +2298,17 @@ std::map<std::string, int> HoI4FocusTree::addReconquestBranch(std::shared_ptr<Ho
 
 		if (const auto& originalFocus = loadedFocuses.find("territory_or_war"); originalFocus != loadedFocuses.end())
 		{
+			const auto& compiledScripts = compiledFocusScripts.at(originalFocus->first);
 			shared_ptr<HoI4Focus> newFocus =
 				 originalFocus->second.makeTargetedCopy(theCountry->getTag(), target, hoi4Localisations);
 			newFocus->prerequisites.clear();
 			newFocus->prerequisites.push_back("= { focus = build_public_support" + theCountry->getTag() + target + " }");
 			newFocus->relativePositionId += target;
-			if (majorIdeologies.contains("fascism"))
-			{
-				newFocus->updateFocusElement(newFocus->aiWillDo, "#FASCGOV", fascistGovernmentCheck);
-			}
-			else
-			{
-				newFocus->removePlaceholder(newFocus->aiWillDo, "#FASCGOV");
-			}
-			newFocus->updateFocusElement(newFocus->available, "$TARGET", target);
-			newFocus->updateFocusElement(newFocus->completionReward, "$TARGET", target);
-			newFocus->updateFocusElement(newFocus->bypass, "$TARGET", target);
-			newFocus->updateFocusElement(newFocus->aiWillDo, "$TARGET", target);
-			newFocus->updateFocusElement(newFocus->aiWillDo, "$TAG", theCountry->getTag());
-			newFocus->updateFocusElement(newFocus->aiWillDo, "$REVANCHISM", aiChance);
-			focuses.push_back(newFocus);
+			newFocus->available = compiledScripts.available.render(bindings);
+			newFocus->completionReward = compiledScripts.completionReward.render(bindings);
+			newFocus->bypass = compiledScripts.bypass.render(bindings);
+			newFocus->aiWillDo = compiledScripts.aiWillDo.render(bindings);
+			addFocus(newFocus);
 		}
 		else
 		{
@@ -2268,26 +2317,17 @@ std::map<std::string, int> HoI4FocusTree::addReconquestBranch(std::shared_ptr<Ho
 
 		if (const auto& originalFocus = loadedFocuses.find("war_plan"); originalFocus != loadedFocuses.end())
 		{
+			const auto& compiledScripts = compiledFocusScripts.at(originalFocus->first);
 			shared_ptr<HoI4Focus> newFocus =
 				 originalFocus->second.makeTargetedCopy(theCountry->getTag(), target, hoi4Localisations);
 			newFocus->prerequisites.clear();
 			newFocus->prerequisites.push_back("= { focus = territory_or_war" + theCountry->getTag() + target + " }");
 			newFocus->relativePositionId += target;
-			if (majorIdeologies.contains("fascism"))
-			{
-				newFocus->updateFocusElement(newFocus->aiWillDo, "#FASCGOV", fascistGovernmentCheck);
-			}
-			else
-			{
-				newFocus->removePlaceholder(newFocus->aiWillDo, "#FASCGOV");
-			}
-			newFocus->updateFocusElement(newFocus->available, "$TARGET", target);
-			newFocus->updateFocusElement(newFocus->completionReward, "$TARGET", target);
-			newFocus->updateFocusElement(newFocus->bypass, "$TARGET", target);
-			newFocus->updateFocusElement(newFocus->aiWillDo, "$TARGET", target);
-			newFocus->updateFocusElement(newFocus->aiWillDo, "$TAG", theCountry->getTag());
-			newFocus->updateFocusElement(newFocus->aiWillDo, "$REVANCHISM", aiChance);
-			focuses.push_back(newFocus);
+			newFocus->available = compiledScripts.available.render(bindings);
+			newFocus->completionReward = compiledScripts.completionReward.render(bindings);
+			newFocus->bypass = compiledScripts.bypass.render(bindings);
+			newFocus->aiWillDo = compiledScripts.aiWillDo.render(bindings);
+			addFocus(newFocus);
 		}
 		else
 		{
@@ -2296,26 +2336,18 @@ std::map<std::string, int> HoI4FocusTree::addReconquestBranch(std::shared_ptr<Ho
 
 		if (const auto& originalFocus = loadedFocuses.find("declare_war"); originalFocus != loadedFocuses.end())
 		{
+			const auto& compiledScripts = compiledFocusScripts.at(originalFocus->first);
 			shared_ptr<HoI4Focus> newFocus =
 				 originalFocus->second.makeTargetedCopy(theCountry->getTag(), target, hoi4Localisations);
 			newFocus->prerequisites.clear();
 			newFocus->prerequisites.push_back("= { focus = war_plan" + theCountry->getTag() + target + " }");
 			newFocus->relativePositionId += target;
-			if (majorIdeologies.contains("fascism"))
-			{
-				newFocus->updateFocusElement(newFocus->aiWillDo, "#FASCGOV", fascistGovernmentCheck);
-			}
-			else
-			{
-				newFocus->removePlaceholder(newFocus->aiWillDo, "#FASCGOV");
-			}
-			newFocus->updateFocusElement(newFocus->available, "$TARGET", target);
-			newFocus->updateFocusElement(newFocus->completionReward, "$TARGET", target);
-			newFocus->updateFocusElement(newFocus->bypass, "$TARGET", target);
-			newFocus->updateFocusElement(newFocus->aiWillDo, "$TARGET", target);
-			newFocus->updateFocusElement(newFocus->aiWillDo, "$TAG", theCountry->getTag());
-			newFocus->updateFocusElement(newFocus->aiWillDo, "$REVANCHISM", std::to_string(std::max(static_cast<int>(numProvinces), 1)));
-			focuses.push_back(newFocus);
+			bindings["$REVANCHISM"] = std::to_string(std::max(static_cast<int>(numProvinces), 1));
+			newFocus->available = compiledScripts.available.render(bindings);
+			newFocus->completionReward = compiledScripts.completionReward.render(bindings);
+			newFocus->bypass = compiledScripts.bypass.render(bindings);
+			newFocus->aiWillDo = compiledScripts.aiWillDo.render(bindings);
+			addFocus(newFocus);
 		}
 		else
 		{
@@ -2324,16 +2356,16 @@ std::map<std::string, int> HoI4FocusTree::addReconquestBranch(std::shared_ptr<Ho
 
 		if (const auto& originalFocus = loadedFocuses.find("cleanup_revanchism"); originalFocus != loadedFocuses.end())
 		{
+			const auto& compiledScripts = compiledFocusScripts.at(originalFocus->first);
 			shared_ptr<HoI4Focus> newFocus =
 				 originalFocus->second.makeTargetedCopy(theCountry->getTag(), target, hoi4Localisations);
 			newFocus->prerequisites.clear();
 			newFocus->prerequisites.push_back("= { focus = declare_war" + theCountry->getTag() + target + " }");
 			newFocus->relativePositionId += target;
-			newFocus->updateFocusElement(newFocus->available, "$TARGET", target);
-			newFocus->updateFocusElement(newFocus->completionReward, "$TARGET", target);
-			newFocus->updateFocusElement(newFocus->completionReward, "$REVANCHISM", std::to_string(0.000005*numProvinces));
-			newFocus->updateFocusElement(newFocus->completionReward, "$STABILITY", std::to_string(0.0000005*numProvinces));
-			focuses.push_back(newFocus);
+			bindings["$REVANCHISM"] = std::to_string(0.000005 * numProvinces);
+			newFocus->available = compiledScripts.available.render(bindings);
+			newFocus->completionReward = compiledScripts.completionReward.render(bindings);
+			addFocus(newFocus);
 		}
 		else
 		{
@@ -2393,54 +2425,18 @@ std::set<std::string> HoI4FocusTree::addConquerBranch(
 
 		if (const auto& originalFocus = loadedFocuses.find("border_disputes_conquer"); originalFocus != loadedFocuses.end())
 		{
+			const auto& compiledScripts = compiledFocusScripts.at(originalFocus->first);
 			shared_ptr<HoI4Focus> newFocus =
 				 originalFocus->second.makeTargetedCopy(tag, strategy.getID(), hoi4Localisations);
 			newFocus->relativePositionId.clear();
-			if (majorIdeologies.contains("communism"))
-			{
-				std::string comm;
-				comm = "if = {\n";
-				comm += "\t\t\t\t\t\tlimit = { ROOT = { has_government = communism } }\n";
-				comm += "\t\t\t\t\t\tpotential_communist_puppet_target = yes\n";
-				comm += "\t\t\t\t\t}";
-				newFocus->updateFocusElement(newFocus->available, "#COMMUNISM", comm);
-			}
-			else
-			{
-				newFocus->removePlaceholder(newFocus->available, "#COMMUNISM");
-			}
-			if (majorIdeologies.contains("fascism"))
-			{
-				std::string fasc;
-				fasc = "if = {\n";
-				fasc += "\t\t\t\t\t\tlimit = { ROOT = { has_government = fascism } }\n";
-				fasc += "\t\t\t\t\t\tpotential_fascist_annex_target = yes\n";
-				fasc += "\t\t\t\t\t}";
-				newFocus->updateFocusElement(newFocus->available, "#FASCISM", fasc);
-			}
-			else
-			{
-				newFocus->removePlaceholder(newFocus->available, "#FASCISM");
-			}
-			if (majorIdeologies.contains("radical"))
-			{
-				std::string rad;
-				rad = "if = {\n";
-				rad += "\t\t\t\t\t\tlimit = { ROOT = { has_government = radical } }\n";
-				rad += "\t\t\t\t\t\tpotential_radical_annex_target = yes\n";
-				rad += "\t\t\t\t\t}";
-				newFocus->updateFocusElement(newFocus->available, "#RADICAL", rad);
-			}
-			else
-			{
-				newFocus->removePlaceholder(newFocus->available, "#RADICAL");
-			}
-			newFocus->updateFocusElement(newFocus->available, "$TARGET", strategy.getID());
+			auto availableBindings = createTargetEligibilityBindings(majorIdeologies);
+			availableBindings.emplace("$TARGET", strategy.getID());
+			newFocus->available = compiledScripts.available.render(availableBindings);
 			newFocus->xPos = nextFreeColumn;
 			newFocus->yPos = 0;
-			newFocus->updateFocusElement(newFocus->aiWillDo, "$AICHANCE", to_string(aiChance));
-			newFocus->updateFocusElement(newFocus->aiWillDo, "$TARGET", strategy.getID());
-			focuses.push_back(newFocus);
+			newFocus->aiWillDo =
+				 compiledScripts.aiWillDo.render({{"$AICHANCE", to_string(aiChance)}, {"$TARGET", strategy.getID()}});
+			addFocus(newFocus);
 		}
 		else
 		{
@@ -2449,18 +2445,21 @@ std::set<std::string> HoI4FocusTree::addConquerBranch(
 
 		if (const auto& originalFocus = loadedFocuses.find("prepare_for_war_conquer"); originalFocus != loadedFocuses.end())
 		{
+			const auto& compiledScripts = compiledFocusScripts.at(originalFocus->first);
 			shared_ptr<HoI4Focus> newFocus =
 				 originalFocus->second.makeTargetedCopy(tag, strategy.getID(), hoi4Localisations);
 			newFocus->prerequisites.clear();
 			newFocus->prerequisites.push_back("= { focus = border_disputes_conquer" + tag + strategy.getID() + " }");
 			newFocus->relativePositionId += strategy.getID();
-			newFocus->updateFocusElement(newFocus->available, "$STARTDATE", startDate.toString());
-			newFocus->updateFocusElement(newFocus->available, "$TARGET", strategy.getID());
-			newFocus->updateFocusElement(newFocus->aiWillDo, "$TARGET", strategy.getID());
-			newFocus->updateFocusElement(newFocus->selectEffect, "var:ROOT.neighbor_war_defender", strategy.getID());
-			newFocus->updateFocusElement(newFocus->completionReward, "var:neighbor_war_defender", strategy.getID());
-			newFocus->updateFocusElement(newFocus->bypass, "var:neighbor_war_defender", strategy.getID());
-			focuses.push_back(newFocus);
+			newFocus->available =
+				 compiledScripts.available.render({{"$STARTDATE", startDate.toString()}, {"$TARGET", strategy.getID()}});
+			newFocus->aiWillDo = compiledScripts.aiWillDo.render({{"$TARGET", strategy.getID()}});
+			newFocus->selectEffect =
+				 compiledScripts.selectEffect.render({{"var:ROOT.neighbor_war_defender", strategy.getID()}});
+			newFocus->completionReward =
+				 compiledScripts.completionReward.render({{"var:neighbor_war_defender", strategy.getID()}});
+			newFocus->bypass = compiledScripts.bypass.render({{"var:neighbor_war_defender", strategy.getID()}});
+			addFocus(newFocus);
 		}
 		else
 		{
@@ -2469,68 +2468,20 @@ std::set<std::string> HoI4FocusTree::addConquerBranch(
 
 		if (const auto& originalFocus = loadedFocuses.find("neighbor_war_conquer"); originalFocus != loadedFocuses.end())
 		{
+			const auto& compiledScripts = compiledFocusScripts.at(originalFocus->first);
 			shared_ptr<HoI4Focus> newFocus =
 				 originalFocus->second.makeTargetedCopy(tag, strategy.getID(), hoi4Localisations);
 			newFocus->prerequisites.clear();
 			newFocus->prerequisites.push_back("= { focus = prepare_for_war_conquer" + tag + strategy.getID() + " }");
 			newFocus->relativePositionId += strategy.getID();
-			newFocus->updateFocusElement(newFocus->available, "var:neighbor_war_defender", strategy.getID());
-			newFocus->updateFocusElement(newFocus->available, "var:ROOT.neighbor_war_defender", strategy.getID());
-			if (majorIdeologies.contains("communism"))
-			{
-				std::string comm;
-				comm = "else_if = {\n";
-				comm += "\t\t\t\tlimit = { var:neighbor_war_defender = { potential_communist_puppet_target = yes } }\n";
-				comm += "\t\t\t\tdeclare_war_on = {\n";
-				comm += "\t\t\t\t\ttarget = var:neighbor_war_defender\n";
-				comm += "\t\t\t\t\ttype = puppet_wargoal_focus\n";
-				comm += "\t\t\t\t}\n";
-				comm += "\t\t\t\tadd_named_threat = { threat = 3 name = neighbor_war_NF_threat }\n";
-				comm += "\t\t\t}";
-				newFocus->updateFocusElement(newFocus->completionReward, "#COMMUNISM", comm);
-			}
-			else
-			{
-				newFocus->removePlaceholder(newFocus->completionReward, "#COMMUNISM");
-			}
-			if (majorIdeologies.contains("fascism"))
-			{
-				std::string fasc;
-				fasc = "else_if = {\n";
-				fasc += "\t\t\t\tlimit = { var:neighbor_war_defender = { potential_fascist_annex_target = yes } }\n";
-				fasc += "\t\t\t\tdeclare_war_on = {\n";
-				fasc += "\t\t\t\t\ttarget = var:neighbor_war_defender\n";
-				fasc += "\t\t\t\t\ttype = annex_everything\n";
-				fasc += "\t\t\t\t}\n";
-				fasc += "\t\t\t\tadd_named_threat = { threat = 3 name = neighbor_war_NF_threat }\n";
-				fasc += "\t\t\t}";
-				newFocus->updateFocusElement(newFocus->completionReward, "#FASCISM", fasc);
-			}
-			else
-			{
-				newFocus->removePlaceholder(newFocus->completionReward, "#FASCISM");
-			}
-			if (majorIdeologies.contains("radical"))
-			{
-				std::string rad;
-				rad = "else_if = {\n";
-				rad += "\t\t\t\tlimit = { var:neighbor_war_defender = { potential_radical_annex_target = yes } }\n";
-				rad += "\t\t\t\tdeclare_war_on = {\n";
-				rad += "\t\t\t\t\ttarget = var:neighbor_war_defender\n";
-				rad += "\t\t\t\t\ttype = annex_everything\n";
-				rad += "\t\t\t\t}\n";
-				rad += "\t\t\t\tadd_named_threat = { threat = 3 name = neighbor_war_NF_threat }\n";
-				rad += "\t\t\t}";
-				newFocus->updateFocusElement(newFocus->completionReward, "#RADICAL", rad);
-			}
-			else
-			{
-				newFocus->removePlaceholder(newFocus->completionReward, "#RADICAL");
-			}
-			newFocus->updateFocusElement(newFocus->completionReward, "var:neighbor_war_defender", strategy.getID());
-			newFocus->updateFocusElement(newFocus->completionReward, "var:ROOT.neighbor_war_defender", strategy.getID());
-			newFocus->updateFocusElement(newFocus->bypass, "var:neighbor_war_defender", strategy.getID());
-			focuses.push_back(newFocus);
+			newFocus->available = compiledScripts.available.render({{"var:neighbor_war_defender", strategy.getID()},
+				 {"var:ROOT.neighbor_war_defender", strategy.getID()}});
+			auto completionRewardBindings = createWarDeclarationBindings(majorIdeologies, strategy.getID());
+			completionRewardBindings.emplace("var:neighbor_war_defender", strategy.getID());
+			completionRewardBindings.emplace("var:ROOT.neighbor_war_defender", strategy.getID());
+			newFocus->completionReward = compiledScripts.completionReward.render(completionRewardBindings);
+			newFocus->bypass = compiledScripts.bypass.render({{"var:neighbor_war_defender", strategy.getID()}});
+			addFocus(newFocus);
 		}
 		else
 		{
@@ -2553,53 +2504,17 @@ void HoI4FocusTree::addNeighborWarBranch(const string& tag,
 {
 	if (const auto& originalFocus = loadedFocuses.find("border_disputes_nw"); originalFocus != loadedFocuses.end())
 	{
+		const auto& compiledScripts = compiledFocusScripts.at(originalFocus->first);
 		shared_ptr<HoI4Focus> newFocus =
 			 originalFocus->second.makeTargetedCopy(tag, targetNeighbors->getTag(), hoi4Localisations);
 		newFocus->relativePositionId.clear();
-		if (majorIdeologies.contains("communism"))
-		{
-			std::string comm;
-			comm = "if = {\n";
-			comm += "\t\t\t\t\t\tlimit = { ROOT = { has_government = communism } }\n";
-			comm += "\t\t\t\t\t\tpotential_communist_puppet_target = yes\n";
-			comm += "\t\t\t\t\t}";
-			newFocus->updateFocusElement(newFocus->available, "#COMMUNISM", comm);
-		}
-		else
-		{
-			newFocus->removePlaceholder(newFocus->available, "#COMMUNISM");
-		}
-		if (majorIdeologies.contains("fascism"))
-		{
-			std::string fasc;
-			fasc = "if = {\n";
-			fasc += "\t\t\t\t\t\tlimit = { ROOT = { has_government = fascism } }\n";
-			fasc += "\t\t\t\t\t\tpotential_fascist_annex_target = yes\n";
-			fasc += "\t\t\t\t\t}";
-			newFocus->updateFocusElement(newFocus->available, "#FASCISM", fasc);
-		}
-		else
-		{
-			newFocus->removePlaceholder(newFocus->available, "#FASCISM");
-		}
-		if (majorIdeologies.contains("radical"))
-		{
-			std::string rad;
-			rad = "if = {\n";
-			rad += "\t\t\t\t\t\tlimit = { ROOT = { has_government = radical } }\n";
-			rad += "\t\t\t\t\t\tpotential_radical_annex_target = yes\n";
-			rad += "\t\t\t\t\t}";
-			newFocus->updateFocusElement(newFocus->available, "#RADICAL", rad);
-		}
-		else
-		{
-			newFocus->removePlaceholder(newFocus->available, "#RADICAL");
-		}
-		newFocus->updateFocusElement(newFocus->available, "$TARGET", targetNeighbors->getTag());
+		auto availableBindings = createTargetEligibilityBindings(majorIdeologies);
+		availableBindings.emplace("$TARGET", targetNeighbors->getTag());
+		newFocus->available = compiledScripts.available.render(availableBindings);
 		newFocus->selectEffect.clear();
 		newFocus->xPos = nextFreeColumn;
 		newFocus->yPos = 0;
-		focuses.push_back(newFocus);
+		addFocus(newFocus);
 	}
 	else
 	{
@@ -2608,16 +2523,19 @@ void HoI4FocusTree::addNeighborWarBranch(const string& tag,
 
 	if (const auto& originalFocus = loadedFocuses.find("prepare_for_war_nw"); originalFocus != loadedFocuses.end())
 	{
+		const auto& compiledScripts = compiledFocusScripts.at(originalFocus->first);
 		shared_ptr<HoI4Focus> newFocus =
 			 originalFocus->second.makeTargetedCopy(tag, targetNeighbors->getTag(), hoi4Localisations);
 		newFocus->prerequisites.clear();
 		newFocus->prerequisites.push_back("= { focus = border_disputes_nw" + tag + targetNeighbors->getTag() + " }");
 		newFocus->relativePositionId += targetNeighbors->getTag();
-		newFocus->updateFocusElement(newFocus->available, "$TARGET", targetNeighbors->getTag());
-		newFocus->updateFocusElement(newFocus->selectEffect, "var:ROOT.neighbor_war_defender", targetNeighbors->getTag());
-		newFocus->updateFocusElement(newFocus->completionReward, "var:neighbor_war_defender", targetNeighbors->getTag());
-		newFocus->updateFocusElement(newFocus->bypass, "var:neighbor_war_defender", targetNeighbors->getTag());
-		focuses.push_back(newFocus);
+		newFocus->available = compiledScripts.available.render({{"$TARGET", targetNeighbors->getTag()}});
+		newFocus->selectEffect =
+			 compiledScripts.selectEffect.render({{"var:ROOT.neighbor_war_defender", targetNeighbors->getTag()}});
+		newFocus->completionReward =
+			 compiledScripts.completionReward.render({{"var:neighbor_war_defender", targetNeighbors->getTag()}});
+		newFocus->bypass = compiledScripts.bypass.render({{"var:neighbor_war_defender", targetNeighbors->getTag()}});
+		addFocus(newFocus);
 	}
 	else
 	{
@@ -2626,70 +2544,20 @@ void HoI4FocusTree::addNeighborWarBranch(const string& tag,
 
 	if (const auto& originalFocus = loadedFocuses.find("neighbor_war_nw"); originalFocus != loadedFocuses.end())
 	{
+		const auto& compiledScripts = compiledFocusScripts.at(originalFocus->first);
 		shared_ptr<HoI4Focus> newFocus =
 			 originalFocus->second.makeTargetedCopy(tag, targetNeighbors->getTag(), hoi4Localisations);
 		newFocus->prerequisites.clear();
 		newFocus->prerequisites.push_back("= { focus = prepare_for_war_nw" + tag + targetNeighbors->getTag() + " }");
 		newFocus->relativePositionId += targetNeighbors->getTag();
-		newFocus->updateFocusElement(newFocus->available, "var:neighbor_war_defender", targetNeighbors->getTag());
-		newFocus->updateFocusElement(newFocus->available, "var:ROOT.neighbor_war_defender", targetNeighbors->getTag());
-		if (majorIdeologies.contains("communism"))
-		{
-			std::string comm;
-			comm = "else_if = {\n";
-			comm += "\t\t\t\tlimit = { var:neighbor_war_defender = { potential_communist_puppet_target = yes } }\n";
-			comm += "\t\t\t\tdeclare_war_on = {\n";
-			comm += "\t\t\t\t\ttarget = var:neighbor_war_defender\n";
-			comm += "\t\t\t\t\ttype = puppet_wargoal_focus\n";
-			comm += "\t\t\t\t}\n";
-			comm += "\t\t\t\tadd_named_threat = { threat = 3 name = neighbor_war_NF_threat }\n";
-			comm += "\t\t\t}";
-			newFocus->updateFocusElement(newFocus->completionReward, "#COMMUNISM", comm);
-		}
-		else
-		{
-			newFocus->removePlaceholder(newFocus->completionReward, "#COMMUNISM");
-		}
-		if (majorIdeologies.contains("fascism"))
-		{
-			std::string fasc;
-			fasc += "else_if = {\n";
-			fasc += "\t\t\t\tlimit = { var:neighbor_war_defender = { potential_fascist_annex_target = yes } }\n";
-			fasc += "\t\t\t\tdeclare_war_on = {\n";
-			fasc += "\t\t\t\t\ttarget = var:neighbor_war_defender\n";
-			fasc += "\t\t\t\t\ttype = annex_everything\n";
-			fasc += "\t\t\t\t}\n";
-			fasc += "\t\t\t\tadd_named_threat = { threat = 3 name = neighbor_war_NF_threat }\n";
-			fasc += "\t\t\t}";
-			newFocus->updateFocusElement(newFocus->completionReward, "#FASCISM", fasc);
-		}
-		else
-		{
-			newFocus->removePlaceholder(newFocus->completionReward, "#FASCISM");
-		}
-		if (majorIdeologies.contains("radical"))
-		{
-			std::string rad;
-			rad += "else_if = {\n";
-			rad += "\t\t\t\tlimit = { var:neighbor_war_defender = { potential_radical_annex_target = yes } }\n";
-			rad += "\t\t\t\tdeclare_war_on = {\n";
-			rad += "\t\t\t\t\ttarget = var:neighbor_war_defender\n";
-			rad += "\t\t\t\t\ttype = annex_everything\n";
-			rad += "\t\t\t\t}\n";
-			rad += "\t\t\t\tadd_named_threat = { threat = 3 name = neighbor_war_NF_threat }\n";
-			rad += "\t\t\t}";
-			newFocus->updateFocusElement(newFocus->completionReward, "#RADICAL", rad);
-		}
-		else
-		{
-			newFocus->removePlaceholder(newFocus->completionReward, "#RADICAL");
-		}
-		newFocus->updateFocusElement(newFocus->completionReward, "var:neighbor_war_defender", targetNeighbors->getTag());
-		newFocus->updateFocusElement(newFocus->completionReward,
-			 "var:ROOT.neighbor_war_defender",
-			 targetNeighbors->getTag());
-		newFocus->updateFocusElement(newFocus->bypass, "var:neighbor_war_defender", targetNeighbors->getTag());
-		focuses.push_back(newFocus);
+		newFocus->available = compiledScripts.available.render({{"var:neighbor_war_defender", targetNeighbors->getTag()},
+			 {"var:ROOT.neighbor_war_defender", targetNeighbors->getTag()}});
+		auto completionRewardBindings = createWarDeclarationBindings(majorIdeologies, targetNeighbors->getTag());
+		completionRewardBindings.emplace("var:neighbor_war_defender", targetNeighbors->getTag());
+		completionRewardBindings.emplace("var:ROOT.neighbor_war_defender", targetNeighbors->getTag());
+		newFocus->completionReward = compiledScripts.completionReward.render(completionRewardBindings);
+		newFocus->bypass = compiledScripts.bypass.render({{"var:neighbor_war_defender", targetNeighbors->getTag()}});
+		addFocus(newFocus);
 	}
 	else
 	{
@@ -2699,12 +2567,50 @@ void HoI4FocusTree::addNeighborWarBranch(const string& tag,
 	nextFreeColumn += 2;
 }
 
+std::vector<std::shared_ptr<HoI4Focus>> HoI4FocusTree::getFocuses() const
+{
+	std::vector<std::shared_ptr<HoI4Focus>> allFocuses;
+	allFocuses.reserve(genericFocuses.size() + focuses.size());
+
+	for (size_t slot = 0; slot < genericFocuses.size(); ++slot)
+	{
+		if (!removedGenericFocuses[slot])
+		{
+			allFocuses.push_back(genericFocuses[slot]->makeCustomizedCopy(dstCountryTag));
+		}
+	}
+	for (const auto& focus: focuses)
+	{
+		if (focus)
+		{
+			allFocuses.push_back(focus);
+		}
+	}
+
+	return allFocuses;
+}
+
+
+void HoI4FocusTree::addFocus(std::shared_ptr<HoI4Focus> newFocus)
+{
+	focusSlots.emplace(newFocus->id, focuses.size());
+	focuses.push_back(std::move(newFocus));
+}
+
+
 void HoI4FocusTree::removeFocus(const string& id)
 {
-	focuses.erase(std::remove_if(focuses.begin(),
-							focuses.end(),
-							[id](std::shared_ptr<HoI4Focus> focus) {
-								return focus->id == id;
-							}),
-		 focuses.end());
+	const auto [firstGeneric, lastGeneric] = genericFocusSlots.equal_range(id);
+	for (auto slot = firstGeneric; slot != lastGeneric; ++slot)
+	{
+		removedGenericFocuses[slot->second] = true;
+	}
+	genericFocusSlots.erase(firstGeneric, lastGeneric);
+
+	const auto [first, last] = focusSlots.equal_range(id);
+	for (auto slot = first; slot != last; ++slot)
+	{
+		focuses[slot->second].reset();
+	}
+	focusSlots.erase(first, last);
 }
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 
@@ -23,6 +24,7 @@ namespace HoI4
 
 class Country;
 class Events;
+class Geography;
 class Localisation;
 class SharedFocus;
 class World;
@@ -82,7 +84,7 @@ class HoI4FocusTree: commonItems::parser
 	std::map<std::string, int> addReconquestBranch(std::shared_ptr<HoI4::Country> theCountry,
 		 int& numWarsWithNeighbors,
 		 const std::set<std::string>& majorIdeologies,
-		 const std::map<int, HoI4::State>& states,
+		 const HoI4::Geography& geography,
 		 HoI4::Localisation& hoi4Localisations
 	);
 	std::set<std::string> addConquerBranch(
@@ -99,15 +101,15 @@ class HoI4FocusTree: commonItems::parser
 		 const std::set<std::string>& majorIdeologies,
 		 HoI4::Localisation& hoi4Localisations);
 	std::map<std::string, int> determineEnemyCoreHolders(std::shared_ptr<HoI4::Country> theCountry,
-		 const std::map<int, HoI4::State>& states);
-	int calculateNumEnemyOwnedCores(std::shared_ptr<HoI4::Country> theCountry,
-		 const std::map<int, HoI4::State>& states);
+		 const HoI4::Geography& geography);
+	int calculateNumEnemyOwnedCores(std::shared_ptr<HoI4::Country> theCountry, const HoI4::Geography& geography);
 	void removeFocus(const std::string& id);
-
-	void addFocus(std::shared_ptr<HoI4Focus> newFocus) { focuses.push_back(newFocus); }
+	void addFocus(std::shared_ptr<HoI4Focus> newFocus);
 
 	[[nodiscard]] const auto& getDestinationCountryTag() const { return dstCountryTag; }
-	[[nodiscard]] const auto& getFocuses() const { return focuses; }
+
+	// customizes the focuses shared with the generic tree, then appends this tree's own focuses
+	[[nodiscard]] std::vector<std::shared_ptr<HoI4Focus>> getFocuses() const;
 	[[nodiscard]] const auto& getSharedFocuses() const { return sharedFocuses; }
 
   private:
@@ -121,7 +123,18 @@ class HoI4FocusTree: commonItems::parser
 	void addRadicalGenericFocuses(int relativePosition);
 
 	std::string dstCountryTag;
+
+	// focuses of the generic tree this one was copied from, shared rather than copied and only customized for
+	// dstCountryTag on output. They are indexed by customized id, and removals are flagged here so the shared focuses
+	// are never touched.
+	std::vector<std::shared_ptr<const HoI4Focus>> genericFocuses;
+	std::unordered_multimap<std::string, size_t> genericFocusSlots;
+	std::vector<bool> removedGenericFocuses;
+
+	// this tree's own focuses in the order they were added, indexed by id. Removed focuses leave an empty slot that
+	// is skipped on output.
 	std::vector<std::shared_ptr<HoI4Focus>> focuses;
+	std::unordered_multimap<std::string, size_t> focusSlots;
 	std::vector<std::shared_ptr<HoI4::SharedFocus>> sharedFocuses;
 	int nextFreeColumn = 0;
 
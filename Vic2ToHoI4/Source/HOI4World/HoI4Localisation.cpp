@@ -4,13 +4,48 @@
 #include "Log.h"
 #include "Mappers/GovernmentMapper.h"
 #include "OSCompatibilityLayer.h"
+#include "ParallelMap.h"
 #include "States/HoI4State.h"
 #include "States/HoI4States.h"
 #include "V2World/Countries/Country.h"
 #include "V2World/Localisations/Vic2Localisations.h"
 #include "V2World/States/State.h"
 #include "V2World/States/StateDefinitions.h"
+#include <algorithm>
 #include <fstream>
+#include <string_view>
+
+
+
+namespace
+{
+
+// splits keys of the form TAG_ideology_ADJ, where TAG is three upper-case letters or digits
+std::optional<std::pair<std::string, std::string>> splitAdjectiveKey(std::string_view key)
+{
+	constexpr std::string_view adjectiveSuffix = "_ADJ";
+	if (key.size() < 5 + adjectiveSuffix.size() || key[3] != '_' || !key.ends_with(adjectiveSuffix))
+	{
+		return std::nullopt;
+	}
+
+	const auto tag = key.substr(0, 3);
+	const auto ideology = key.substr(4, key.size() - 4 - adjectiveSuffix.size());
+	const auto isTagCharacter = [](const char character) {
+		return (character >= 'A' && character <= 'Z') || (character >= '0' && character <= '9');
+	};
+	const auto isIdeologyCharacter = [](const char character) {
+		return character >= 'a' && character <= 'z';
+	};
+	if (!std::ranges::all_of(tag, isTagCharacter) || !std::ranges::all_of(ideology, isIdeologyCharacter))
+	{
+		return std::nullopt;
+	}
+
+	return std::make_pair(std::string(tag), std::string(ideology));
+}
+
+} // namespace
 
 
 
@@ -37,112 +72,72 @@ std::unique_ptr<HoI4::Localisation> HoI4::Localisation::Importer::generateLocali
 
 void HoI4::Localisation::Importer::importLocalisations(const Configuration& theConfiguration)
 {
-	for (const auto& fileName: commonItems::GetAllFilesInFolder(theConfiguration.getHoI4Path() + "/localisation"))
+	std::vector<std::string> filenames;
+	std::vector<languageToLocalisationsMap*> destinations;
+	const std::vector<std::string> folders{theConfiguration.getHoI4Path() + "/localisation",
+		 "blankmod/output/localisation"};
+	for (const auto& folder: folders)
 	{
-		if (fileName.substr(0, 5) == "focus")
-		{
-			importFocusLocalisations(theConfiguration.getHoI4Path() + "/localisation/" + fileName);
-		}
-		else if (fileName.substr(0, 5) == "ideas")
+		for (const auto& fileName: commonItems::GetAllFilesInFolder(folder))
 		{
-			importGenericIdeaLocalisations(theConfiguration.getHoI4Path() + "/localisation/" + fileName);
-		}
-		else if (fileName.substr(0, 6) == "events")
-		{
-			importEventLocalisations(theConfiguration.getHoI4Path() + "/localisation/" + fileName);
+			if (auto* destination = getDestination(fileName); destination != nullptr)
+			{
+				filenames.push_back(folder + "/" + fileName);
+				destinations.push_back(destination);
+			}
 		}
 	}
 
-	for (const auto& fileName: commonItems::GetAllFilesInFolder("blankmod/output/localisation"))
-	{
-		if (fileName.substr(0, 5) == "focus")
-		{
-			importFocusLocalisations("blankmod/output/localisation/" + fileName);
-		}
-		else if (fileName.substr(0, 5) == "ideas")
+	const auto files = parallelMap(filenames, [](const std::string& filename) -> std::optional<LocalisationFile> {
+		std::ifstream file(filename, std::ios::binary);
+		if (!file.is_open())
 		{
-			importGenericIdeaLocalisations("blankmod/output/localisation/" + fileName);
+			return std::nullopt;
 		}
-		else if (fileName.substr(0, 6) == "events")
+		return LocalisationFile(file);
+	});
+
+	for (size_t i = 0; i < files.size(); ++i)
+	{
+		if (!files[i])
 		{
-			importEventLocalisations("blankmod/output/localisation/" + fileName);
+			Log(LogLevel::Error) << "Could not open " << filenames[i];
+			exit(-1);
 		}
+		importLocalisationFile(*files[i], *destinations[i]);
 	}
 }
 
 
-void HoI4::Localisation::Importer::importFocusLocalisations(const std::string& filename)
-{
-	importLocalisationFile(filename, originalFocuses);
-}
-
-
-void HoI4::Localisation::Importer::importGenericIdeaLocalisations(const std::string& filename)
-{
-	importLocalisationFile(filename, genericIdeaLocalisations);
-}
-
-
-void HoI4::Localisation::Importer::importEventLocalisations(const std::string& filename)
-{
-	importLocalisationFile(filename, originalEventLocalisations);
-}
-
-
-void HoI4::Localisation::Importer::importLocalisationFile(const std::string& filename,
-	 languageToLocalisationsMap& localisations)
+HoI4::languageToLocalisationsMap* HoI4::Localisation::Importer::getDestination(const std::string& fileName)
 {
-	keyToLocalisationMap newLocalisations;
-
-	std::ifstream file(filename);
-	if (!file.is_open())
+	if (fileName.starts_with("focus"))
 	{
-		Log(LogLevel::Error) << "Could not open " << filename;
-		exit(-1);
+		return &originalFocuses;
 	}
-	char bitBucket[3];
-	file.read(bitBucket, sizeof bitBucket);
-
-	std::string language;
-	while (!file.eof())
+	if (fileName.starts_with("ideas"))
 	{
-		char buffer[2048];
-		file.getline(buffer, sizeof buffer);
-		std::string line(buffer);
-		if (line.substr(0, 2) == "l_")
-		{
-			language = line.substr(2, line.length() - 3);
-			continue;
-		}
-
-		const auto colon = line.find(':');
-		if (colon == std::string::npos)
-		{
-			continue;
-		}
-		auto key = line.substr(1, colon - 1);
-
-		line = line.substr(colon, line.length());
-		const auto quote = line.find('\"');
-		const auto value = line.substr(quote + 1, line.length() - quote - 2);
-
-		newLocalisations[key] = value;
+		return &genericIdeaLocalisations;
 	}
-
-	auto localisationsInLanguage = localisations.find(language);
-	if (localisationsInLanguage == localisations.end())
+	if (fileName.starts_with("events"))
 	{
-		localisations[language] = newLocalisations;
+		return &originalEventLocalisations;
 	}
-	else
+
+	return nullptr;
+}
+
+
+void HoI4::Localisation::Importer::importLocalisationFile(const LocalisationFile& file,
+	 languageToLocalisationsMap& localisations)
+{
+	// within a file the last text for a key is used, but texts from earlier files are never replaced
+	auto& localisationsInLanguage = localisations[std::string(file.getLanguage())];
+	const auto& newLocalisations = file.getLocalisations();
+	for (auto localisation = newLocalisations.rbegin(); localisation != newLocalisations.rend(); ++localisation)
 	{
-		for (const auto& localisation: newLocalisations)
-		{
-			localisationsInLanguage->second.insert(localisation);
-		}
+		localisationsInLanguage.try_emplace(std::string(localisation->first), localisation->second);
 	}
-
-	file.close();
 }
 
 
@@ -977,15 +972,14 @@ void HoI4::Localisation::generateCustomLocalisations(ScriptedLocalisations& scri
 				continue;
 			}
 
-			std::smatch match;
 			for (const auto& rule: rules->getTheRules())
 			{
-				if (std::regex_match(localisation.second, match, rule.getMatcher()))
+				if (const auto stem = rule.getMatcher().match(localisation.second); stem)
 				{
-					for (const auto& replacement: rule.getReplacements())
+					for (const auto& replacement: rule.getInflections())
 					{
 						customLocalisations[localisationsInLanguage.first][localisation.first + replacement.first] =
-							 std::regex_replace(localisation.second, rule.getMatcher(), replacement.second);
+							 replacement.second.apply(localisation.second, *stem);
 
 						if (replacement.first == "_MS_" + getLanguageCode(localisationsInLanguage.first))
 						{
@@ -1079,12 +1073,12 @@ void HoI4::Localisation::insertScriptedLocalisation(const std::string& localisat
 	 ScriptedLocalisation& scriptedLocalisation,
 	 const std::set<std::string>& majorIdeologies) const
 {
-	const std::regex extractRegex("([A-Z0-9]{3})_([a-z]+)_ADJ");
-
-	std::smatch match;
-	std::regex_match(localisationKey, match, extractRegex);
-	const std::string tag = match[1];
-	const std::string ideology = match[2];
+	const auto tagAndIdeology = splitAdjectiveKey(localisationKey);
+	if (!tagAndIdeology)
+	{
+		return;
+	}
+	const auto& [tag, ideology] = *tagAndIdeology;
 	if (!majorIdeologies.contains(ideology))
 	{
 		return;
@@ -5,6 +5,7 @@
 
 #include "Configuration.h"
 #include "Localisations/ArticleRules/ArticleRules.h"
+#include "Localisations/LocalisationFile.h"
 #include "Mappers/CountryName/CountryNameMapper.h"
 #include "Mappers/GovernmentMapper.h"
 #include "Mappers/Provinces/ProvinceMapper.h"
@@ -199,10 +200,8 @@ class Localisation::Importer
 
   private:
 	void importLocalisations(const Configuration& theConfiguration);
-	void importFocusLocalisations(const std::string& filename);
-	void importGenericIdeaLocalisations(const std::string& filename);
-	void importEventLocalisations(const std::string& filename);
-	static void importLocalisationFile(const std::string& filename, languageToLocalisationsMap& localisations);
+	[[nodiscard]] languageToLocalisationsMap* getDestination(const std::string& fileName);
+	static void importLocalisationFile(const LocalisationFile& file, languageToLocalisationsMap& localisations);
 	void prepareBlankLocalisations();
 
 	std::map<language, std::map<stateNumber, std::string>> stateLocalisations;
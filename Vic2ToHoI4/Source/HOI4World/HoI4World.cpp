@@ -18,7 +18,6 @@
 #include "Localisations/ArticleRules/ArticleRulesFactory.h"
 #include "Log.h"
 #include "Map/Buildings.h"
-#include "Map/HoI4Provinces.h"
 #include "Map/StrategicRegion.h"
 #include "Map/SupplyZones.h"
 #include "Mappers/CountryMapping.h"
@@ -29,11 +28,11 @@
 #include "Mappers/Technology/ResearchBonusMapperFactory.h"
 #include "Mappers/Technology/TechMapper.h"
 #include "Mappers/Technology/TechMapperFactory.h"
-#include "MilitaryMappings/MilitaryMappingsFile.h"
 #include "Modifiers/DynamicModifiers.h"
 #include "Names/Names.h"
 #include "Operations/OperationsFactory.h"
 #include "OperativeNames/OperativeNamesFactory.h"
+#include "ParallelMap.h"
 #include "ParserHelpers.h"
 #include "Regions/RegionsFactory.h"
 #include "ScriptedLocalisations/ScriptedLocalisationsFactory.h"
@@ -53,11 +52,12 @@ using namespace std;
 
 HoI4::World::World(const Vic2::World& sourceWorld,
 	 const Mappers::ProvinceMapper& provinceMapper,
+	 const GameData& gameData,
 	 const Configuration& theConfiguration):
 	 countryMap(sourceWorld, theConfiguration.getDebug()),
 	 theIdeas(std::make_unique<HoI4::Ideas>()), theDecisions(make_unique<HoI4::decisions>(theConfiguration)),
 	 peaces(make_unique<HoI4::AiPeaces>()), events(make_unique<HoI4::Events>()),
-	 onActions(make_unique<HoI4::OnActions>())
+	 onActions(make_unique<HoI4::OnActions>()), gameData(gameData)
 {
 	Log(LogLevel::Progress) << "24%";
 	Log(LogLevel::Info) << "Building HoI4 World";
@@ -65,11 +65,9 @@ HoI4::World::World(const Vic2::World& sourceWorld,
 	auto vic2Localisations = sourceWorld.getLocalisations();
 	hoi4Localisations = Localisation::Importer{}.generateLocalisations(theConfiguration);
 
-	ProvinceDefinitions provinceDefinitions =
-		 ProvinceDefinitions::Importer{}.importProvinceDefinitions(theConfiguration);
-	theMapData = std::make_unique<MapData>(provinceDefinitions, theConfiguration);
-	const auto theProvinces = importProvinces(theConfiguration);
-	theCoastalProvinces.init(*theMapData, theProvinces);
+	const auto& provinceDefinitions = gameData.getProvinceDefinitions();
+	const auto& theMapData = gameData.getMapData();
+	const auto& theCoastalProvinces = gameData.getCoastalProvinces();
 	strategicRegions = StrategicRegions::Factory{}.importStrategicRegions(theConfiguration);
 	names = Names::Factory{}.getNames(theConfiguration);
 	theGraphics.init();
@@ -87,18 +85,19 @@ HoI4::World::World(const Vic2::World& sourceWorld,
 	hoi4Localisations->generateCustomLocalisations(*scriptedLocalisations, ideologies->getMajorIdeologies());
 	states = std::make_unique<States>(sourceWorld,
 		 countryMap,
-		 theProvinces,
+		 gameData.getProvinces(),
 		 theCoastalProvinces,
 		 sourceWorld.getStateDefinitions(),
 		 *strategicRegions,
 		 vic2Localisations,
 		 provinceDefinitions,
-		 *theMapData,
+		 theMapData,
 		 *hoi4Localisations,
 		 provinceMapper,
 		 theConfiguration);
+	geography = std::make_unique<Geography>(states->getStates(), states->getProvinceToStateIDMap());
 	supplyZones = new HoI4::SupplyZones(states->getDefaultStates(), theConfiguration);
-	buildings = new Buildings(*states, theCoastalProvinces, *theMapData, provinceDefinitions, theConfiguration);
+	buildings = new Buildings(*states, theCoastalProvinces, theMapData, provinceDefinitions, theConfiguration);
 	addStatesToCountries(provinceMapper);
 	states->addCapitalsToStates(countries);
 	intelligenceAgencies = IntelligenceAgencies::Factory::createIntelligenceAgencies(countries, *names);
@@ -111,8 +110,6 @@ HoI4::World::World(const Vic2::World& sourceWorld,
 	convertDiplomacy(sourceWorld);
 	convertTechs();
 
-	militaryMappingsFile importedMilitaryMappings;
-	theMilitaryMappings = importedMilitaryMappings.takeAllMilitaryMappings();
 	convertMilitaries(provinceDefinitions, provinceMapper, theConfiguration);
 
 	scriptedEffects = std::make_unique<ScriptedEffects>(theConfiguration.getHoI4Path());
@@ -136,7 +133,7 @@ HoI4::World::World(const Vic2::World& sourceWorld,
 	events->giveGovernmentInExileEvent(createGovernmentInExileEvent(ideologies->getMajorIdeologies()));
 	theIdeas->updateIdeas(ideologies->getMajorIdeologies());
 	theDecisions->updateDecisions(ideologies->getMajorIdeologies(),
-		 states->getProvinceToStateIDMap(),
+		 *geography,
 		 states->getDefaultStates(),
 		 *events,
 		 getSouthAsianCountries());
@@ -151,7 +148,7 @@ HoI4::World::World(const Vic2::World& sourceWorld,
 		createFactions(theConfiguration);
 	}
 
-	HoI4WarCreator warCreator(this, *theMapData, provinceDefinitions, *hoi4Localisations, theConfiguration);
+	HoI4WarCreator warCreator(this, theMapData, provinceDefinitions, *hoi4Localisations, theConfiguration);
 
 	addFocusTrees();
 	adjustResearchFocuses();
@@ -199,9 +196,36 @@ void HoI4::World::convertCountries(const Vic2::World& sourceWorld)
 
 	const auto flagsToIdeasMapper = Mappers::FlagsToIdeasMapper::Factory().importFlagsToIdeaMapper();
 
+	std::vector<std::pair<std::string, const Vic2::Country*>> countriesToConvert;
 	for (const auto& [tag, country]: sourceWorld.getCountries())
 	{
-		convertCountry(tag, country, *flagsToIdeasMapper);
+		// don't convert rebels
+		if (tag == "REB")
+		{
+			continue;
+		}
+
+		auto possibleHoI4Tag = countryMap.getHoI4Tag(tag);
+		if (!possibleHoI4Tag)
+		{
+			Log(LogLevel::Warning) << "Could not convert V2 tag " << tag << " to HoI4";
+			continue;
+		}
+		countriesToConvert.emplace_back(*possibleHoI4Tag, &country);
+	}
+
+	auto convertedCountries = parallelMap(countriesToConvert,
+		 [this, &flagsToIdeasMapper](const std::pair<std::string, const Vic2::Country*>& countryToConvert) {
+			 const auto& [hoi4Tag, oldCountry] = countryToConvert;
+			 return std::make_shared<Country>(hoi4Tag, *oldCountry, theGraphics, countryMap, *flagsToIdeasMapper);
+		 });
+
+	for (size_t i = 0; i < countriesToConvert.size(); ++i)
+	{
+		const auto& [hoi4Tag, oldCountry] = countriesToConvert[i];
+		auto& country = convertedCountries[i];
+		country->convertSharedElements(*oldCountry, *names, countryMap, *hoi4Localisations);
+		countries.insert(std::make_pair(hoi4Tag, std::move(country)));
 	}
 
 	int numHumanCountries = 0;
@@ -220,36 +244,6 @@ void HoI4::World::convertCountries(const Vic2::World& sourceWorld)
 }
 
 
-void HoI4::World::convertCountry(const std::string& oldTag,
-	 const Vic2::Country& oldCountry,
-	 const Mappers::FlagsToIdeasMapper& flagsToIdeasMapper)
-{
-	// don't convert rebels
-	if (oldTag == "REB")
-	{
-		return;
-	}
-
-	HoI4::Country* destCountry = nullptr;
-	auto possibleHoI4Tag = countryMap.getHoI4Tag(oldTag);
-	if (!possibleHoI4Tag)
-	{
-		Log(LogLevel::Warning) << "Could not convert V2 tag " << oldTag << " to HoI4";
-	}
-	else
-	{
-		destCountry = new HoI4::Country(*possibleHoI4Tag,
-			 oldCountry,
-			 *names,
-			 theGraphics,
-			 countryMap,
-			 flagsToIdeasMapper,
-			 *hoi4Localisations);
-		countries.insert(make_pair(*possibleHoI4Tag, destCountry));
-	}
-}
-
-
 void HoI4::World::importLeaderTraits()
 {
 	Log(LogLevel::Info) << "\tImporting leader traits";
@@ -370,7 +364,7 @@ void HoI4::World::convertIndustry(const Configuration& theConfiguration)
 	Log(LogLevel::Info) << "\tConverting industry";
 
 	map<string, double> factoryWorkerRatios = calculateFactoryWorkerRatios(theConfiguration);
-	states->putIndustryInStates(factoryWorkerRatios, theCoastalProvinces, theConfiguration);
+	states->putIndustryInStates(factoryWorkerRatios, gameData.getCoastalProvinces(), theConfiguration);
 
 	calculateIndustryInCountries();
 	reportIndustryLevels();
@@ -617,7 +611,7 @@ void HoI4::World::convertMilitaries(const ProvinceDefinitions& provinceDefinitio
 {
 	Log(LogLevel::Info) << "\tConverting militaries";
 	const HoI4::militaryMappings& specificMappings =
-		 theMilitaryMappings->getMilitaryMappings(theConfiguration.getVic2Mods());
+		 gameData.getMilitaryMappings().getMilitaryMappings(theConfiguration.getVic2Mods());
 
 	convertArmies(specificMappings, provinceMapper, theConfiguration);
 	convertNavies(specificMappings.getUnitMappings(),
@@ -664,15 +658,11 @@ void HoI4::World::convertNavies(const UnitMappings& unitMap,
 	PossibleShipVariants possibleVariants(variantsFile);
 	variantsFile.close();
 
-	for (auto country: countries)
+	const NavalLocations navalLocations(states->getStates(), states->getProvinceToStateIDMap(), provinceDefinitions);
+	for (const auto& country: countries)
 	{
 		country.second->determineShipVariants(possibleVariants);
-		country.second->convertNavies(unitMap,
-			 mtgUnitMap,
-			 states->getProvinceToStateIDMap(),
-			 states->getStates(),
-			 provinceDefinitions,
-			 provinceMapper);
+		country.second->convertNavies(unitMap, mtgUnitMap, navalLocations, provinceMapper);
 		country.second->convertConvoys(unitMap);
 	}
 }
@@ -893,7 +883,7 @@ void HoI4::World::addFocusTrees()
 	{
 		if (country.second->isGreatPower() || (country.second->getStrengthOverTime(3) > 4500))
 		{
-			country.second->addGenericFocusTree(ideologies->getMajorIdeologies());
+			country.second->addGenericFocusTree(genericFocusTree);
 		}
 	}
 }
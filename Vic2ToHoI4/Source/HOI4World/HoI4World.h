@@ -6,6 +6,7 @@
 #include "Decisions/Decisions.h"
 #include "Diplomacy/AIPeaces.h"
 #include "Events/Events.h"
+#include "GameData.h"
 #include "GameRules/GameRules.h"
 #include "HoI4Country.h"
 #include "HoI4Localisation.h"
@@ -46,6 +47,7 @@
 #include "ScriptedTriggers/ScriptedTriggers.h"
 #include "Sounds/SoundEffect.h"
 #include "States/DefaultState.h"
+#include "States/Geography.h"
 #include "States/HoI4State.h"
 #include "States/HoI4States.h"
 #include "V2World/Countries/Country.h"
@@ -66,6 +68,7 @@ class World: commonItems::parser
   public:
 	explicit World(const Vic2::World& sourceWorld,
 		 const Mappers::ProvinceMapper& provinceMapper,
+		 const GameData& gameData,
 		 const Configuration& theConfiguration);
 	~World() = default;
 
@@ -73,9 +76,10 @@ class World: commonItems::parser
 	[[nodiscard]] auto& getNames() { return names; }
 	[[nodiscard]] const auto& getNames() const { return *names; }
 	[[nodiscard]] const auto& getTheStates() const { return *states; }
+	[[nodiscard]] const auto& getGeography() const { return *geography; }
 	[[nodiscard]] const auto& getStrategicRegions() const { return *strategicRegions; }
 	[[nodiscard]] const auto& getCountries() const { return countries; }
-	[[nodiscard]] const auto& getMilitaryMappings() const { return *theMilitaryMappings; }
+	[[nodiscard]] const auto& getMilitaryMappings() const { return gameData.getMilitaryMappings(); }
 	[[nodiscard]] auto& getGraphics() { return theGraphics; }
 	[[nodiscard]] const auto& getIdeologicalLeaderTraits() const { return ideologicalLeaderTraits; }
 	[[nodiscard]] const auto& getGreatPowers() const { return greatPowers; }
@@ -101,7 +105,7 @@ class World: commonItems::parser
 	[[nodiscard]] const auto& getLocalisation() const { return *hoi4Localisations; }
 	[[nodiscard]] const auto& getSoundEffects() const { return soundEffects; }
 
-	std::map<int, HoI4::State> getStates() const { return states->getStates(); }
+	const std::map<int, HoI4::State>& getStates() const { return states->getStates(); }
 	const std::map<int, int>& getProvinceToStateIDMap() const { return states->getProvinceToStateIDMap(); }
 	std::vector<std::shared_ptr<Faction>> getFactions() const { return factions; }
 	const auto& getMajorIdeologies() const { return ideologies->getMajorIdeologies(); }
@@ -119,9 +123,6 @@ class World: commonItems::parser
 	World& operator=(const World&) = delete;
 
 	void convertCountries(const Vic2::World& sourceWorld);
-	void convertCountry(const std::string& oldTag,
-		 const Vic2::Country& oldCountry,
-		 const Mappers::FlagsToIdeasMapper& flagsToIdeasMapper);
 
 	void importLeaderTraits();
 	void importIdeologicalMinisters();
@@ -198,6 +199,7 @@ class World: commonItems::parser
 	std::unique_ptr<Mappers::CountryNameMapper> countryNameMapper;
 
 	std::unique_ptr<States> states;
+	std::unique_ptr<Geography> geography;
 
 	HoI4::SupplyZones* supplyZones = nullptr;
 	std::unique_ptr<StrategicRegions> strategicRegions;
@@ -223,10 +225,7 @@ class World: commonItems::parser
 	std::unique_ptr<OperativeNames> operativeNames;
 	std::unique_ptr<Operations> operations;
 
-	std::unique_ptr<allMilitaryMappings> theMilitaryMappings;
-
-	CoastalProvinces theCoastalProvinces;
-	std::unique_ptr<MapData> theMapData;
+	const GameData& gameData;
 
 	std::unique_ptr<ScriptedEffects> scriptedEffects;
 
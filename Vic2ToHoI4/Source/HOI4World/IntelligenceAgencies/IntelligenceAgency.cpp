@@ -8,7 +8,7 @@ HoI4::IntelligenceAgency::IntelligenceAgency(const Country& country,
 	 IntelligenceAgencyLogos& intelligenceAgencyLogos):
 	 countryTag(country.getTag())
 {
-	const auto possibleName = names.takeIntelligenceAgencyName(country.getPrimaryCulture());
+	const auto possibleName = names.takeIntelligenceAgencyName(country.getPrimaryCulture(), countryTag);
 	if (possibleName)
 	{
 		name = *possibleName;
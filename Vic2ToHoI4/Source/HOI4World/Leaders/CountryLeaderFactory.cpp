@@ -30,15 +30,16 @@ HoI4::CountryLeader HoI4::CountryLeader::Factory::createNewLeader(const std::str
 	 const std::string& primaryCultureGroup,
 	 const std::string& governmentIdeology,
 	 const std::string& leaderIdeology,
-	 Names& names,
-	 graphicsMapper& theGraphics)
+	 const std::string& countryTag,
+	 const Names& names,
+	 const graphicsMapper& theGraphics)
 {
 	CountryLeader leader;
 	leader.ideology = leaderIdeology;
-	leader.picture = theGraphics.getLeaderPortrait(primaryCultureGroup, governmentIdeology);
+	leader.picture = theGraphics.getLeaderPortrait(primaryCultureGroup, governmentIdeology, countryTag);
 
-	const auto firstName = names.getMaleName(primaryCulture);
-	const auto surname = names.getSurname(primaryCulture);
+	const auto firstName = names.getMaleName(primaryCulture, countryTag);
+	const auto surname = names.getSurname(primaryCulture, countryTag);
 
 	if (!firstName || !surname)
 	{
@@ -46,11 +47,11 @@ HoI4::CountryLeader HoI4::CountryLeader::Factory::createNewLeader(const std::str
 		return leader;
 	}
 
-	leader.name = *firstName + " " + *surname;
+	leader.name = std::string(*firstName) + " " + std::string(*surname);
 
-	auto upperFirstName = *firstName;
+	std::string upperFirstName(*firstName);
 	std::transform(upperFirstName.begin(), upperFirstName.end(), upperFirstName.begin(), toupper);
-	auto upperSurname = *surname;
+	std::string upperSurname(*surname);
 	std::transform(upperSurname.begin(), upperSurname.end(), upperSurname.begin(), toupper);
 	leader.description = "POLITICS_" + upperFirstName + "_" + upperSurname + "_DESC";
 
@@ -23,8 +23,9 @@ class CountryLeader::Factory: commonItems::parser
 		 const std::string& primaryCultureGroup,
 		 const std::string& governmentIdeology,
 		 const std::string& leaderIdeology,
-		 Names& names,
-		 graphicsMapper& theGraphics);
+		 const std::string& countryTag,
+		 const Names& names,
+		 const graphicsMapper& theGraphics);
 	std::unique_ptr<CountryLeader> importCountryLeader(std::istream& theStream);
 
   private:
@@ -0,0 +1,205 @@
+#include "AdjectiveInflection.h"
+
+
+
+namespace
+{
+
+constexpr std::string_view regexSpecialCharacters = ".[]{}()*+?|\\^$";
+
+
+char toLowerAscii(const char character)
+{
+	if (character >= 'A' && character <= 'Z')
+	{
+		return static_cast<char>(character - 'A' + 'a');
+	}
+	return character;
+}
+
+
+bool equalsIgnoringCase(std::string_view text, std::string_view lowerCaseText)
+{
+	if (text.size() != lowerCaseText.size())
+	{
+		return false;
+	}
+	for (size_t i = 0; i < text.size(); ++i)
+	{
+		if (toLowerAscii(text[i]) != lowerCaseText[i])
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+
+// appends the literal at the start of pattern, returning the rest of the pattern or nullopt on unsupported syntax
+std::optional<std::string_view> readLiteral(std::string_view pattern, std::string& literal)
+{
+	while (!pattern.empty() && !pattern.starts_with("(.+)") && pattern != "$")
+	{
+		auto character = pattern.front();
+		if (character == '\\' && pattern.size() > 1 && regexSpecialCharacters.find(pattern[1]) != std::string_view::npos)
+		{
+			pattern.remove_prefix(1);
+			character = pattern.front();
+		}
+		else if (regexSpecialCharacters.find(character) != std::string_view::npos)
+		{
+			return std::nullopt;
+		}
+
+		literal += toLowerAscii(character);
+		pattern.remove_prefix(1);
+	}
+
+	return pattern;
+}
+
+} // namespace
+
+
+
+HoI4::AdjectiveMatcher::AdjectiveMatcher(std::string_view pattern)
+{
+	if (pattern.starts_with('^'))
+	{
+		pattern.remove_prefix(1);
+	}
+
+	auto rest = readLiteral(pattern, prefix);
+	if (rest && rest->starts_with("(.+)"))
+	{
+		hasStem = true;
+		rest->remove_prefix(4);
+		rest = readLiteral(*rest, suffix);
+	}
+	if (rest && *rest == "$")
+	{
+		rest->remove_prefix(1);
+	}
+
+	valid = rest && rest->empty();
+}
+
+
+std::optional<std::string_view> HoI4::AdjectiveMatcher::match(std::string_view adjective) const
+{
+	if (!valid)
+	{
+		return std::nullopt;
+	}
+
+	if (!hasStem)
+	{
+		if (!equalsIgnoringCase(adjective, prefix))
+		{
+			return std::nullopt;
+		}
+		return std::string_view{};
+	}
+
+	if (adjective.size() <= prefix.size() + suffix.size() ||
+		 !equalsIgnoringCase(adjective.substr(0, prefix.size()), prefix) ||
+		 !equalsIgnoringCase(adjective.substr(adjective.size() - suffix.size()), suffix))
+	{
+		return std::nullopt;
+	}
+
+	// '.' does not match line terminators
+	const auto stem = adjective.substr(prefix.size(), adjective.size() - prefix.size() - suffix.size());
+	if (stem.find_first_of("\r\n") != std::string_view::npos)
+	{
+		return std::nullopt;
+	}
+
+	return stem;
+}
+
+
+HoI4::AdjectiveReplacement::AdjectiveReplacement(std::string_view format)
+{
+	Part part;
+	while (!format.empty())
+	{
+		if (format.front() != '$' || format.size() == 1)
+		{
+			part.literal += format.front();
+			format.remove_prefix(1);
+			continue;
+		}
+
+		const auto next = format[1];
+		format.remove_prefix(2);
+		if (next == '$')
+		{
+			part.literal += '$';
+			continue;
+		}
+		if (next == '`' || next == '\'')
+		{
+			continue;
+		}
+		if (next == '&')
+		{
+			part.insertion = Insertion::adjective;
+		}
+		else if (next >= '0' && next <= '9')
+		{
+			auto submatch = next - '0';
+			if (!format.empty() && format.front() >= '0' && format.front() <= '9')
+			{
+				submatch = submatch * 10 + (format.front() - '0');
+				format.remove_prefix(1);
+			}
+			if (submatch == 0)
+			{
+				part.insertion = Insertion::adjective;
+			}
+			else if (submatch == 1)
+			{
+				part.insertion = Insertion::stem;
+			}
+			else
+			{
+				continue;
+			}
+		}
+		else
+		{
+			part.literal += '$';
+			part.literal += next;
+			continue;
+		}
+
+		parts.push_back(std::move(part));
+		part = Part{};
+	}
+
+	if (!part.literal.empty())
+	{
+		parts.push_back(std::move(part));
+	}
+}
+
+
+std::string HoI4::AdjectiveReplacement::apply(std::string_view adjective, std::string_view stem) const
+{
+	std::string inflected;
+	for (const auto& part: parts)
+	{
+		inflected += part.literal;
+		if (part.insertion == Insertion::adjective)
+		{
+			inflected += adjective;
+		}
+		else if (part.insertion == Insertion::stem)
+		{
+			inflected += stem;
+		}
+	}
+
+	return inflected;
+}
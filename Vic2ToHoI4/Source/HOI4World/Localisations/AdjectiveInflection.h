@@ -0,0 +1,68 @@
+#ifndef ADJECTIVE_INFLECTION_H
+#define ADJECTIVE_INFLECTION_H
+
+
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+
+namespace HoI4
+{
+
+// The matcher of a language replacement rule, compiled from the regex syntax used by languageReplacements.txt: an
+// optional '^', literal text, at most one "(.+)", more literal text and an optional '$'. It must match the whole
+// adjective, and letters match regardless of case (ASCII only, as std::regex::icase did).
+class AdjectiveMatcher
+{
+  public:
+	explicit AdjectiveMatcher(std::string_view pattern);
+
+	[[nodiscard]] bool isValid() const { return valid; }
+
+	// the text matched by "(.+)" (empty if there is no group), or nullopt if the adjective does not match
+	[[nodiscard]] std::optional<std::string_view> match(std::string_view adjective) const;
+
+  private:
+	bool valid = true;
+	bool hasStem = false;
+	std::string prefix; // lower-case
+	std::string suffix; // lower-case
+};
+
+
+// A replacement of a language replacement rule, compiled from its std::regex_replace format. "$1" is the stem, "$0"
+// and "$&" the whole adjective, "$$" a literal '$'. Other submatches, "$`" and "$'" are always empty, as the matcher
+// covers the whole adjective.
+class AdjectiveReplacement
+{
+  public:
+	explicit AdjectiveReplacement(std::string_view format);
+
+	[[nodiscard]] std::string apply(std::string_view adjective, std::string_view stem) const;
+
+  private:
+	enum class Insertion
+	{
+		none,
+		adjective,
+		stem
+	};
+
+	typedef struct Part
+	{
+		std::string literal;
+		Insertion insertion = Insertion::none; // inserted after the literal
+	} Part;
+
+	std::vector<Part> parts;
+};
+
+} // namespace HoI4
+
+
+
+#endif // ADJECTIVE_INFLECTION_H
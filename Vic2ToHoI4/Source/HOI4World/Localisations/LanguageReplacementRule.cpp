@@ -1,11 +1,21 @@
 #include "LanguageReplacementRule.h"
 #include "LanguageReplacements.h"
+#include "Log.h"
 
 
 
 HoI4::LanguageReplacementRule::LanguageReplacementRule(const std::string& _matcher, std::istream& theStream):
-	matcher(_matcher, std::regex::icase)
+	matcher(_matcher)
 {
+	if (!matcher.isValid())
+	{
+		Log(LogLevel::Warning) << "Unsupported language replacement matcher: " << _matcher;
+	}
+
 	LanguageReplacements theReplacements(theStream);
 	replacements = theReplacements.getReplacements();
+	for (const auto& [suffix, format]: replacements)
+	{
+		inflections.emplace_back(suffix, AdjectiveReplacement(format));
+	}
 }
\ No newline at end of file
@@ -3,10 +3,12 @@
 
 
 
+#include "AdjectiveInflection.h"
 #include "Parser.h"
 #include <map>
-#include <regex>
 #include <string>
+#include <utility>
+#include <vector>
 
 
 
@@ -20,10 +22,12 @@ class LanguageReplacementRule: commonItems::parser
 
 		const auto& getMatcher() const { return matcher; }
 		const auto& getReplacements() const { return replacements; }
+		const auto& getInflections() const { return inflections; }
 
 	private:
-		std::regex matcher;
+		AdjectiveMatcher matcher;
 		std::map<std::string, std::string> replacements;
+		std::vector<std::pair<std::string, AdjectiveReplacement>> inflections; // the compiled replacements, in order
 };
 
 }
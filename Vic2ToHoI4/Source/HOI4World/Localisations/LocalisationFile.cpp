@@ -0,0 +1,91 @@
+#include "LocalisationFile.h"
+#include <iterator>
+
+
+
+namespace
+{
+
+constexpr std::string_view byteOrderMark = "\xEF\xBB\xBF";
+constexpr std::string_view whitespace = " \t\r";
+
+
+std::string_view trim(std::string_view text)
+{
+	const auto start = text.find_first_not_of(whitespace);
+	if (start == std::string_view::npos)
+	{
+		return {};
+	}
+	return text.substr(start, text.find_last_not_of(whitespace) - start + 1);
+}
+
+} // namespace
+
+
+
+HoI4::LocalisationFile::LocalisationFile(std::istream& theStream)
+{
+	theStream.seekg(0, std::ios::end);
+	if (const auto size = theStream.tellg(); size > 0)
+	{
+		contents.resize(static_cast<size_t>(size));
+		theStream.seekg(0, std::ios::beg);
+		theStream.read(contents.data(), size);
+		contents.resize(static_cast<size_t>(theStream.gcount()));
+	}
+	else
+	{
+		theStream.clear();
+		theStream.seekg(0, std::ios::beg);
+		contents.assign(std::istreambuf_iterator<char>(theStream), std::istreambuf_iterator<char>());
+	}
+
+	std::string_view text(contents.data(), contents.size());
+	if (text.starts_with(byteOrderMark))
+	{
+		text.remove_prefix(byteOrderMark.size());
+	}
+
+	while (!text.empty())
+	{
+		const auto lineEnd = text.find('\n');
+		parseLine(text.substr(0, lineEnd));
+		if (lineEnd == std::string_view::npos)
+		{
+			break;
+		}
+		text.remove_prefix(lineEnd + 1);
+	}
+}
+
+
+void HoI4::LocalisationFile::parseLine(std::string_view line)
+{
+	if (line.starts_with("l_"))
+	{
+		language = trim(line.substr(2, line.find(':') - 2));
+		return;
+	}
+
+	line = trim(line);
+	if (line.empty() || line.front() == '#')
+	{
+		return;
+	}
+
+	const auto colon = line.find(':');
+	const auto openingQuote = line.find('"', colon);
+	if (colon == std::string_view::npos || openingQuote == std::string_view::npos)
+	{
+		return;
+	}
+
+	auto text = line.substr(openingQuote + 1);
+	if (const auto closingQuote = text.rfind('"'); closingQuote != std::string_view::npos)
+	{
+		text = text.substr(0, closingQuote);
+	}
+
+	localisations.emplace_back(trim(line.substr(0, colon)), text);
+}
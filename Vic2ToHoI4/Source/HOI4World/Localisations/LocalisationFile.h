@@ -0,0 +1,47 @@
+#ifndef LOCALISATION_FILE_H
+#define LOCALISATION_FILE_H
+
+
+
+#include <istream>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+
+
+namespace HoI4
+{
+
+// A HoI4 localisation (.yml) file, read into memory in one go. The language and localisations are views into the
+// file's contents, so they are only valid while this file is.
+class LocalisationFile
+{
+  public:
+	LocalisationFile() = default;
+	explicit LocalisationFile(std::istream& theStream);
+	LocalisationFile(const LocalisationFile&) = delete;
+	LocalisationFile& operator=(const LocalisationFile&) = delete;
+	LocalisationFile(LocalisationFile&&) = default;
+	LocalisationFile& operator=(LocalisationFile&&) = default;
+
+	// the last "l_language:" header in the file
+	[[nodiscard]] std::string_view getLanguage() const { return language; }
+
+	// key -> localisation, in file order. Texts are as written between the first and last quote of their line, so
+	// escaped quotes are kept as escapes.
+	[[nodiscard]] const auto& getLocalisations() const { return localisations; }
+
+  private:
+	void parseLine(std::string_view line);
+
+	std::vector<char> contents; // not a string, as moving a string can move its characters
+	std::string_view language;
+	std::vector<std::pair<std::string_view, std::string_view>> localisations;
+};
+
+} // namespace HoI4
+
+
+
+#endif // LOCALISATION_FILE_H
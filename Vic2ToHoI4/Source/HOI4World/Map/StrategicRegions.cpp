@@ -1,4 +1,5 @@
 #include "StrategicRegions.h"
+#include "FolderImport.h"
 #include "HOI4World/States/HoI4State.h"
 #include "HOI4World/States/HoI4States.h"
 #include "OSCompatibilityLayer.h"
@@ -99,16 +100,17 @@ std::unique_ptr<HoI4::StrategicRegions> HoI4::StrategicRegions::Factory::importS
 	std::map<int, StrategicRegion> strategicRegions;
 	std::map<int, int> provinceToStrategicRegionMap;
 
-	for (const auto& filename:
-		 commonItems::GetAllFilesInFolder(theConfiguration.getHoI4Path() + "/map/strategicregions/"))
+	auto regionFiles = importFolder(theConfiguration.getHoI4Path() + "/map/strategicregions",
+		 [&theConfiguration](const std::string&, const std::string& filename) {
+			 return StrategicRegion(filename, theConfiguration);
+		 });
+	for (auto& [filename, newRegion]: regionFiles)
 	{
-		auto newRegion = StrategicRegion(filename, theConfiguration);
-		strategicRegions.insert(std::make_pair(newRegion.getID(), newRegion));
-
 		for (auto province: newRegion.getOldProvinces())
 		{
 			provinceToStrategicRegionMap.insert(std::make_pair(province, newRegion.getID()));
 		}
+		strategicRegions.insert(std::make_pair(newRegion.getID(), std::move(newRegion)));
 	}
 
 	return std::make_unique<StrategicRegions>(std::move(strategicRegions), std::move(provinceToStrategicRegionMap));
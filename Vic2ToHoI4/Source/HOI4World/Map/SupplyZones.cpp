@@ -1,6 +1,7 @@
 #include "SupplyZones.h"
 #include "CommonRegexes.h"
 #include "Configuration.h"
+#include "FolderImport.h"
 #include "HOI4World/States/DefaultState.h"
 #include "HOI4World/States/HoI4State.h"
 #include "HOI4World/States/HoI4States.h"
@@ -17,33 +18,40 @@ HoI4::SupplyZones::SupplyZones(const std::map<int, DefaultState>& defaultStates,
 	Log(LogLevel::Info) << "\tImporting supply zones";
 	importStates(defaultStates);
 
-	registerKeyword("supply_area", [this](std::istream& theStream) {
-		const SupplyArea area(theStream);
-		auto ID = area.getID();
+	const auto supplyZonesFiles = importFolder(theConfiguration.getHoI4Path() + "/map/supplyareas",
+		 [](const std::string& path, const std::string&) {
+			 std::vector<SupplyArea> areas;
+			 commonItems::parser supplyAreaFileParser;
+			 supplyAreaFileParser.registerKeyword("supply_area", [&areas](std::istream& theStream) {
+				 areas.emplace_back(theStream);
+			 });
+			 supplyAreaFileParser.registerRegex(commonItems::catchallRegex, commonItems::ignoreItem);
+			 supplyAreaFileParser.parseFile(path);
+			 return areas;
+		 });
 
-		SupplyZone newSupplyZone(ID, area.getValue());
-		supplyZones.insert(std::make_pair(ID, newSupplyZone));
+	for (const auto& [supplyZonesFile, areas]: supplyZonesFiles)
+	{
+		auto num = stoi(supplyZonesFile.substr(0, supplyZonesFile.find_first_of('-')));
+		supplyZonesFileNames.insert(make_pair(num, supplyZonesFile));
 
-		for (auto state: area.getStates())
+		for (const auto& area: areas)
 		{
-			auto mapping = defaultStateToProvinceMap.find(state);
-			for (auto province: mapping->second)
+			auto ID = area.getID();
+
+			SupplyZone newSupplyZone(ID, area.getValue());
+			supplyZones.insert(std::make_pair(ID, newSupplyZone));
+
+			for (auto state: area.getStates())
 			{
-				provinceToSupplyZoneMap.insert(std::make_pair(province, ID));
+				auto mapping = defaultStateToProvinceMap.find(state);
+				for (auto province: mapping->second)
+				{
+					provinceToSupplyZoneMap.insert(std::make_pair(province, ID));
+				}
 			}
 		}
-	});
-	registerRegex(commonItems::catchallRegex, commonItems::ignoreItem);
-
-	for (const auto& supplyZonesFile:
-		 commonItems::GetAllFilesInFolder(theConfiguration.getHoI4Path() + "/map/supplyareas"))
-	{
-		auto num = stoi(supplyZonesFile.substr(0, supplyZonesFile.find_first_of('-')));
-		supplyZonesFileNames.insert(make_pair(num, supplyZonesFile));
-		parseFile(theConfiguration.getHoI4Path() + "/map/supplyareas/" + supplyZonesFile);
 	}
-
-	clearRegisteredKeywords();
 }
 
 
@@ -12,21 +12,16 @@ namespace HoI4
 {
 
 bool isWastelandProvince(int provinceNum, const States& theStates);
-void addAvailableBattalionsAndCompanies(
-	 std::map<std::string, std::vector<SizedRegiment>>& availableBattalionsAndCompanies,
+void addAvailableBattalionsAndCompanies(UnitPool& availableBattalionsAndCompanies,
+	 UnitTypes& unitTypes,
 	 const Vic2::Army& sourceArmy,
 	 const militaryMappings& theMilitaryMappings,
 	 double forceMultiplier);
-void addRemainingBattalionsAndCompanies(
-	 std::map<std::string, std::vector<SizedRegiment>>& remainingBattalionsAndCompanies,
-	 const std::map<std::string, std::vector<SizedRegiment>>& localBattalionsAndCompanies);
-std::map<std::string, int> determineTemplateRequirements(const DivisionTemplateType& divisionTemplate);
-bool sufficientUnits(const std::map<std::string, std::vector<SizedRegiment>>& units,
+std::vector<UnitRequirement> determineTemplateRequirements(const DivisionTemplateType& divisionTemplate,
 	 const std::map<std::string, std::string>& substitutes,
-	 const std::map<std::string, int>& requiredUnits);
-DivisionType createDivision(const std::map<std::string, int>& templateRequirements,
-	 std::map<std::string, std::vector<SizedRegiment>>& BattalionsAndCompanies,
-	 const militaryMappings& theMilitaryMappings,
+	 UnitTypes& unitTypes);
+DivisionType createDivision(const std::vector<UnitRequirement>& templateRequirements,
+	 UnitPool& battalionsAndCompanies,
 	 int divisionCounter,
 	 const DivisionTemplateType& divisionTemplate,
 	 int location);
@@ -41,7 +36,18 @@ void HoI4::Army::convertArmies(const militaryMappings& theMilitaryMappings,
 	 const States& theStates,
 	 const Mappers::ProvinceMapper& provinceMapper)
 {
-	std::map<std::string, std::vector<SizedRegiment>> remainingBattalionsAndCompanies;
+	UnitTypes unitTypes;
+	std::vector<AvailableTemplate> availableTemplates;
+	for (const auto& divisionTemplate: theMilitaryMappings.getDivisionTemplates())
+	{
+		if (!missingRequiredTechnologies(divisionTemplate, countryTechnologies))
+		{
+			availableTemplates.push_back(AvailableTemplate{divisionTemplate,
+				 determineTemplateRequirements(divisionTemplate, theMilitaryMappings.getSubstitutes(), unitTypes)});
+		}
+	}
+
+	UnitPool remainingBattalionsAndCompanies;
 
 	for (const auto& army: sourceArmies)
 	{
@@ -49,31 +55,36 @@ void HoI4::Army::convertArmies(const militaryMappings& theMilitaryMappings,
 		if (!location || isWastelandProvince(*location, theStates))
 		{
 			addAvailableBattalionsAndCompanies(remainingBattalionsAndCompanies,
+				 unitTypes,
 				 army,
 				 theMilitaryMappings,
 				 forceMultiplier);
 			continue;
 		}
-		std::map<std::string, std::vector<SizedRegiment>> localBattalionsAndCompanies;
-		addAvailableBattalionsAndCompanies(localBattalionsAndCompanies, army, theMilitaryMappings, forceMultiplier);
+		UnitPool localBattalionsAndCompanies;
+		addAvailableBattalionsAndCompanies(localBattalionsAndCompanies,
+			 unitTypes,
+			 army,
+			 theMilitaryMappings,
+			 forceMultiplier);
 		const auto divisionsBefore = divisions.size();
 
-		convertArmyDivisions(theMilitaryMappings, localBattalionsAndCompanies, countryTechnologies, *location);
+		convertArmyDivisions(availableTemplates, localBattalionsAndCompanies, *location);
 		if (divisionsBefore != divisions.size())
 		{
 			divisionLocations.insert(*location);
 		}
 
-		addRemainingBattalionsAndCompanies(remainingBattalionsAndCompanies, localBattalionsAndCompanies);
+		remainingBattalionsAndCompanies.addRemainingUnits(localBattalionsAndCompanies);
 	}
 
-	if (!remainingBattalionsAndCompanies.empty())
+	if (remainingBattalionsAndCompanies.hasHadUnits())
 	{
 		divisionLocations.insert(backupLocation);
 	}
-	convertArmyDivisions(theMilitaryMappings, remainingBattalionsAndCompanies, countryTechnologies, backupLocation);
+	convertArmyDivisions(availableTemplates, remainingBattalionsAndCompanies, backupLocation);
 
-	collectLeftoverEquipment(remainingBattalionsAndCompanies);
+	collectLeftoverEquipment(remainingBattalionsAndCompanies, unitTypes);
 }
 
 
@@ -97,7 +108,7 @@ std::optional<int> HoI4::Army::getLocation(std::optional<int> vic2Location,
 
 bool HoI4::isWastelandProvince(const int provinceNum, const States& theStates)
 {
-	auto provinceToStateIDMap = theStates.getProvinceToStateIDMap();
+	const auto& provinceToStateIDMap = theStates.getProvinceToStateIDMap();
 	if (const auto& stateNum = provinceToStateIDMap.find(provinceNum); stateNum != provinceToStateIDMap.end())
 	{
 		const auto& states = theStates.getStates();
@@ -111,8 +122,8 @@ bool HoI4::isWastelandProvince(const int provinceNum, const States& theStates)
 }
 
 
-void HoI4::addAvailableBattalionsAndCompanies(
-	 std::map<std::string, std::vector<SizedRegiment>>& availableBattalionsAndCompanies,
+void HoI4::addAvailableBattalionsAndCompanies(UnitPool& availableBattalionsAndCompanies,
+	 UnitTypes& unitTypes,
 	 const Vic2::Army& sourceArmy,
 	 const militaryMappings& theMilitaryMappings,
 	 const double forceMultiplier)
@@ -131,7 +142,7 @@ void HoI4::addAvailableBattalionsAndCompanies(
 					theRegiment.unitSize = unitInfo.getSize() * forceMultiplier;
 					theRegiment.experience = regiment.getExperience();
 					theRegiment.strength = regiment.getStrength();
-					availableBattalionsAndCompanies[unitInfo.getType()].push_back(theRegiment);
+					availableBattalionsAndCompanies.addRegiment(unitTypes.getIndex(unitInfo.getType()), theRegiment);
 					break;
 				}
 			}
@@ -144,60 +155,17 @@ void HoI4::addAvailableBattalionsAndCompanies(
 }
 
 
-void HoI4::addRemainingBattalionsAndCompanies(
-	 std::map<std::string, std::vector<SizedRegiment>>& remainingBattalionsAndCompanies,
-	 const std::map<std::string, std::vector<SizedRegiment>>& localBattalionsAndCompanies)
-{
-	for (const auto& unit: localBattalionsAndCompanies)
-	{
-		std::vector<SizedRegiment> remainingRegiments;
-		for (const auto& regiment: unit.second)
-		{
-			if (regiment.unitSize > 0)
-			{
-				remainingRegiments.push_back(regiment);
-			}
-		}
-
-		if (auto remainingUnit = remainingBattalionsAndCompanies.find(unit.first);
-			 remainingUnit != remainingBattalionsAndCompanies.end())
-		{
-			for (const auto& regiment: remainingRegiments)
-			{
-				remainingUnit->second.push_back(regiment);
-			}
-		}
-		else
-		{
-			remainingBattalionsAndCompanies.insert(make_pair(unit.first, remainingRegiments));
-		}
-	}
-}
-
-
-void HoI4::Army::convertArmyDivisions(const militaryMappings& theMilitaryMappings,
-	 std::map<std::string, std::vector<SizedRegiment>>& BattalionsAndCompanies,
-	 const technologies& countryTechnologies,
+void HoI4::Army::convertArmyDivisions(const std::vector<AvailableTemplate>& availableTemplates,
+	 UnitPool& units,
 	 const int location)
 {
-	for (const auto& divisionTemplate: theMilitaryMappings.getDivisionTemplates())
+	for (const auto& [divisionTemplate, templateRequirements]: availableTemplates)
 	{
-		if (missingRequiredTechnologies(divisionTemplate, countryTechnologies))
-		{
-			continue;
-		}
-
-		auto templateRequirements = determineTemplateRequirements(divisionTemplate);
-
 		auto divisionCounter = 1;
-		while (sufficientUnits(BattalionsAndCompanies, theMilitaryMappings.getSubstitutes(), templateRequirements))
+		while (units.canSupply(templateRequirements))
 		{
-			divisions.push_back(createDivision(templateRequirements,
-				 BattalionsAndCompanies,
-				 theMilitaryMappings,
-				 divisionCounter,
-				 divisionTemplate,
-				 location));
+			divisions.push_back(
+				 createDivision(templateRequirements, units, divisionCounter, divisionTemplate, location));
 			divisionCounter++;
 		}
 	}
@@ -219,8 +187,11 @@ bool HoI4::Army::missingRequiredTechnologies(const DivisionTemplateType& divisio
 }
 
 
-std::map<std::string, int> HoI4::determineTemplateRequirements(const DivisionTemplateType& divisionTemplate)
+std::vector<HoI4::UnitRequirement> HoI4::determineTemplateRequirements(const DivisionTemplateType& divisionTemplate,
+	 const std::map<std::string, std::string>& substitutes,
+	 UnitTypes& unitTypes)
 {
+	// regiments are used up type by type in name order
 	std::map<std::string, int> templateRequirements;
 	for (const auto& regiment: divisionTemplate.getRegiments())
 	{
@@ -231,49 +202,25 @@ std::map<std::string, int> HoI4::determineTemplateRequirements(const DivisionTem
 		templateRequirements[regiment.getType()] = templateRequirements[regiment.getType()] + 1;
 	}
 
-	return templateRequirements;
-}
-
-
-bool HoI4::sufficientUnits(const std::map<std::string, std::vector<SizedRegiment>>& units,
-	 const std::map<std::string, std::string>& substitutes,
-	 const std::map<std::string, int>& requiredUnits)
-{
-	for (const auto& requiredUnit: requiredUnits)
+	std::vector<UnitRequirement> unitRequirements;
+	for (const auto& [type, amount]: templateRequirements)
 	{
-		double available = 0;
-
-		if (auto unit = units.find(requiredUnit.first); unit != units.end())
+		UnitRequirement requirement;
+		requirement.type = unitTypes.getIndex(type);
+		if (const auto substitute = substitutes.find(type); substitute != substitutes.end())
 		{
-			for (const auto& sizedRegiment: unit->second)
-			{
-				available += sizedRegiment.unitSize;
-			}
-		}
-		if (auto substitute = substitutes.find(requiredUnit.first); substitute != substitutes.end())
-		{
-			if (auto unit = units.find(substitute->second); unit != units.end())
-			{
-				for (const auto& sizedRegiment: unit->second)
-				{
-					available += sizedRegiment.unitSize;
-				}
-			}
-		}
-
-		if (available < requiredUnit.second)
-		{
-			return false;
+			requirement.substitute = unitTypes.getIndex(substitute->second);
 		}
+		requirement.amount = amount;
+		unitRequirements.push_back(requirement);
 	}
 
-	return true;
+	return unitRequirements;
 }
 
 
-HoI4::DivisionType HoI4::createDivision(const std::map<std::string, int>& templateRequirements,
-	 std::map<std::string, std::vector<SizedRegiment>>& BattalionsAndCompanies,
-	 const militaryMappings& theMilitaryMappings,
+HoI4::DivisionType HoI4::createDivision(const std::vector<UnitRequirement>& templateRequirements,
+	 UnitPool& battalionsAndCompanies,
 	 const int divisionCounter,
 	 const DivisionTemplateType& divisionTemplate,
 	 const int location)
@@ -283,35 +230,13 @@ HoI4::DivisionType HoI4::createDivision(const std::map<std::string, int>& templa
 	auto totalRequirement = 0.0;
 	for (const auto& requirement: templateRequirements)
 	{
-		totalRequirement += requirement.second;
-		double remainingRequirement = requirement.second;
-		for (auto& regiment: BattalionsAndCompanies[requirement.first])
+		totalRequirement += requirement.amount;
+		auto remainingRequirement = static_cast<double>(requirement.amount);
+		remainingRequirement =
+			 battalionsAndCompanies.take(requirement.type, remainingRequirement, totalExperience, totalStrength);
+		if (requirement.substitute)
 		{
-			if (regiment.unitSize > 0)
-			{
-				const auto decreaseAmount = std::min(regiment.unitSize, remainingRequirement);
-				regiment.unitSize -= decreaseAmount;
-				remainingRequirement -= decreaseAmount;
-
-				totalExperience += decreaseAmount * regiment.experience;
-				totalStrength += decreaseAmount * regiment.strength;
-			}
-		}
-		if (const auto& substitutes = theMilitaryMappings.getSubstitutes();
-			 substitutes.contains(requirement.first) && BattalionsAndCompanies.contains(substitutes.at(requirement.first)))
-		{
-			for (auto& regiment: BattalionsAndCompanies[theMilitaryMappings.getSubstitutes().at(requirement.first)])
-			{
-				if (regiment.unitSize > 0)
-				{
-					const auto decreaseAmount = std::min(regiment.unitSize, remainingRequirement);
-					regiment.unitSize -= decreaseAmount;
-					remainingRequirement -= decreaseAmount;
-
-					totalExperience += decreaseAmount * regiment.experience;
-					totalStrength += decreaseAmount * regiment.strength;
-				}
-			}
+			battalionsAndCompanies.take(*requirement.substitute, remainingRequirement, totalExperience, totalStrength);
 		}
 	}
 
@@ -330,11 +255,12 @@ HoI4::DivisionType HoI4::createDivision(const std::map<std::string, int>& templa
 }
 
 
-void HoI4::Army::collectLeftoverEquipment(std::map<std::string, std::vector<SizedRegiment>>& battalionsAndCompanies)
+void HoI4::Army::collectLeftoverEquipment(const UnitPool& units, const UnitTypes& unitTypes)
 {
-	for (const auto& [type, sizedRegiment]: battalionsAndCompanies)
+	for (size_t typeIndex = 0; typeIndex < units.getNumTypes(); ++typeIndex)
 	{
-		for (const auto& regiment: sizedRegiment)
+		const auto& type = unitTypes.getNames()[typeIndex];
+		for (const auto& regiment: units.getRemainingRegiments(typeIndex))
 		{
 			// TODO(#737): Make this use the HoI4 data instead of hard-coding
 			if (type == "infantry")
@@ -7,6 +7,7 @@
 #include "HOI4World/MilitaryMappings/MilitaryMappings.h"
 #include "HOI4World/States/HoI4States.h"
 #include "HOI4World/Technologies.h"
+#include "UnitPool.h"
 #include "V2World/Military/Army.h"
 #include <map>
 #include <string>
@@ -17,15 +18,6 @@
 namespace HoI4
 {
 
-
-typedef struct SizedRegiment
-{
-	double unitSize = 0.0;
-	double experience = 0.0;
-	double strength = 0.0;
-} SizedRegiment;
-
-
 class Army
 {
   public:
@@ -46,18 +38,21 @@ class Army
 	[[nodiscard]] const auto& getDivisionLocations() const { return divisionLocations; }
 
   private:
+	typedef struct AvailableTemplate
+	{
+		const DivisionTemplateType& divisionTemplate;
+		std::vector<UnitRequirement> requirements;
+	} AvailableTemplate;
+
 	static std::optional<int> getLocation(std::optional<int> vic2Location,
 		 const Mappers::ProvinceMapper& provinceMapper);
 
-	void convertArmyDivisions(const militaryMappings& theMilitaryMappings,
-		 std::map<std::string, std::vector<SizedRegiment>>& BattalionsAndCompanies,
-		 const technologies& countryTechnologies,
-		 int location);
+	void convertArmyDivisions(const std::vector<AvailableTemplate>& availableTemplates, UnitPool& units, int location);
 
 	bool missingRequiredTechnologies(const DivisionTemplateType& divisionTemplate,
 		 const technologies& countryTechnologies);
 
-	void collectLeftoverEquipment(std::map<std::string, std::vector<SizedRegiment>>& battalionsAndCompanies);
+	void collectLeftoverEquipment(const UnitPool& units, const UnitTypes& unitTypes);
 
 	std::vector<Vic2::Army> sourceArmies;
 	std::vector<DivisionType> divisions;
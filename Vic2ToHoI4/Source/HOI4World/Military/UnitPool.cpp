@@ -0,0 +1,127 @@
+#include "UnitPool.h"
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+
+
+size_t HoI4::UnitTypes::getIndex(const std::string& type)
+{
+	const auto [index, inserted] = indexes.emplace(type, names.size());
+	if (inserted)
+	{
+		names.push_back(type);
+	}
+	return index->second;
+}
+
+
+void HoI4::UnitPool::addRegiment(const size_t type, const SizedRegiment& regiment)
+{
+	if (units.size() <= type)
+	{
+		units.resize(type + 1);
+	}
+
+	units[type].regiments.push_back(regiment);
+	units[type].totalSize += regiment.unitSize;
+	hadUnits = true;
+}
+
+
+void HoI4::UnitPool::addRemainingUnits(const UnitPool& other)
+{
+	for (size_t type = 0; type < other.units.size(); ++type)
+	{
+		const auto& [regiments, firstUnused, unused] = other.units[type];
+		for (auto regiment = regiments.begin() + static_cast<std::ptrdiff_t>(firstUnused); regiment != regiments.end();
+			  ++regiment)
+		{
+			if (regiment->unitSize > 0)
+			{
+				addRegiment(type, *regiment);
+			}
+		}
+	}
+	hadUnits = hadUnits || other.hadUnits;
+}
+
+
+bool HoI4::UnitPool::canSupply(const std::vector<UnitRequirement>& requirements) const
+{
+	for (const auto& requirement: requirements)
+	{
+		auto available = getTotalSize(requirement.type);
+		if (requirement.substitute)
+		{
+			available += getTotalSize(*requirement.substitute);
+		}
+
+		if (available < requirement.amount)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+double HoI4::UnitPool::take(const size_t type, double amount, double& totalExperience, double& totalStrength)
+{
+	if (units.size() <= type)
+	{
+		return amount;
+	}
+
+	auto& [regiments, firstUnused, totalSize] = units[type];
+	while (amount > 0 && firstUnused < regiments.size())
+	{
+		auto& regiment = regiments[firstUnused];
+		if (regiment.unitSize > 0)
+		{
+			const auto decreaseAmount = std::min(regiment.unitSize, amount);
+			regiment.unitSize -= decreaseAmount;
+			totalSize -= decreaseAmount;
+			amount -= decreaseAmount;
+
+			totalExperience += decreaseAmount * regiment.experience;
+			totalStrength += decreaseAmount * regiment.strength;
+		}
+		if (regiment.unitSize <= 0)
+		{
+			++firstUnused;
+		}
+	}
+
+	return amount;
+}
+
+
+std::vector<HoI4::SizedRegiment> HoI4::UnitPool::getRemainingRegiments(const size_t type) const
+{
+	std::vector<SizedRegiment> remainingRegiments;
+	if (type < units.size())
+	{
+		const auto& [regiments, firstUnused, unused] = units[type];
+		std::copy_if(regiments.begin() + static_cast<std::ptrdiff_t>(firstUnused),
+			 regiments.end(),
+			 std::back_inserter(remainingRegiments),
+			 [](const SizedRegiment& regiment) {
+				 return regiment.unitSize > 0;
+			 });
+	}
+
+	return remainingRegiments;
+}
+
+
+double HoI4::UnitPool::getTotalSize(const size_t type) const
+{
+	if (type < units.size())
+	{
+		return units[type].totalSize;
+	}
+
+	return 0.0;
+}
@@ -0,0 +1,84 @@
+#ifndef UNIT_POOL_H
+#define UNIT_POOL_H
+
+
+
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+
+namespace HoI4
+{
+
+typedef struct SizedRegiment
+{
+	double unitSize = 0.0;
+	double experience = 0.0;
+	double strength = 0.0;
+} SizedRegiment;
+
+
+// Numbers HoI4 unit types so that unit pools can keep their units in flat arrays
+class UnitTypes
+{
+  public:
+	size_t getIndex(const std::string& type);
+
+	[[nodiscard]] const auto& getNames() const { return names; }
+
+  private:
+	std::unordered_map<std::string, size_t> indexes;
+	std::vector<std::string> names;
+};
+
+
+typedef struct UnitRequirement
+{
+	size_t type = 0;
+	std::optional<size_t> substitute;
+	int amount = 0;
+} UnitRequirement;
+
+
+// The land units available to form divisions. Each unit type keeps a running total of its size and a cursor past its
+// used-up regiments, so checking a division template costs one comparison per required type and forming divisions
+// walks each regiment once.
+class UnitPool
+{
+  public:
+	void addRegiment(size_t type, const SizedRegiment& regiment);
+	void addRemainingUnits(const UnitPool& other);
+
+	[[nodiscard]] bool canSupply(const std::vector<UnitRequirement>& requirements) const;
+
+	// Uses up to amount units of the given type, from the earliest added regiments first, and returns how much could
+	// not be supplied. The experience and strength of the used units are added to the totals, weighted by how much of
+	// each regiment was used.
+	double take(size_t type, double amount, double& totalExperience, double& totalStrength);
+
+	[[nodiscard]] bool hasHadUnits() const { return hadUnits; }
+	[[nodiscard]] std::vector<SizedRegiment> getRemainingRegiments(size_t type) const;
+	[[nodiscard]] size_t getNumTypes() const { return units.size(); }
+
+  private:
+	typedef struct UnitsOfType
+	{
+		std::vector<SizedRegiment> regiments;
+		size_t firstUnused = 0;
+		double totalSize = 0.0;
+	} UnitsOfType;
+
+	[[nodiscard]] double getTotalSize(size_t type) const;
+
+	std::vector<UnitsOfType> units;
+	bool hadUnits = false;
+};
+
+} // namespace HoI4
+
+
+
+#endif // UNIT_POOL_H
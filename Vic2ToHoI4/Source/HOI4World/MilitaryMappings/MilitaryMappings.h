@@ -26,8 +26,8 @@ class militaryMappings: commonItems::parser
 	[[nodiscard]] auto getMappingsName() const { return mappingsName; }
 	[[nodiscard]] auto& getUnitMappings() const { return *unitMappings; }
 	[[nodiscard]] auto& getMtgUnitMappings() const { return *mtgUnitMappings; }
-	[[nodiscard]] auto getDivisionTemplates() const { return divisionTemplates; }
-	[[nodiscard]] auto getSubstitutes() const { return substitutes; }
+	[[nodiscard]] const auto& getDivisionTemplates() const { return divisionTemplates; }
+	[[nodiscard]] const auto& getSubstitutes() const { return substitutes; }
 
   private:
 	std::string mappingsName = "";
@@ -0,0 +1,56 @@
+#include "NamePool.h"
+#include "RandomStream.h"
+
+
+
+HoI4::NamePool::NamePool(const std::vector<std::string>& newNames)
+{
+	size_t arenaSize = 0;
+	for (const auto& name: newNames)
+	{
+		arenaSize += name.size();
+	}
+
+	auto newArena = std::make_shared<std::string>();
+	newArena->reserve(arenaSize);
+	for (const auto& name: newNames)
+	{
+		newArena->append(name);
+	}
+
+	names.reserve(newNames.size());
+	size_t offset = 0;
+	for (const auto& name: newNames)
+	{
+		names.emplace_back(newArena->data() + offset, name.size());
+		offset += name.size();
+	}
+
+	arena = std::move(newArena);
+}
+
+
+std::optional<std::string_view> HoI4::NamePool::pick(std::string_view key, std::string_view purpose) const
+{
+	if (names.empty())
+	{
+		return std::nullopt;
+	}
+
+	return names[RandomStream{key, purpose}.pick(names.size())];
+}
+
+
+std::optional<std::string_view> HoI4::NamePool::take(std::string_view key, std::string_view purpose)
+{
+	if (names.empty())
+	{
+		return std::nullopt;
+	}
+
+	const auto index = RandomStream{key, purpose}.pick(names.size());
+	const auto name = names[index];
+	names[index] = names.back();
+	names.pop_back();
+	return name;
+}
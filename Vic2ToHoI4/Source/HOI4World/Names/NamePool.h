@@ -0,0 +1,44 @@
+#ifndef NAME_POOL_H
+#define NAME_POOL_H
+
+
+
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+
+namespace HoI4
+{
+
+// The names of one kind for one culture, stored back to back in a single string. Copies share that string, so
+// picking or taking a name never copies the list.
+class NamePool
+{
+  public:
+	NamePool() = default;
+	explicit NamePool(const std::vector<std::string>& newNames);
+
+	[[nodiscard]] std::span<const std::string_view> getNames() const { return names; }
+	[[nodiscard]] bool empty() const { return names.empty(); }
+
+	// The same key and purpose always pick the same name from the same pool.
+	[[nodiscard]] std::optional<std::string_view> pick(std::string_view key, std::string_view purpose) const;
+
+	// Like pick, but the name is removed from the pool by moving the last name into its place.
+	[[nodiscard]] std::optional<std::string_view> take(std::string_view key, std::string_view purpose);
+
+  private:
+	std::shared_ptr<const std::string> arena;
+	std::vector<std::string_view> names;
+};
+
+} // namespace HoI4
+
+
+
+#endif // NAME_POOL_H
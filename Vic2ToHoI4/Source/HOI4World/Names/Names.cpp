@@ -6,6 +6,7 @@
 #include "Log.h"
 #include "OSCompatibilityLayer.h"
 #include "ParserHelpers.h"
+#include "RandomStream.h"
 
 
 
@@ -162,66 +163,89 @@ void HoI4::Names::Factory::checkForNames()
 }
 
 
-std::optional<std::vector<std::string>> HoI4::Names::getMaleNames(const std::string& culture) const
+HoI4::Names::Names(std::map<std::string, std::vector<std::string>>&& maleNames,
+	 std::map<std::string, std::vector<std::string>>&& femaleNames,
+	 std::map<std::string, std::vector<std::string>>&& surnames,
+	 std::map<std::string, std::vector<std::string>>&& femaleSurnames,
+	 std::map<std::string, std::vector<std::string>>&& callsigns,
+	 std::map<std::string, std::vector<std::string>>&& carCompanyNames,
+	 std::map<std::string, std::vector<std::string>>&& weaponCompanyNames,
+	 std::map<std::string, std::vector<std::string>>&& aircraftCompanyNames,
+	 std::map<std::string, std::vector<std::string>>&& navalCompanyNames,
+	 std::map<std::string, std::vector<std::string>>&& industryCompanyNames,
+	 std::map<std::string, std::vector<std::string>>&& electronicCompanyNames,
+	 std::map<std::string, std::vector<std::string>>&& intelligenceAgencyNames):
+	 maleNames(makePools(maleNames)),
+	 femaleNames(makePools(femaleNames)), surnames(makePools(surnames)), femaleSurnames(makePools(femaleSurnames)),
+	 callsigns(makePools(callsigns)), carCompanyNames(makePools(carCompanyNames)),
+	 weaponCompanyNames(makePools(weaponCompanyNames)), aircraftCompanyNames(makePools(aircraftCompanyNames)),
+	 navalCompanyNames(makePools(navalCompanyNames)), industryCompanyNames(makePools(industryCompanyNames)),
+	 electronicCompanyNames(makePools(electronicCompanyNames)),
+	 intelligenceAgencyNames(makePools(intelligenceAgencyNames))
 {
-	if (const auto& namesItr = maleNames.find(culture); namesItr != maleNames.end())
-	{
-		return namesItr->second;
-	}
-
-	return std::nullopt;
 }
 
 
-std::optional<std::vector<std::string>> HoI4::Names::getFemaleNames(const std::string& culture) const
+std::map<std::string, HoI4::NamePool> HoI4::Names::makePools(
+	 const std::map<std::string, std::vector<std::string>>& allNames)
 {
-	if (const auto& namesItr = femaleNames.find(culture); namesItr != femaleNames.end())
+	std::map<std::string, NamePool> pools;
+	for (const auto& [culture, names]: allNames)
 	{
-		return namesItr->second;
+		pools.emplace(culture, NamePool(names));
 	}
 
-	return std::nullopt;
+	return pools;
 }
 
 
-std::optional<std::vector<std::string>> HoI4::Names::getSurnames(const std::string& culture) const
+std::optional<std::span<const std::string_view>> HoI4::Names::getMaleNames(const std::string& culture) const
 {
-	if (const auto& namesItr = surnames.find(culture); namesItr != surnames.end())
-	{
-		return namesItr->second;
-	}
+	return getNames(maleNames, culture);
+}
 
-	return std::nullopt;
+
+std::optional<std::span<const std::string_view>> HoI4::Names::getFemaleNames(const std::string& culture) const
+{
+	return getNames(femaleNames, culture);
 }
 
 
-std::optional<std::vector<std::string>> HoI4::Names::getFemaleSurnames(const std::string& culture) const
+std::optional<std::span<const std::string_view>> HoI4::Names::getSurnames(const std::string& culture) const
 {
-	if (const auto& namesItr = femaleSurnames.find(culture); namesItr != femaleSurnames.end())
-	{
-		return namesItr->second;
-	}
+	return getNames(surnames, culture);
+}
 
-	return std::nullopt;
+
+std::optional<std::span<const std::string_view>> HoI4::Names::getFemaleSurnames(const std::string& culture) const
+{
+	return getNames(femaleSurnames, culture);
 }
 
 
-std::optional<std::vector<std::string>> HoI4::Names::getCallsigns(const std::string& culture) const
+std::optional<std::span<const std::string_view>> HoI4::Names::getCallsigns(const std::string& culture) const
 {
-	if (const auto& namesItr = callsigns.find(culture); namesItr != callsigns.end())
+	return getNames(callsigns, culture);
+}
+
+
+std::optional<std::span<const std::string_view>> HoI4::Names::getNames(const std::map<std::string, NamePool>& allNames,
+	 const std::string& culture)
+{
+	if (const auto& namesItr = allNames.find(culture); namesItr != allNames.end())
 	{
-		return namesItr->second;
+		return namesItr->second.getNames();
 	}
 
 	return std::nullopt;
 }
 
 
-std::optional<std::string> HoI4::Names::getMaleName(const std::string& culture)
+std::optional<std::string_view> HoI4::Names::getMaleName(const std::string& culture, const std::string& key) const
 {
-	if (auto names = getMaleNames(culture); names && !names->empty())
+	if (const auto name = pickName(maleNames, culture, key, "male_name"); name)
 	{
-		return names->at(std::uniform_int_distribution<int>{0, static_cast<int>(names->size() - 1)}(generator));
+		return name;
 	}
 
 	Log(LogLevel::Warning) << "No male name could be found for " << culture;
@@ -229,11 +253,11 @@ std::optional<std::string> HoI4::Names::getMaleName(const std::string& culture)
 }
 
 
-std::optional<std::string> HoI4::Names::getFemaleName(const std::string& culture)
+std::optional<std::string_view> HoI4::Names::getFemaleName(const std::string& culture, const std::string& key) const
 {
-	if (auto names = getFemaleNames(culture); names && !names->empty())
+	if (const auto name = pickName(femaleNames, culture, key, "female_name"); name)
 	{
-		return names->at(std::uniform_int_distribution<int>{0, static_cast<int>(names->size() - 1)}(generator));
+		return name;
 	}
 
 	Log(LogLevel::Warning) << "No female name could be found for " << culture;
@@ -241,11 +265,11 @@ std::optional<std::string> HoI4::Names::getFemaleName(const std::string& culture
 }
 
 
-std::optional<std::string> HoI4::Names::getSurname(const std::string& culture)
+std::optional<std::string_view> HoI4::Names::getSurname(const std::string& culture, const std::string& key) const
 {
-	if (auto names = getSurnames(culture); names && !names->empty())
+	if (const auto name = pickName(surnames, culture, key, "surname"); name)
 	{
-		return names->at(std::uniform_int_distribution<int>{0, static_cast<int>(names->size() - 1)}(generator));
+		return name;
 	}
 
 	Log(LogLevel::Warning) << "No surname could be found for " << culture;
@@ -253,11 +277,11 @@ std::optional<std::string> HoI4::Names::getSurname(const std::string& culture)
 }
 
 
-std::optional<std::string> HoI4::Names::getFemaleSurname(const std::string& culture)
+std::optional<std::string_view> HoI4::Names::getFemaleSurname(const std::string& culture, const std::string& key) const
 {
-	if (auto names = getFemaleSurnames(culture); names && !names->empty())
+	if (const auto name = pickName(femaleSurnames, culture, key, "female_surname"); name)
 	{
-		return names->at(std::uniform_int_distribution<int>{0, static_cast<int>(names->size() - 1)}(generator));
+		return name;
 	}
 
 	Log(LogLevel::Warning) << "No female surname could be found for " << culture;
@@ -265,11 +289,11 @@ std::optional<std::string> HoI4::Names::getFemaleSurname(const std::string& cult
 }
 
 
-std::optional<std::string> HoI4::Names::getCallsign(const std::string& culture)
+std::optional<std::string_view> HoI4::Names::getCallsign(const std::string& culture, const std::string& key) const
 {
-	if (auto names = getCallsigns(culture); names && !names->empty())
+	if (const auto name = pickName(callsigns, culture, key, "callsign"); name)
 	{
-		return names->at(std::uniform_int_distribution<int>{0, static_cast<int>(names->size() - 1)}(generator));
+		return name;
 	}
 
 	Log(LogLevel::Warning) << "No callsign could be found for " << culture;
@@ -277,74 +301,72 @@ std::optional<std::string> HoI4::Names::getCallsign(const std::string& culture)
 }
 
 
-std::optional<std::string> HoI4::Names::takeCarCompanyName(const std::string& culture)
+std::optional<std::string_view> HoI4::Names::pickName(const std::map<std::string, NamePool>& allNames,
+	 const std::string& culture,
+	 const std::string& key,
+	 std::string_view purpose)
 {
-	return takeCompanyName(carCompanyNames, culture);
+	if (const auto namesItr = allNames.find(culture); namesItr != allNames.end())
+	{
+		return namesItr->second.pick(key, purpose);
+	}
+
+	return std::nullopt;
 }
 
 
-std::optional<std::string> HoI4::Names::takeWeaponCompanyName(const std::string& culture)
+std::optional<std::string> HoI4::Names::takeCarCompanyName(const std::string& culture, const std::string& key)
 {
-	return takeCompanyName(weaponCompanyNames, culture);
+	return takeName(carCompanyNames, culture, key, "car_company");
 }
 
 
-std::optional<std::string> HoI4::Names::takeAircraftCompanyName(const std::string& culture)
+std::optional<std::string> HoI4::Names::takeWeaponCompanyName(const std::string& culture, const std::string& key)
 {
-	return takeCompanyName(aircraftCompanyNames, culture);
+	return takeName(weaponCompanyNames, culture, key, "weapon_company");
 }
 
 
-std::optional<std::string> HoI4::Names::takeNavalCompanyName(const std::string& culture)
+std::optional<std::string> HoI4::Names::takeAircraftCompanyName(const std::string& culture, const std::string& key)
 {
-	return takeCompanyName(navalCompanyNames, culture);
+	return takeName(aircraftCompanyNames, culture, key, "aircraft_company");
 }
 
 
-std::optional<std::string> HoI4::Names::takeIndustryCompanyName(const std::string& culture)
+std::optional<std::string> HoI4::Names::takeNavalCompanyName(const std::string& culture, const std::string& key)
 {
-	return takeCompanyName(industryCompanyNames, culture);
+	return takeName(navalCompanyNames, culture, key, "naval_company");
 }
 
 
-std::optional<std::string> HoI4::Names::takeElectronicCompanyName(const std::string& culture)
+std::optional<std::string> HoI4::Names::takeIndustryCompanyName(const std::string& culture, const std::string& key)
 {
-	return takeCompanyName(electronicCompanyNames, culture);
+	return takeName(industryCompanyNames, culture, key, "industry_company");
 }
 
 
-std::optional<std::string> HoI4::Names::takeCompanyName(std::map<std::string, std::vector<std::string>>& companyNames,
-	 const std::string& culture)
+std::optional<std::string> HoI4::Names::takeElectronicCompanyName(const std::string& culture, const std::string& key)
 {
-	if (auto namesItr = companyNames.find(culture); namesItr != companyNames.end())
-	{
-		if (auto& companies = namesItr->second; !companies.empty())
-		{
-			auto companiesIterator = companies.begin();
-			std::advance(companiesIterator,
-				 std::uniform_int_distribution<int>{0, static_cast<int>(companies.size() - 1)}(generator));
-			auto company = *companiesIterator;
-			companies.erase(companiesIterator);
-			return company;
-		}
-	}
+	return takeName(electronicCompanyNames, culture, key, "electronic_company");
+}
 
-	return std::nullopt;
+
+std::optional<std::string> HoI4::Names::takeIntelligenceAgencyName(const std::string& culture, const std::string& key)
+{
+	return takeName(intelligenceAgencyNames, culture, key, "intelligence_agency");
 }
 
 
-std::optional<std::string> HoI4::Names::takeIntelligenceAgencyName(const std::string& culture)
+std::optional<std::string> HoI4::Names::takeName(std::map<std::string, NamePool>& allNames,
+	 const std::string& culture,
+	 const std::string& key,
+	 std::string_view purpose)
 {
-	if (auto namesItr = intelligenceAgencyNames.find(culture); namesItr != intelligenceAgencyNames.end())
+	if (auto namesItr = allNames.find(culture); namesItr != allNames.end())
 	{
-		if (auto& agencies = namesItr->second; !agencies.empty())
+		if (const auto name = namesItr->second.take(key, purpose); name)
 		{
-			auto agenciesIterator = agencies.begin();
-			std::advance(agenciesIterator,
-				 std::uniform_int_distribution<int>{0, static_cast<int>(agencies.size() - 1)}(generator));
-			auto agency = *agenciesIterator;
-			agencies.erase(agenciesIterator);
-			return agency;
+			return std::string(*name);
 		}
 	}
 
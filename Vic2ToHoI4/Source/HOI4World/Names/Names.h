@@ -4,11 +4,13 @@
 
 
 #include "Configuration.h"
+#include "NamePool.h"
 #include "Parser.h"
 #include <map>
 #include <optional>
-#include <random>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 
@@ -32,57 +34,64 @@ class Names
 		 std::map<std::string, std::vector<std::string>>&& navalCompanyNames,
 		 std::map<std::string, std::vector<std::string>>&& industryCompanyNames,
 		 std::map<std::string, std::vector<std::string>>&& electronicCompanyNames,
-		 std::map<std::string, std::vector<std::string>>&& intelligenceAgencyNames):
-		 maleNames(maleNames),
-		 femaleNames(femaleNames), surnames(surnames), femaleSurnames(femaleSurnames), callsigns(callsigns),
-		 carCompanyNames(carCompanyNames), weaponCompanyNames(weaponCompanyNames),
-		 aircraftCompanyNames(aircraftCompanyNames), navalCompanyNames(navalCompanyNames),
-		 industryCompanyNames(industryCompanyNames), electronicCompanyNames(electronicCompanyNames),
-		 intelligenceAgencyNames(intelligenceAgencyNames)
-	{
-	}
-
-	[[nodiscard]] std::optional<std::vector<std::string>> getMaleNames(const std::string& culture) const;
-	[[nodiscard]] std::optional<std::vector<std::string>> getFemaleNames(const std::string& culture) const;
-	[[nodiscard]] std::optional<std::vector<std::string>> getSurnames(const std::string& culture) const;
-	[[nodiscard]] std::optional<std::vector<std::string>> getFemaleSurnames(const std::string& culture) const;
-	[[nodiscard]] std::optional<std::vector<std::string>> getCallsigns(const std::string& culture) const;
-
-	[[nodiscard]] std::optional<std::string> getMaleName(const std::string& culture);
-	[[nodiscard]] std::optional<std::string> getFemaleName(const std::string& culture);
-	[[nodiscard]] std::optional<std::string> getSurname(const std::string& culture);
-	[[nodiscard]] std::optional<std::string> getFemaleSurname(const std::string& culture);
-	[[nodiscard]] std::optional<std::string> getCallsign(const std::string& culture);
-
-	[[nodiscard]] std::optional<std::string> takeCarCompanyName(const std::string& culture);
-	[[nodiscard]] std::optional<std::string> takeWeaponCompanyName(const std::string& culture);
-	[[nodiscard]] std::optional<std::string> takeAircraftCompanyName(const std::string& culture);
-	[[nodiscard]] std::optional<std::string> takeNavalCompanyName(const std::string& culture);
-	[[nodiscard]] std::optional<std::string> takeIndustryCompanyName(const std::string& culture);
-	[[nodiscard]] std::optional<std::string> takeElectronicCompanyName(const std::string& culture);
-
-	[[nodiscard]] std::optional<std::string> takeIntelligenceAgencyName(const std::string& culture);
+		 std::map<std::string, std::vector<std::string>>&& intelligenceAgencyNames);
+
+	// the views stay valid for as long as these names exist
+	[[nodiscard]] std::optional<std::span<const std::string_view>> getMaleNames(const std::string& culture) const;
+	[[nodiscard]] std::optional<std::span<const std::string_view>> getFemaleNames(const std::string& culture) const;
+	[[nodiscard]] std::optional<std::span<const std::string_view>> getSurnames(const std::string& culture) const;
+	[[nodiscard]] std::optional<std::span<const std::string_view>> getFemaleSurnames(const std::string& culture) const;
+	[[nodiscard]] std::optional<std::span<const std::string_view>> getCallsigns(const std::string& culture) const;
+
+	// key names the entity being named (such as a country tag). The same culture and key always give the same name.
+	[[nodiscard]] std::optional<std::string_view> getMaleName(const std::string& culture, const std::string& key) const;
+	[[nodiscard]] std::optional<std::string_view> getFemaleName(const std::string& culture,
+		 const std::string& key) const;
+	[[nodiscard]] std::optional<std::string_view> getSurname(const std::string& culture, const std::string& key) const;
+	[[nodiscard]] std::optional<std::string_view> getFemaleSurname(const std::string& culture,
+		 const std::string& key) const;
+	[[nodiscard]] std::optional<std::string_view> getCallsign(const std::string& culture, const std::string& key) const;
+
+	// Taken names are never given out again, so these depend on what has already been taken and must be called in a
+	// fixed order.
+	[[nodiscard]] std::optional<std::string> takeCarCompanyName(const std::string& culture, const std::string& key);
+	[[nodiscard]] std::optional<std::string> takeWeaponCompanyName(const std::string& culture, const std::string& key);
+	[[nodiscard]] std::optional<std::string> takeAircraftCompanyName(const std::string& culture, const std::string& key);
+	[[nodiscard]] std::optional<std::string> takeNavalCompanyName(const std::string& culture, const std::string& key);
+	[[nodiscard]] std::optional<std::string> takeIndustryCompanyName(const std::string& culture, const std::string& key);
+	[[nodiscard]] std::optional<std::string> takeElectronicCompanyName(const std::string& culture,
+		 const std::string& key);
+
+	[[nodiscard]] std::optional<std::string> takeIntelligenceAgencyName(const std::string& culture,
+		 const std::string& key);
 
   private:
-	std::optional<std::string> takeCompanyName(std::map<std::string, std::vector<std::string>>& companyNames,
+	static std::map<std::string, NamePool> makePools(const std::map<std::string, std::vector<std::string>>& allNames);
+	static std::optional<std::span<const std::string_view>> getNames(const std::map<std::string, NamePool>& allNames,
 		 const std::string& culture);
-
-	std::map<std::string, std::vector<std::string>> maleNames;
-	std::map<std::string, std::vector<std::string>> femaleNames;
-	std::map<std::string, std::vector<std::string>> surnames;
-	std::map<std::string, std::vector<std::string>> femaleSurnames;
-	std::map<std::string, std::vector<std::string>> callsigns;
-
-	std::map<std::string, std::vector<std::string>> carCompanyNames;
-	std::map<std::string, std::vector<std::string>> weaponCompanyNames;
-	std::map<std::string, std::vector<std::string>> aircraftCompanyNames;
-	std::map<std::string, std::vector<std::string>> navalCompanyNames;
-	std::map<std::string, std::vector<std::string>> industryCompanyNames;
-	std::map<std::string, std::vector<std::string>> electronicCompanyNames;
-
-	std::map<std::string, std::vector<std::string>> intelligenceAgencyNames;
-
-	std::mt19937 generator;
+	static std::optional<std::string_view> pickName(const std::map<std::string, NamePool>& allNames,
+		 const std::string& culture,
+		 const std::string& key,
+		 std::string_view purpose);
+	static std::optional<std::string> takeName(std::map<std::string, NamePool>& allNames,
+		 const std::string& culture,
+		 const std::string& key,
+		 std::string_view purpose);
+
+	std::map<std::string, NamePool> maleNames;
+	std::map<std::string, NamePool> femaleNames;
+	std::map<std::string, NamePool> surnames;
+	std::map<std::string, NamePool> femaleSurnames;
+	std::map<std::string, NamePool> callsigns;
+
+	std::map<std::string, NamePool> carCompanyNames;
+	std::map<std::string, NamePool> weaponCompanyNames;
+	std::map<std::string, NamePool> aircraftCompanyNames;
+	std::map<std::string, NamePool> navalCompanyNames;
+	std::map<std::string, NamePool> industryCompanyNames;
+	std::map<std::string, NamePool> electronicCompanyNames;
+
+	std::map<std::string, NamePool> intelligenceAgencyNames;
 };
 
 
@@ -23,7 +23,7 @@ class LegacyShipTypeNames
 		[[nodiscard]] std::string_view getType() const { return type; }
 		[[nodiscard]] std::string_view getPrefix() const { return ""; }
 		[[nodiscard]] std::string_view getGenericName() const { return genericName; }
-		[[nodiscard]] std::vector<std::string> getNames() const { return names; }
+		[[nodiscard]] const std::vector<std::string>& getNames() const { return names; }
 
 	private:
 		std::string type;
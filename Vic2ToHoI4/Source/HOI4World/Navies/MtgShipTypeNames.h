@@ -33,10 +33,10 @@ class MtgShipTypeNames
 
 	[[nodiscard]] std::string_view getType() const { return type; }
 	[[nodiscard]] std::string_view getTheme() const { return theme; }
-	[[nodiscard]] std::set<std::string> getShipTypes() const { return shipTypes; }
+	[[nodiscard]] const std::set<std::string>& getShipTypes() const { return shipTypes; }
 	[[nodiscard]] std::string_view getPrefix() const { return ""; }
 	[[nodiscard]] std::string_view getFallbackName() const { return fallbackName; }
-	[[nodiscard]] std::vector<std::string> getNames() const { return names; }
+	[[nodiscard]] const std::vector<std::string>& getNames() const { return names; }
 
 	private:
 	std::string type;
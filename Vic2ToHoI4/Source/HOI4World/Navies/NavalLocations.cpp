@@ -0,0 +1,93 @@
+#include "NavalLocations.h"
+
+
+
+HoI4::NavalLocations::NavalLocations(const std::map<int, State>& states,
+	 const std::map<int, int>& provinceToStateIDMap,
+	 const ProvinceDefinitions& provinceDefinitions)
+{
+	if (const auto& allSeaProvinces = provinceDefinitions.getSeaProvinces(); !allSeaProvinces.empty())
+	{
+		seaProvinces.resize(*allSeaProvinces.rbegin() + 1, false);
+		for (const auto seaProvince: allSeaProvinces)
+		{
+			seaProvinces[seaProvince] = true;
+		}
+	}
+
+	std::map<int, int> stateMainNavalBases;
+	for (const auto& [stateID, state]: states)
+	{
+		if (const auto mainNavalLocation = state.getMainNavalLocation(); mainNavalLocation)
+		{
+			stateMainNavalBases.emplace(stateID, *mainNavalLocation);
+			backupNavalLocations[state.getOwner()] = *mainNavalLocation;
+		}
+	}
+
+	if (!provinceToStateIDMap.empty())
+	{
+		mainNavalBases.resize(provinceToStateIDMap.rbegin()->first + 1, 0);
+		for (const auto& [province, stateID]: provinceToStateIDMap)
+		{
+			if (const auto mainNavalBase = stateMainNavalBases.find(stateID); mainNavalBase != stateMainNavalBases.end())
+			{
+				mainNavalBases[province] = mainNavalBase->second;
+			}
+		}
+	}
+}
+
+
+int HoI4::NavalLocations::getBackupNavalLocation(const std::string& tag) const
+{
+	if (const auto backupNavalLocation = backupNavalLocations.find(tag);
+		 backupNavalLocation != backupNavalLocations.end())
+	{
+		return backupNavalLocation->second;
+	}
+
+	return 0;
+}
+
+
+std::tuple<int, int> HoI4::NavalLocations::getLocationAndBase(std::optional<int> vic2Location,
+	 int backupNavalLocation,
+	 const Mappers::ProvinceMapper& provinceMapper) const
+{
+	if (vic2Location == std::nullopt)
+	{
+		return {backupNavalLocation, backupNavalLocation};
+	}
+
+	for (const auto possibleProvince: provinceMapper.getVic2ToHoI4ProvinceMapping(*vic2Location))
+	{
+		if (isSeaProvince(possibleProvince))
+		{
+			return {possibleProvince, backupNavalLocation};
+		}
+		if (const auto mainNavalBase = getMainNavalBase(possibleProvince); mainNavalBase != 0)
+		{
+			return {mainNavalBase, mainNavalBase};
+		}
+	}
+
+	return {backupNavalLocation, backupNavalLocation};
+}
+
+
+bool HoI4::NavalLocations::isSeaProvince(int province) const
+{
+	return province >= 0 && static_cast<size_t>(province) < seaProvinces.size() && seaProvinces[province];
+}
+
+
+int HoI4::NavalLocations::getMainNavalBase(int province) const
+{
+	if (province < 0 || static_cast<size_t>(province) >= mainNavalBases.size())
+	{
+		return 0;
+	}
+
+	return mainNavalBases[province];
+}
@@ -0,0 +1,51 @@
+#ifndef NAVAL_LOCATIONS_H
+#define NAVAL_LOCATIONS_H
+
+
+
+#include "HOI4World/ProvinceDefinitions.h"
+#include "HOI4World/States/HoI4State.h"
+#include "Mappers/Provinces/ProvinceMapper.h"
+#include <map>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+
+
+namespace HoI4
+{
+
+// Where fleets can be placed, worked out once from the final states so that placing each fleet is a few array lookups
+class NavalLocations
+{
+  public:
+	NavalLocations(const std::map<int, State>& states,
+		 const std::map<int, int>& provinceToStateIDMap,
+		 const ProvinceDefinitions& provinceDefinitions);
+
+	// the main naval base of the last state (by ID) the country owns that has one, or 0 if there is none
+	[[nodiscard]] int getBackupNavalLocation(const std::string& tag) const;
+
+	// the location and base for a fleet in the given Vic2 province: the first mapped sea province (based at the backup
+	// location), or the main naval base of the first mapped province's state that has one
+	[[nodiscard]] std::tuple<int, int> getLocationAndBase(std::optional<int> vic2Location,
+		 int backupNavalLocation,
+		 const Mappers::ProvinceMapper& provinceMapper) const;
+
+  private:
+	[[nodiscard]] bool isSeaProvince(int province) const;
+	[[nodiscard]] int getMainNavalBase(int province) const;
+
+	std::vector<bool> seaProvinces;  // indexed by HoI4 province
+	std::vector<int> mainNavalBases; // indexed by HoI4 province, 0 if its state has no naval base
+	std::unordered_map<std::string, int> backupNavalLocations;
+};
+
+} // namespace HoI4
+
+
+
+#endif // NAVAL_LOCATIONS_H
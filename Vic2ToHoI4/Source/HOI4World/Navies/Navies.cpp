@@ -1,5 +1,4 @@
 #include "Navies.h"
-#include "HOI4World/ProvinceDefinitions.h"
 #include "Log.h"
 #include "Mappers/Provinces/ProvinceMapper.h"
 
@@ -10,20 +9,14 @@ HoI4::Navies::Navies(const std::vector<Vic2::Army>& srcArmies,
 	 const UnitMappings& unitMap,
 	 const MtgUnitMappings& mtgUnitMap,
 	 const ShipVariants& theShipVariants,
-	 const std::map<int, int>& provinceToStateIDMap,
-	 std::map<int, State> states,
+	 const NavalLocations& navalLocations,
 	 const std::string& tag,
-	 const ProvinceDefinitions& provinceDefinitions,
 	 const Mappers::ProvinceMapper& provinceMapper)
 {
-	for (auto army: srcArmies)
+	for (const auto& army: srcArmies)
 	{
-		auto [navalLocation, base] = getLocationAndBase(army.getLocation(),
-			 backupNavalLocation,
-			 provinceMapper,
-			 provinceDefinitions,
-			 provinceToStateIDMap,
-			 states);
+		auto [navalLocation, base] =
+			 navalLocations.getLocationAndBase(army.getLocation(), backupNavalLocation, provinceMapper);
 
 		LegacyNavy newLegacyNavy(army.getName(), navalLocation, base);
 		MtgNavy newMtgNavy(army.getName(), navalLocation, base);
@@ -78,38 +71,4 @@ HoI4::Navies::Navies(const std::vector<Vic2::Army>& srcArmies,
 			mtgNavies.push_back(newMtgNavy);
 		}
 	}
-}
-
-
-std::tuple<int, int> HoI4::Navies::getLocationAndBase(std::optional<int> vic2Location,
-	 int backupNavalLocation,
-	 const Mappers::ProvinceMapper& provinceMapper,
-	 const ProvinceDefinitions& provinceDefinitions,
-	 const std::map<int, int>& provinceToStateIDMap,
-	 std::map<int, State> states)
-{
-	if (vic2Location == std::nullopt)
-	{
-		return {backupNavalLocation, backupNavalLocation};
-	}
-
-	for (auto possibleProvince: provinceMapper.getVic2ToHoI4ProvinceMapping(*vic2Location))
-	{
-		if (provinceDefinitions.isSeaProvince(possibleProvince))
-		{
-			return {possibleProvince, backupNavalLocation};
-		}
-		if (auto stateID = provinceToStateIDMap.find(possibleProvince); stateID != provinceToStateIDMap.end())
-		{
-			if (auto state = states.find(stateID->second); state != states.end())
-			{
-				if (auto mainNavalLocation = state->second.getMainNavalLocation(); mainNavalLocation)
-				{
-					return {*mainNavalLocation, *mainNavalLocation};
-				}
-			}
-		}
-	}
-
-	return {backupNavalLocation, backupNavalLocation};
 }
\ No newline at end of file
@@ -5,13 +5,11 @@
 
 #include "HOI4World/MilitaryMappings/MtgUnitMappings.h"
 #include "HOI4World/MilitaryMappings/UnitMappings.h"
-#include "HOI4World/ProvinceDefinitions.h"
 #include "HOI4World/ShipTypes/ShipVariants.h"
-#include "HOI4World/States/HoI4State.h"
 #include "LegacyNavy.h"
 #include "MtgNavy.h"
+#include "NavalLocations.h"
 #include "V2World/Military/Army.h"
-#include <map>
 #include <string>
 #include <vector>
 
@@ -28,10 +26,8 @@ class Navies
 		 const UnitMappings& unitMap,
 		 const MtgUnitMappings& mtgUnitMap,
 		 const ShipVariants& theShipVariants,
-		 const std::map<int, int>& provinceToStateIDMap,
-		 std::map<int, State> states,
+		 const NavalLocations& navalLocations,
 		 const std::string& tag,
-		 const ProvinceDefinitions& provinceDefinitions,
 		 const Mappers::ProvinceMapper& provinceMapper);
 
 	Navies() = delete;
@@ -45,13 +41,6 @@ class Navies
 	[[nodiscard]] const auto& getMtgNavies() const { return mtgNavies; }
 
   private:
-	std::tuple<int, int> getLocationAndBase(std::optional<int> vic2Location,
-		 int backupNavalLocation,
-		 const Mappers::ProvinceMapper& provinceMapper,
-		 const ProvinceDefinitions& provinceDefinitions,
-		 const std::map<int, int>& provinceToStateIDMap,
-		 std::map<int, State> states);
-
 	std::vector<LegacyNavy> legacyNavies;
 	std::vector<MtgNavy> mtgNavies;
 };
@@ -15,8 +15,8 @@ namespace HoI4
 class NavyNames
 {
 	public:
-		[[nodiscard]] std::set<LegacyShipTypeNames> getLegacyShipTypeNames() const { return legacyShipTypeNames; }
-		[[nodiscard]] std::set<MtgShipTypeNames> getMtgShipTypeNames() const { return mtgShipTypeNames; }
+		[[nodiscard]] const std::set<LegacyShipTypeNames>& getLegacyShipTypeNames() const { return legacyShipTypeNames; }
+		[[nodiscard]] const std::set<MtgShipTypeNames>& getMtgShipTypeNames() const { return mtgShipTypeNames; }
 
 		void addLegacyShipTypeNames(const LegacyShipTypeNames& newShipTypeNames)
 		{
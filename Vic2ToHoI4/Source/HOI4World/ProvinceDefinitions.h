@@ -26,6 +26,7 @@ class ProvinceDefinitions
 	}
 
 	[[nodiscard]] const auto& getLandProvinces() const { return landProvinces; }
+	[[nodiscard]] const auto& getSeaProvinces() const { return seaProvinces; }
 	[[nodiscard]] bool isLandProvince(const int province) const { return (landProvinces.contains(province)); }
 	[[nodiscard]] bool isSeaProvince(const int province) const { return (seaProvinces.contains(province)); }
 
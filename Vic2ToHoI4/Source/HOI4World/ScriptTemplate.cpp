@@ -0,0 +1,124 @@
+#include "ScriptTemplate.h"
+
+
+
+HoI4::ScriptTemplate::ScriptTemplate(std::string_view script, const std::vector<std::string>& slotNames):
+	 script(script), slotNames(slotNames)
+{
+	// where each slot next occurs, refreshed only once the scan has moved past it
+	std::vector<size_t> nextOccurrences;
+	nextOccurrences.reserve(slotNames.size());
+	for (const auto& slotName: slotNames)
+	{
+		nextOccurrences.push_back(this->script.find(slotName));
+	}
+
+	size_t position = 0;
+	while (true)
+	{
+		std::optional<size_t> nextSlot;
+		for (size_t slot = 0; slot < slotNames.size(); ++slot)
+		{
+			if (slotNames[slot].empty())
+			{
+				continue;
+			}
+			if (nextOccurrences[slot] != std::string::npos && nextOccurrences[slot] < position)
+			{
+				nextOccurrences[slot] = this->script.find(slotNames[slot], position);
+			}
+			if (nextOccurrences[slot] == std::string::npos)
+			{
+				continue;
+			}
+
+			if (!nextSlot || nextOccurrences[slot] < nextOccurrences[*nextSlot] ||
+				 (nextOccurrences[slot] == nextOccurrences[*nextSlot] &&
+					  slotNames[slot].size() > slotNames[*nextSlot].size()))
+			{
+				nextSlot = slot;
+			}
+		}
+
+		if (!nextSlot)
+		{
+			segments.push_back({position, this->script.size() - position, std::nullopt});
+			break;
+		}
+
+		const auto slotStart = nextOccurrences[*nextSlot];
+		segments.push_back({position, slotStart - position, nextSlot});
+		position = slotStart + slotNames[*nextSlot].size();
+	}
+}
+
+
+std::string HoI4::ScriptTemplate::render(const Bindings& bindings) const
+{
+	std::vector<const std::optional<std::string>*> boundValues(slotNames.size(), nullptr);
+	for (size_t slot = 0; slot < slotNames.size(); ++slot)
+	{
+		if (const auto& binding = bindings.find(slotNames[slot]); binding != bindings.end())
+		{
+			boundValues[slot] = &binding->second;
+		}
+	}
+
+	size_t renderedSize = 0;
+	for (const auto& segment: segments)
+	{
+		renderedSize += segment.literalLength;
+		if (!segment.slot)
+		{
+			continue;
+		}
+		if (const auto* boundValue = boundValues[*segment.slot]; boundValue == nullptr)
+		{
+			renderedSize += slotNames[*segment.slot].size();
+		}
+		else if (*boundValue)
+		{
+			renderedSize += (*boundValue)->size();
+		}
+	}
+
+	std::string rendered;
+	rendered.reserve(renderedSize);
+
+	// where the last removed line was cut, so a second slot on the same line does not also remove the line before it
+	std::optional<size_t> lastRemoval;
+	for (const auto& segment: segments)
+	{
+		rendered.append(script, segment.literalStart, segment.literalLength);
+		if (!segment.slot)
+		{
+			continue;
+		}
+
+		const auto* boundValue = boundValues[*segment.slot];
+		if (boundValue == nullptr)
+		{
+			rendered += slotNames[*segment.slot];
+		}
+		else if (*boundValue)
+		{
+			rendered += **boundValue;
+		}
+		else if (const auto lineStart = rendered.rfind('\n');
+					lastRemoval && (lineStart == std::string::npos || lineStart < *lastRemoval))
+		{
+			rendered.resize(*lastRemoval);
+		}
+		else if (lineStart != std::string::npos)
+		{
+			rendered.resize(lineStart);
+			lastRemoval = lineStart;
+		}
+		else
+		{
+			rendered += slotNames[*segment.slot];
+		}
+	}
+
+	return rendered;
+}
@@ -0,0 +1,48 @@
+#ifndef SCRIPT_TEMPLATE_H
+#define SCRIPT_TEMPLATE_H
+
+
+
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+
+namespace HoI4
+{
+
+// A script body split once into literal text and named slots (placeholders such as "$TARGET", "#COMMUNISM" or
+// "var:neighbor_war_defender"), so that it can be rendered any number of times with different bindings.
+class ScriptTemplate
+{
+  public:
+	// a slot bound to nullopt has its line removed, from the preceding newline up to the end of the slot
+	using Bindings = std::map<std::string, std::optional<std::string>, std::less<>>;
+
+	ScriptTemplate(std::string_view script, const std::vector<std::string>& slotNames);
+
+	// Slots without a binding are written back as they were. Bound values are written as-is and are not searched
+	// for further slots.
+	[[nodiscard]] std::string render(const Bindings& bindings) const;
+
+  private:
+	typedef struct Segment
+	{
+		size_t literalStart = 0;
+		size_t literalLength = 0;
+		std::optional<size_t> slot; // the slot that follows the literal text, if any
+	} Segment;
+
+	std::string script;
+	std::vector<std::string> slotNames;
+	std::vector<Segment> segments;
+};
+
+} // namespace HoI4
+
+
+
+#endif // SCRIPT_TEMPLATE_H
@@ -0,0 +1,55 @@
+#include "ScriptWriter.h"
+
+
+
+namespace
+{
+
+std::string& threadBuffer()
+{
+	thread_local std::string buffer;
+	return buffer;
+}
+
+} // namespace
+
+
+
+HoI4::ScriptWriter::ScriptWriter(const int baseIndentation):
+	 buffer(threadBuffer()), start(buffer.size()), baseIndentation(baseIndentation)
+{
+}
+
+
+HoI4::ScriptWriter::~ScriptWriter()
+{
+	buffer.resize(start);
+}
+
+
+HoI4::ScriptWriter& HoI4::ScriptWriter::close()
+{
+	--depth;
+	return line('}');
+}
+
+
+std::string HoI4::ScriptWriter::finish()
+{
+	std::string block(buffer, start);
+	buffer.resize(start);
+	depth = 0;
+	return block;
+}
+
+
+void HoI4::ScriptWriter::startLine()
+{
+	if (buffer.size() == start)
+	{
+		return;
+	}
+
+	buffer.push_back('\n');
+	buffer.append(static_cast<size_t>(baseIndentation + depth), '\t');
+}
@@ -0,0 +1,90 @@
+#ifndef SCRIPT_WRITER_H
+#define SCRIPT_WRITER_H
+
+
+
+#include <charconv>
+#include <concepts>
+#include <string>
+#include <string_view>
+
+
+
+namespace HoI4
+{
+
+// Builds one block of script, such as a trigger, a mean time to happen or an effect, a line at a time. The first line
+// follows whatever introduced the block and so is not indented; later lines are indented by the block's base
+// indentation plus one tab for every open brace. No newline follows the last line, as the block's owner writes that.
+//
+// All writers on a thread append to one buffer that keeps its capacity between blocks, so a finished block costs a
+// single allocation of exactly its size. Several writers can be alive at once, but only the most recently started
+// block may be written to until it is finished.
+class ScriptWriter
+{
+  public:
+	explicit ScriptWriter(int baseIndentation);
+	~ScriptWriter();
+
+	ScriptWriter(const ScriptWriter&) = delete;
+	ScriptWriter& operator=(const ScriptWriter&) = delete;
+	ScriptWriter(ScriptWriter&&) = delete;
+	ScriptWriter& operator=(ScriptWriter&&) = delete;
+
+	// Each piece is either text or an integer, written one after the other on a single line.
+	template <typename... Pieces> ScriptWriter& line(const Pieces&... pieces)
+	{
+		startLine();
+		(append(pieces), ...);
+		return *this;
+	}
+
+	// writes "key = {", or "= {" if there is no key, and indents the lines that follow it. The key is made of pieces
+	// as in line().
+	template <typename... Pieces> ScriptWriter& open(const Pieces&... key)
+	{
+		if constexpr (sizeof...(Pieces) == 0)
+		{
+			line("= {");
+		}
+		else
+		{
+			line(key..., " = {");
+		}
+		++depth;
+		return *this;
+	}
+	ScriptWriter& close();
+
+	// writes "key = value", the value made of pieces as in line()
+	template <typename... Pieces> ScriptWriter& set(std::string_view key, const Pieces&... pieces)
+	{
+		return line(key, " = ", pieces...);
+	}
+
+	// returns the block and empties the writer so that it can build another at the same indentation
+	[[nodiscard]] std::string finish();
+
+  private:
+	void startLine();
+
+	void append(std::string_view text) { buffer.append(text); }
+	void append(char character) { buffer.push_back(character); }
+	template <std::integral Integer> void append(Integer number)
+	{
+		char digits[24];
+		const auto [end, error] = std::to_chars(std::begin(digits), std::end(digits), number);
+		buffer.append(digits, end);
+	}
+
+	std::string& buffer;
+	size_t start;
+	int baseIndentation;
+	int depth = 0;
+};
+
+} // namespace HoI4
+
+
+
+#endif // SCRIPT_WRITER_H
@@ -42,25 +42,3 @@ HoI4::LegacyShipVariant::LegacyShipVariant(std::istream& theStream)
 	parseStream(theStream);
 	clearRegisteredKeywords();
 }
-
-
-bool HoI4::LegacyShipVariant::isValidVariant(const technologies& ownedTechs) const
-{
-	for (const auto& requiredTechnology: requiredTechnologies)
-	{
-		if (!ownedTechs.hasTechnology(requiredTechnology))
-		{
-			return false;
-		}
-	}
-
-	for (const auto& blockingTechnology: blockingTechnologies)
-	{
-		if (ownedTechs.hasTechnology(blockingTechnology))
-		{
-			return false;
-		}
-	}
-
-	return true;
-}
@@ -3,7 +3,6 @@
 
 
 
-#include "HOI4World/Technologies.h"
 #include "Parser.h"
 #include <map>
 #include <set>
@@ -20,8 +19,8 @@ class LegacyShipVariant: commonItems::parser
 	LegacyShipVariant(std::istream& theStream);
 
 	[[nodiscard]] const auto& getName() const { return name; }
-
-	[[nodiscard]] bool isValidVariant(const technologies& ownedTechs) const;
+	[[nodiscard]] const auto& getRequiredTechnologies() const { return requiredTechnologies; }
+	[[nodiscard]] const auto& getBlockingTechnologies() const { return blockingTechnologies; }
 
 	friend std::ostream& operator<<(std::ostream& output, const LegacyShipVariant& theVariant);
 
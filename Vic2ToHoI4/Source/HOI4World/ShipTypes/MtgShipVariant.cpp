@@ -50,7 +50,6 @@ HoI4::MtgShipVariant::MtgShipVariant(const MtgShipVariant& source): parser(sourc
 {
 	name = source.name;
 	type = source.type;
-	owningCountryTag = source.owningCountryTag;
 	nameGroup = source.nameGroup;
 	modules = std::make_unique<shipModules>(*source.modules);
 	obsolete = source.obsolete;
@@ -64,7 +63,6 @@ HoI4::MtgShipVariant& HoI4::MtgShipVariant::operator=(const MtgShipVariant& sour
 {
 	name = source.name;
 	type = source.type;
-	owningCountryTag = source.owningCountryTag;
 	nameGroup = source.nameGroup;
 	modules = std::make_unique<shipModules>(*source.modules);
 	obsolete = source.obsolete;
@@ -73,32 +71,4 @@ HoI4::MtgShipVariant& HoI4::MtgShipVariant::operator=(const MtgShipVariant& sour
 	blockingTechnologies = source.blockingTechnologies;
 
 	return *this;
-}
-
-
-void HoI4::MtgShipVariant::setOwningCountryTag(const std::string& tag)
-{
-	owningCountryTag = tag;
-}
-
-
-bool HoI4::MtgShipVariant::isValidVariant(const technologies& ownedTechs) const
-{
-	for (const auto& requiredTechnology: requiredTechnologies)
-	{
-		if (!ownedTechs.hasTechnology(requiredTechnology))
-		{
-			return false;
-		}
-	}
-
-	for (const auto& blockingTechnology: blockingTechnologies)
-	{
-		if (ownedTechs.hasTechnology(blockingTechnology))
-		{
-			return false;
-		}
-	}
-
-	return true;
 }
\ No newline at end of file
@@ -3,7 +3,6 @@
 
 
 
-#include "HOI4World/Technologies.h"
 #include "Parser.h"
 #include "ShipModules.h"
 #include <memory>
@@ -27,18 +26,18 @@ class MtgShipVariant: commonItems::parser
 	MtgShipVariant(MtgShipVariant&&) = default;
 	MtgShipVariant& operator=(MtgShipVariant&&) = default;
 
-	void setOwningCountryTag(const std::string& tag);
-
-	[[nodiscard]] bool isValidVariant(const technologies& ownedTechs) const;
-
-	[[nodiscard]] std::string getName() const { return name; }
+	[[nodiscard]] const auto& getName() const { return name; }
+	[[nodiscard]] const auto& getRequiredTechnologies() const { return requiredTechnologies; }
+	[[nodiscard]] const auto& getBlockingTechnologies() const { return blockingTechnologies; }
 
 	friend std::ostream& operator<<(std::ostream& output, const MtgShipVariant& theVariant);
+	friend void outputMtgShipVariant(std::ostream& output,
+		 const MtgShipVariant& theVariant,
+		 const std::string& owningCountryTag);
 
   private:
 	std::string name;
 	std::string type;
-	std::string owningCountryTag;
 	std::string nameGroup;
 	std::unique_ptr<shipModules> modules;
 	bool obsolete = false;
@@ -1,21 +1,156 @@
 #include "PossibleShipVariants.h"
 #include "CommonRegexes.h"
 #include "ParserHelpers.h"
+#include <algorithm>
 
 
 
 HoI4::PossibleShipVariants::PossibleShipVariants(std::istream& theStream)
 {
-	registerKeyword("mtg_ship_type", [this](std::istream& theStream) {
-		const MtgShipVariant theShipVariant(theStream);
-		mtgVariants.push_back(theShipVariant);
+	std::vector<MtgShipVariant> parsedMtgVariants;
+	std::vector<LegacyShipVariant> parsedLegacyVariants;
+	registerKeyword("mtg_ship_type", [&parsedMtgVariants](std::istream& theStream) {
+		parsedMtgVariants.emplace_back(theStream);
 	});
-	registerKeyword("legacy_ship_type", [this](std::istream& theStream) {
-		const LegacyShipVariant theShipVariant(theStream);
-		legacyVariants.push_back(theShipVariant);
+	registerKeyword("legacy_ship_type", [&parsedLegacyVariants](std::istream& theStream) {
+		parsedLegacyVariants.emplace_back(theStream);
 	});
 	registerRegex(commonItems::catchallRegex, commonItems::ignoreItem);
 
 	parseStream(theStream);
 	clearRegisteredKeywords();
-}
\ No newline at end of file
+
+	for (const auto& variant: parsedMtgVariants)
+	{
+		for (const auto& technology: variant.getRequiredTechnologies())
+		{
+			technologyBits.emplace(technology, technologyBits.size());
+		}
+		for (const auto& technology: variant.getBlockingTechnologies())
+		{
+			technologyBits.emplace(technology, technologyBits.size());
+		}
+	}
+	for (const auto& variant: parsedLegacyVariants)
+	{
+		for (const auto& technology: variant.getRequiredTechnologies())
+		{
+			technologyBits.emplace(technology, technologyBits.size());
+		}
+		for (const auto& technology: variant.getBlockingTechnologies())
+		{
+			technologyBits.emplace(technology, technologyBits.size());
+		}
+	}
+	maskSize = (technologyBits.size() + 63) / 64;
+
+	mtgRequirements = compileRequirements(parsedMtgVariants);
+	legacyRequirements = compileRequirements(parsedLegacyVariants);
+	mtgNameOrder = determineNameOrder(parsedMtgVariants);
+	legacyNameOrder = determineNameOrder(parsedLegacyVariants);
+
+	mtgVariants = std::make_shared<const std::vector<MtgShipVariant>>(std::move(parsedMtgVariants));
+	legacyVariants = std::make_shared<const std::vector<LegacyShipVariant>>(std::move(parsedLegacyVariants));
+}
+
+
+template <class Variant>
+std::vector<HoI4::PossibleShipVariants::TechnologyRequirements> HoI4::PossibleShipVariants::compileRequirements(
+	 const std::vector<Variant>& variants)
+{
+	std::vector<TechnologyRequirements> allRequirements;
+	allRequirements.reserve(variants.size());
+	for (const auto& variant: variants)
+	{
+		TechnologyRequirements requirements{std::vector<uint64_t>(maskSize, 0), std::vector<uint64_t>(maskSize, 0)};
+		for (const auto& technology: variant.getRequiredTechnologies())
+		{
+			const auto bit = technologyBits.at(technology);
+			requirements.required[bit / 64] |= uint64_t{1} << (bit % 64);
+		}
+		for (const auto& technology: variant.getBlockingTechnologies())
+		{
+			const auto bit = technologyBits.at(technology);
+			requirements.blocking[bit / 64] |= uint64_t{1} << (bit % 64);
+		}
+		allRequirements.push_back(std::move(requirements));
+	}
+
+	return allRequirements;
+}
+
+
+template <class Variant>
+std::vector<size_t> HoI4::PossibleShipVariants::determineNameOrder(const std::vector<Variant>& variants)
+{
+	std::vector<size_t> nameOrder(variants.size());
+	for (size_t i = 0; i < variants.size(); ++i)
+	{
+		nameOrder[i] = i;
+	}
+	std::stable_sort(nameOrder.begin(), nameOrder.end(), [&variants](size_t a, size_t b) {
+		return variants[a].getName() < variants[b].getName();
+	});
+
+	return nameOrder;
+}
+
+
+std::vector<uint64_t> HoI4::PossibleShipVariants::getTechnologyMask(const technologies& ownedTechs) const
+{
+	std::vector<uint64_t> technologyMask(maskSize, 0);
+	for (const auto& [technology, bit]: technologyBits)
+	{
+		if (ownedTechs.hasTechnology(technology))
+		{
+			technologyMask[bit / 64] |= uint64_t{1} << (bit % 64);
+		}
+	}
+
+	return technologyMask;
+}
+
+
+std::vector<size_t> HoI4::PossibleShipVariants::getValidMtgVariants(const std::vector<uint64_t>& technologyMask) const
+{
+	return getValidVariants(*mtgVariants, mtgNameOrder, mtgRequirements, technologyMask);
+}
+
+
+std::vector<size_t> HoI4::PossibleShipVariants::getValidLegacyVariants(
+	 const std::vector<uint64_t>& technologyMask) const
+{
+	return getValidVariants(*legacyVariants, legacyNameOrder, legacyRequirements, technologyMask);
+}
+
+
+template <class Variant>
+std::vector<size_t> HoI4::PossibleShipVariants::getValidVariants(const std::vector<Variant>& variants,
+	 const std::vector<size_t>& nameOrder,
+	 const std::vector<TechnologyRequirements>& requirements,
+	 const std::vector<uint64_t>& technologyMask)
+{
+	std::vector<size_t> validVariants;
+	for (const auto variant: nameOrder)
+	{
+		bool valid = true;
+		for (size_t word = 0; word < technologyMask.size() && valid; ++word)
+		{
+			valid = ((requirements[variant].required[word] & ~technologyMask[word]) == 0) &&
+					  ((requirements[variant].blocking[word] & technologyMask[word]) == 0);
+		}
+		if (!valid)
+		{
+			continue;
+		}
+
+		// when several valid variants share a name, only the first is kept
+		if (!validVariants.empty() && variants[validVariants.back()].getName() == variants[variant].getName())
+		{
+			continue;
+		}
+		validVariants.push_back(variant);
+	}
+
+	return validVariants;
+}
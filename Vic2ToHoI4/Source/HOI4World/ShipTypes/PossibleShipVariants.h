@@ -3,9 +3,14 @@
 
 
 
+#include "HOI4World/Technologies.h"
 #include "LegacyShipVariant.h"
 #include "MtgShipVariant.h"
 #include "Parser.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 
@@ -13,21 +18,55 @@
 namespace HoI4
 {
 
+// The variants from shipTypes.txt, with their required and blocking technologies compiled once into bitmasks so that
+// each country only has to turn its own technologies into a mask to find the variants it can use.
 class PossibleShipVariants: commonItems::parser
 {
   public:
 	explicit PossibleShipVariants(std::istream& theStream);
 
-	[[nodiscard]] auto getPossibleMtgVariants() const { return mtgVariants; }
-	[[nodiscard]] auto getPossibleLegacyVariants() const { return legacyVariants; }
+	[[nodiscard]] const auto& getPossibleMtgVariants() const { return *mtgVariants; }
+	[[nodiscard]] const auto& getPossibleLegacyVariants() const { return *legacyVariants; }
+	[[nodiscard]] const auto& getMtgVariantTable() const { return mtgVariants; }
+	[[nodiscard]] const auto& getLegacyVariantTable() const { return legacyVariants; }
+
+	// one bit for each technology that some variant requires or is blocked by
+	[[nodiscard]] std::vector<uint64_t> getTechnologyMask(const technologies& ownedTechs) const;
+
+	// the variants valid with technologyMask, as indexes into the variant table in name order, one per name
+	[[nodiscard]] std::vector<size_t> getValidMtgVariants(const std::vector<uint64_t>& technologyMask) const;
+	[[nodiscard]] std::vector<size_t> getValidLegacyVariants(const std::vector<uint64_t>& technologyMask) const;
 
   private:
-	std::vector<MtgShipVariant> mtgVariants;
-	std::vector<LegacyShipVariant> legacyVariants;
+	typedef struct TechnologyRequirements
+	{
+		std::vector<uint64_t> required;
+		std::vector<uint64_t> blocking;
+	} TechnologyRequirements;
+
+	template <class Variant>
+	std::vector<TechnologyRequirements> compileRequirements(const std::vector<Variant>& variants);
+	template <class Variant>
+	static std::vector<size_t> determineNameOrder(const std::vector<Variant>& variants);
+	template <class Variant>
+	static std::vector<size_t> getValidVariants(const std::vector<Variant>& variants,
+		 const std::vector<size_t>& nameOrder,
+		 const std::vector<TechnologyRequirements>& requirements,
+		 const std::vector<uint64_t>& technologyMask);
+
+	std::shared_ptr<const std::vector<MtgShipVariant>> mtgVariants;
+	std::shared_ptr<const std::vector<LegacyShipVariant>> legacyVariants;
+
+	std::unordered_map<std::string, size_t> technologyBits;
+	size_t maskSize = 0;
+	std::vector<TechnologyRequirements> mtgRequirements;
+	std::vector<TechnologyRequirements> legacyRequirements;
+	std::vector<size_t> mtgNameOrder;
+	std::vector<size_t> legacyNameOrder;
 };
 
 } // namespace HoI4
 
 
 
-#endif // POSSIBLE_SHIP_VARIANTS_H
\ No newline at end of file
+#endif // POSSIBLE_SHIP_VARIANTS_H
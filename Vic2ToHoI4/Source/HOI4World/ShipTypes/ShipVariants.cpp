@@ -4,23 +4,11 @@
 
 HoI4::ShipVariants::ShipVariants(const PossibleShipVariants& possibleShipVariants,
 	const technologies& ownedTechs,
-	const std::string& countryTag)
+	const std::string& countryTag):
+	 mtgVariantTable(possibleShipVariants.getMtgVariantTable()),
+	 legacyVariantTable(possibleShipVariants.getLegacyVariantTable()), countryTag(countryTag)
 {
-	for (auto& possibleVariant: possibleShipVariants.getPossibleMtgVariants())
-	{
-		if (possibleVariant.isValidVariant(ownedTechs))
-		{
-			auto newVariant(possibleVariant);
-			newVariant.setOwningCountryTag(countryTag);
-			mtgVariants.insert(std::make_pair(newVariant.getName(), newVariant));
-		}
-	}
-	for (auto& possibleVariant : possibleShipVariants.getPossibleLegacyVariants())
-	{
-		if (possibleVariant.isValidVariant(ownedTechs))
-		{
-			auto newVariant(possibleVariant);
-			legacyVariants.insert(std::make_pair(newVariant.getName(), newVariant));
-		}
-	}
+	const auto technologyMask = possibleShipVariants.getTechnologyMask(ownedTechs);
+	mtgVariants = possibleShipVariants.getValidMtgVariants(technologyMask);
+	legacyVariants = possibleShipVariants.getValidLegacyVariants(technologyMask);
 }
\ No newline at end of file
@@ -8,13 +8,17 @@
 #include "MtgShipVariant.h"
 #include "Parser.h"
 #include "PossibleShipVariants.h"
+#include <algorithm>
+#include <memory>
 #include <string>
+#include <vector>
 
 
 
 namespace HoI4
 {
 
+// The variants a country can build, kept as indexes into the tables shared by every country
 class ShipVariants
 {
   public:
@@ -22,18 +26,38 @@ class ShipVariants
 		 const technologies& ownedTechs,
 		 const std::string& countryTag);
 
-	[[nodiscard]] bool hasMtgVariant(const std::string& variantName) const { return mtgVariants.contains(variantName); }
+	[[nodiscard]] bool hasMtgVariant(const std::string& variantName) const
+	{
+		return hasVariant(*mtgVariantTable, mtgVariants, variantName);
+	}
 
 	[[nodiscard]] bool hasLegacyVariant(const std::string& variantName) const
 	{
-		return legacyVariants.contains(variantName);
+		return hasVariant(*legacyVariantTable, legacyVariants, variantName);
 	}
 
 	friend std::ostream& operator<<(std::ostream& output, const ShipVariants& theVariants);
 
   private:
-	std::map<std::string, MtgShipVariant> mtgVariants;
-	std::map<std::string, LegacyShipVariant> legacyVariants;
+	template <class Variant>
+	static bool hasVariant(const std::vector<Variant>& variantTable,
+		 const std::vector<size_t>& variants,
+		 const std::string& variantName)
+	{
+		const auto variant = std::lower_bound(variants.begin(),
+			 variants.end(),
+			 variantName,
+			 [&variantTable](size_t index, const std::string& name) {
+				 return variantTable[index].getName() < name;
+			 });
+		return variant != variants.end() && variantTable[*variant].getName() == variantName;
+	}
+
+	std::shared_ptr<const std::vector<MtgShipVariant>> mtgVariantTable;
+	std::shared_ptr<const std::vector<LegacyShipVariant>> legacyVariantTable;
+	std::vector<size_t> mtgVariants;
+	std::vector<size_t> legacyVariants;
+	std::string countryTag;
 };
 
 } // namespace HoI4
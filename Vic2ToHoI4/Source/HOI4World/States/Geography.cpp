@@ -0,0 +1,115 @@
+#include "Geography.h"
+
+
+
+namespace
+{
+
+std::span<const int> findStates(const std::unordered_map<std::string, std::vector<int>>& statesByTag,
+	 const std::string& tag)
+{
+	if (const auto states = statesByTag.find(tag); states != statesByTag.end())
+	{
+		return states->second;
+	}
+
+	return {};
+}
+
+} // namespace
+
+
+
+HoI4::Geography::Geography(const std::map<int, State>& states, const std::map<int, int>& provinceToStateIdMap)
+{
+	if (!provinceToStateIdMap.empty() && provinceToStateIdMap.rbegin()->first > 0)
+	{
+		provinceToState.resize(static_cast<size_t>(provinceToStateIdMap.rbegin()->first) + 1, 0);
+		for (const auto& [province, state]: provinceToStateIdMap)
+		{
+			if (province > 0)
+			{
+				provinceToState[province] = state;
+			}
+		}
+	}
+
+	if (!states.empty() && states.rbegin()->first > 0)
+	{
+		stateToOwner.resize(static_cast<size_t>(states.rbegin()->first) + 1);
+		stateToNumProvinces.resize(static_cast<size_t>(states.rbegin()->first) + 1, 0);
+	}
+	for (const auto& [stateId, state]: states)
+	{
+		if (stateId > 0)
+		{
+			stateToOwner[stateId] = state.getOwner();
+			stateToNumProvinces[stateId] = static_cast<int>(state.getProvinces().size());
+			if (!state.getOwner().empty())
+			{
+				ownedStates[state.getOwner()].push_back(stateId);
+			}
+		}
+
+		for (const auto& core: state.getCores())
+		{
+			coredStates[core].push_back(stateId);
+		}
+	}
+}
+
+
+std::optional<int> HoI4::Geography::getStateOfProvince(const int province) const
+{
+	if (province <= 0 || static_cast<size_t>(province) >= provinceToState.size() || provinceToState[province] == 0)
+	{
+		return std::nullopt;
+	}
+
+	return provinceToState[province];
+}
+
+
+std::optional<std::string_view> HoI4::Geography::getOwnerOfState(const int state) const
+{
+	if (state <= 0 || static_cast<size_t>(state) >= stateToOwner.size() || stateToOwner[state].empty())
+	{
+		return std::nullopt;
+	}
+
+	return stateToOwner[state];
+}
+
+
+std::optional<std::string_view> HoI4::Geography::getOwnerOfProvince(const int province) const
+{
+	if (const auto state = getStateOfProvince(province); state)
+	{
+		return getOwnerOfState(*state);
+	}
+
+	return std::nullopt;
+}
+
+
+int HoI4::Geography::getNumProvincesInState(const int state) const
+{
+	if (state <= 0 || static_cast<size_t>(state) >= stateToNumProvinces.size())
+	{
+		return 0;
+	}
+
+	return stateToNumProvinces[state];
+}
+
+
+std::span<const int> HoI4::Geography::getOwnedStates(const std::string& tag) const
+{
+	return findStates(ownedStates, tag);
+}
+
+
+std::span<const int> HoI4::Geography::getCoredStates(const std::string& tag) const
+{
+	return findStates(coredStates, tag);
+}
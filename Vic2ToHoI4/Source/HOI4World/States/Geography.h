@@ -0,0 +1,52 @@
+#ifndef HOI4_GEOGRAPHY_H
+#define HOI4_GEOGRAPHY_H
+
+
+
+#include "HoI4State.h"
+#include <map>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+
+
+namespace HoI4
+{
+
+// Read-only answers to "which state holds this province", "who owns this state", "how many provinces are in this
+// state" and "which states does this country own or have cores on", taken once the states have their final owners and
+// cores. Provinces and states are looked up in arrays indexed by their numbers, and countries by hash, so each query
+// costs constant time plus the size of the answer.
+class Geography
+{
+  public:
+	Geography(const std::map<int, State>& states, const std::map<int, int>& provinceToStateIdMap);
+
+	[[nodiscard]] std::optional<int> getStateOfProvince(int province) const;
+	[[nodiscard]] std::optional<std::string_view> getOwnerOfState(int state) const;
+	[[nodiscard]] std::optional<std::string_view> getOwnerOfProvince(int province) const;
+	[[nodiscard]] int getNumProvincesInState(int state) const;
+
+	// in increasing order of state number
+	[[nodiscard]] std::span<const int> getOwnedStates(const std::string& tag) const;
+	[[nodiscard]] std::span<const int> getCoredStates(const std::string& tag) const;
+
+  private:
+	// indexed by province number, 0 for provinces in no state
+	std::vector<int> provinceToState;
+	// indexed by state number, empty or 0 for unused numbers
+	std::vector<std::string> stateToOwner;
+	std::vector<int> stateToNumProvinces;
+	std::unordered_map<std::string, std::vector<int>> ownedStates;
+	std::unordered_map<std::string, std::vector<int>> coredStates;
+};
+
+} // namespace HoI4
+
+
+
+#endif // HOI4_GEOGRAPHY_H
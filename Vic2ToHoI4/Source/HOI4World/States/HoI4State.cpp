@@ -304,13 +304,14 @@ void HoI4::State::addManpower(const std::set<std::shared_ptr<Vic2::Province>>& s
 
 void HoI4::State::convertIndustry(double workerFactoryRatio,
 	 const HoI4::StateCategories& theStateCategories,
-	 const CoastalProvinces& theCoastalProvinces)
+	 const CoastalProvinces& theCoastalProvinces,
+	 FactoryRemainders& ownerRemainders)
 {
 	int factories = determineFactoryNumbers(workerFactoryRatio);
 
 	determineCategory(factories, theStateCategories);
 	addInfrastructureFromFactories(factories);
-	setIndustry(factories, theCoastalProvinces);
+	setIndustry(factories, theCoastalProvinces, ownerRemainders);
 	addVictoryPointValue(factories / 2);
 }
 
@@ -389,26 +390,13 @@ void HoI4::State::addInfrastructureFromFactories(int factories)
 }
 
 
-void HoI4::State::setIndustry(int factories, const CoastalProvinces& theCoastalProvinces)
+void HoI4::State::setIndustry(int factories, const CoastalProvinces& theCoastalProvinces, FactoryRemainders& country)
 {
 	if (ownerHasNoCore())
 	{
 		factories /= 2;
 	}
 
-	struct factoriesStruct
-	{
-		double military;
-		double civilian;
-		double docks;
-	};
-	static std::unordered_map<std::string, factoriesStruct> accumulator;
-	if (accumulator.find(ownerTag) == accumulator.end())
-	{
-		accumulator[ownerTag] = {0, 0, 0};
-	}
-	auto& country = accumulator[ownerTag];
-
 	if (amICoastal(theCoastalProvinces))
 	{
 		//		20% chance of dockyard
@@ -95,9 +95,18 @@ class State
 		 const Mappers::ProvinceMapper& theProvinceMapper,
 		 const Configuration& theConfiguration);
 
+	// The fractions of factories a country is still owed after its earlier states were given industry. Each
+	// conversion starts every country from zero.
+	struct FactoryRemainders
+	{
+		double military = 0.0;
+		double civilian = 0.0;
+		double docks = 0.0;
+	};
 	void convertIndustry(double workerFactoryRatio,
 		 const HoI4::StateCategories& theStateCategories,
-		 const CoastalProvinces& theCoastalProvinces);
+		 const CoastalProvinces& theCoastalProvinces,
+		 FactoryRemainders& ownerRemainders);
 
   private:
 	int determineFactoryNumbers(double workerFactoryRatio) const;
@@ -105,7 +114,7 @@ class State
 	void determineCategory(int factories, const HoI4::StateCategories& theStateCategories);
 	void addInfrastructureFromRails(float averageRailLevel);
 	void addInfrastructureFromFactories(int factories);
-	void setIndustry(int factories, const CoastalProvinces& theCoastalProvinces);
+	void setIndustry(int factories, const CoastalProvinces& theCoastalProvinces, FactoryRemainders& country);
 	bool amICoastal(const CoastalProvinces& theCoastalProvinces) const;
 	[[nodiscard]] bool ownerHasNoCore() const;
 
@@ -1,6 +1,7 @@
 #include "HoI4States.h"
 #include "Configuration.h"
 #include "DefaultState.h"
+#include "FolderImport.h"
 #include "HOI4World/HoI4Country.h"
 #include "HOI4World/HoI4Localisation.h"
 #include "HOI4World/Localisations/GrammarMappings.h"
@@ -12,7 +13,6 @@
 #include "HoI4State.h"
 #include "Log.h"
 #include "Mappers/CountryMapping.h"
-#include "OSCompatibilityLayer.h"
 #include "StateCategories.h"
 #include "V2World/Localisations/Vic2Localisations.h"
 #include "V2World/Provinces/Province.h"
@@ -43,17 +43,24 @@ HoI4::States::States(const Vic2::World& sourceWorld,
 	 const Mappers::ProvinceMapper& provinceMapper,
 	 const Configuration& theConfiguration)
 {
-	int num;
-
 	Log(LogLevel::Info) << "\tConverting states";
-	registerKeyword("state", [this, &num](std::istream& theStream) {
-		defaultStates.insert(std::make_pair(num, DefaultState(theStream)));
-	});
-
-	for (const auto& stateFile: commonItems::GetAllFilesInFolder(theConfiguration.getHoI4Path() + "/history/states"))
+	const auto stateFiles =
+		 importFolder(theConfiguration.getHoI4Path() + "/history/states", [](const std::string& path, const std::string&) {
+			 std::vector<DefaultState> fileStates;
+			 commonItems::parser stateFileParser;
+			 stateFileParser.registerKeyword("state", [&fileStates](std::istream& theStream) {
+				 fileStates.emplace_back(theStream);
+			 });
+			 stateFileParser.parseFile(path);
+			 return fileStates;
+		 });
+	for (const auto& [stateFile, fileStates]: stateFiles)
 	{
-		num = stoi(stateFile.substr(0, stateFile.find_first_of('-')));
-		parseFile(theConfiguration.getHoI4Path() + "/history/states/" + stateFile);
+		const auto num = stoi(stateFile.substr(0, stateFile.find_first_of('-')));
+		for (const auto& defaultState: fileStates)
+		{
+			defaultStates.insert(std::make_pair(num, defaultState));
+		}
 	}
 
 	const ImpassableProvinces theImpassableProvinces(defaultStates);
@@ -110,7 +117,7 @@ void HoI4::States::determineOwnersAndCores(const CountryMapper& countryMap,
 }
 
 
-std::optional<std::vector<int>> HoI4::States::retrieveSourceProvinceNumbers(int provNum,
+std::optional<std::span<const int>> HoI4::States::retrieveSourceProvinceNumbers(int provNum,
 	 const Mappers::ProvinceMapper& provinceMapper)
 {
 	auto provinceLink = provinceMapper.getHoI4ToVic2ProvinceMapping(provNum);
@@ -124,7 +131,7 @@ std::optional<std::vector<int>> HoI4::States::retrieveSourceProvinceNumbers(int
 
 
 std::map<std::string, std::pair<int, int>> HoI4::States::determinePotentialOwners(
-	 const std::vector<int>& sourceProvinceNumbers,
+	 std::span<const int> sourceProvinceNumbers,
 	 const Vic2::World& sourceWorld)
 {
 	std::map<std::string, std::pair<int, int>> potentialOwners;
@@ -183,7 +190,7 @@ std::string HoI4::States::selectProvinceOwner(const std::map<std::string, std::p
 }
 
 
-std::set<std::pair<std::string, std::string>> HoI4::States::determineCores(const std::vector<int>& sourceProvinces,
+std::set<std::pair<std::string, std::string>> HoI4::States::determineCores(std::span<const int> sourceProvinces,
 	 const std::string& Vic2Owner,
 	 const CountryMapper& countryMap,
 	 const std::string& newOwner,
@@ -677,6 +684,7 @@ void HoI4::States::putIndustryInStates(const std::map<std::string, double>& fact
 {
 	const StateCategories theStateCategories(theConfiguration);
 
+	std::map<std::string, State::FactoryRemainders> remaindersByOwner;
 	for (auto& HoI4State: states)
 	{
 		auto ratioMapping = factoryWorkerRatios.find(HoI4State.second.getOwner());
@@ -685,7 +693,10 @@ void HoI4::States::putIndustryInStates(const std::map<std::string, double>& fact
 			continue;
 		}
 
-		HoI4State.second.convertIndustry(ratioMapping->second, theStateCategories, theCoastalProvinces);
+		HoI4State.second.convertIndustry(ratioMapping->second,
+			 theStateCategories,
+			 theCoastalProvinces,
+			 remaindersByOwner[HoI4State.second.getOwner()]);
 	}
 }
 
@@ -752,17 +763,27 @@ void HoI4::States::addGreatPowerVPs(const std::vector<std::shared_ptr<Country>>&
 
 void HoI4::States::addCapitalVictoryPoints(const std::map<std::string, std::shared_ptr<Country>>& countries)
 {
-	std::vector<std::string> tags;
+	// strength is evaluated once per country rather than on every comparison
+	std::vector<std::pair<double, std::string>> strengthsAndTags;
 	for (const auto& [tag, country]: countries)
 	{
 		if (!country->isGreatPower())
 		{
-			tags.push_back(tag);
+			strengthsAndTags.emplace_back(country->getStrengthOverTime(1.0), tag);
 		}
 	}
-	std::sort(tags.begin(), tags.end(), [countries](const std::string& a, const std::string& b) {
-		return countries.at(a)->getStrengthOverTime(1.0) > countries.at(b)->getStrengthOverTime(1.0);
-	});
+	std::stable_sort(strengthsAndTags.begin(),
+		 strengthsAndTags.end(),
+		 [](const std::pair<double, std::string>& a, const std::pair<double, std::string>& b) {
+			 return a.first > b.first;
+		 });
+
+	std::vector<std::string> tags;
+	tags.reserve(strengthsAndTags.size());
+	for (auto& [unused, tag]: strengthsAndTags)
+	{
+		tags.push_back(std::move(tag));
+	}
 
 	auto i = 0;
 	for (; i < 4 && i < tags.size(); i++)
@@ -14,6 +14,7 @@
 #include <map>
 #include <optional>
 #include <set>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -83,15 +84,15 @@ class States: commonItems::parser
 		 const Vic2::World& sourceWorld,
 		 const ProvinceDefinitions& provinceDefinitions,
 		 const Mappers::ProvinceMapper& provinceMapper);
-	[[nodiscard]] static std::optional<std::vector<int>> retrieveSourceProvinceNumbers(int provNum,
+	[[nodiscard]] static std::optional<std::span<const int>> retrieveSourceProvinceNumbers(int provNum,
 		 const Mappers::ProvinceMapper& provinceMapper);
 	[[nodiscard]] static std::map<std::string, std::pair<int, int>> determinePotentialOwners(
-		 const std::vector<int>& sourceProvinceNumbers,
+		 std::span<const int> sourceProvinceNumbers,
 		 const Vic2::World& sourceWorld);
 	[[nodiscard]] static std::string selectProvinceOwner(
 		 const std::map<std::string, std::pair<int, int>>& potentialOwners);
 	[[nodiscard]] static std::set<std::pair<std::string, std::string>> determineCores(
-		 const std::vector<int>& sourceProvinces,
+		 std::span<const int> sourceProvinces,
 		 const std::string& Vic2Owner,
 		 const CountryMapper& countryMap,
 		 const std::string& newOwner,
@@ -6,22 +6,8 @@ HoI4::technologies::technologies(const Mappers::TechMapper& techMapper,
 	 const Mappers::ResearchBonusMapper& researchBonusMapper,
 	 const std::set<std::string>& oldTechnologiesAndInventions)
 {
-	for (const auto& techMapping: techMapper.getTechMappings())
+	for (const Mappers::TechMapping& techMapping: techMapper.getMatchingMappings(oldTechnologiesAndInventions))
 	{
-		bool requirementViolated = false;
-		for (const auto& requirement: techMapping.getVic2Requirements())
-		{
-			if (!oldTechnologiesAndInventions.contains(requirement))
-			{
-				requirementViolated = true;
-				break;
-			}
-		}
-		if (requirementViolated)
-		{
-			continue;
-		}
-
 		const auto& limit = techMapping.getLimit();
 		for (const auto& technology: techMapping.getTechs())
 		{
@@ -33,22 +19,9 @@ HoI4::technologies::technologies(const Mappers::TechMapper& techMapper,
 		}
 	}
 
-	for (const auto& bonusMapping: researchBonusMapper.getResearchBonusMappings())
+	for (const Mappers::ResearchBonusMapping& bonusMapping:
+		 researchBonusMapper.getMatchingMappings(oldTechnologiesAndInventions))
 	{
-		bool requirementViolated = false;
-		for (const auto& requirement: bonusMapping.getVic2Requirements())
-		{
-			if (!oldTechnologiesAndInventions.contains(requirement))
-			{
-				requirementViolated = true;
-				break;
-			}
-		}
-		if (requirementViolated)
-		{
-			continue;
-		}
-
 		for (const auto& bonus: bonusMapping.getResearchBonuses())
 		{
 			setResearchBonus(bonus.first, bonus.second);
@@ -18,8 +18,8 @@ HoI4WarCreator::HoI4WarCreator(HoI4::World* world,
 	 const HoI4::ProvinceDefinitions& provinceDefinitions,
 	 HoI4::Localisation& hoi4Localisations,
 	 const Configuration& theConfiguration):
-	 genericFocusTree(new HoI4FocusTree),
-	 theWorld(world), AggressorFactions(), WorldTargetMap(), provincePositions(), provinceToOwnerMap()
+	 genericFocusTree(world->getGenericFocusTree()),
+	 theWorld(world), AggressorFactions(), WorldTargetMap(), provincePositions()
 {
 	Log(LogLevel::Info) << "\tCreating wars";
 
@@ -29,9 +29,6 @@ HoI4WarCreator::HoI4WarCreator(HoI4::World* world,
 		AILog.open("AI-log.txt");
 	}
 
-	genericFocusTree->addGenericFocusTree(world->getMajorIdeologies());
-
-	determineProvinceOwners();
 	addAllTargetsToWorldTargetMap();
 	double worldStrength = calculateWorldStrength(AILog, theConfiguration);
 
@@ -733,22 +730,16 @@ std::map<std::string, std::shared_ptr<HoI4::Country>> HoI4WarCreator::getImmedia
 				continue;
 			}
 
-			auto provinceToOwnerItr = provinceToOwnerMap.find(provinceNumber);
-			if (provinceToOwnerItr == provinceToOwnerMap.end())
-			{
-				continue;
-			}
-
-			auto ownerTag = provinceToOwnerItr->second;
-			if (ownerTag == checkingCountry->getTag())
+			const auto ownerTag = theWorld->getGeography().getOwnerOfProvince(provinceNumber);
+			if (!ownerTag || *ownerTag == checkingCountry->getTag())
 			{
 				continue;
 			}
 
-			auto countries = theWorld->getCountries();
-			if (auto ownerCountry = countries.find(ownerTag); ownerCountry != countries.end())
+			const auto& countries = theWorld->getCountries();
+			if (auto ownerCountry = countries.find(std::string(*ownerTag)); ownerCountry != countries.end())
 			{
-				neighbors.insert(make_pair(ownerTag, ownerCountry->second));
+				neighbors.insert(make_pair(ownerCountry->first, ownerCountry->second));
 			}
 		}
 	}
@@ -780,19 +771,6 @@ map<string, shared_ptr<HoI4::Country>> HoI4WarCreator::getNearbyCountries(shared
 }
 
 
-void HoI4WarCreator::determineProvinceOwners()
-{
-	for (auto state: theWorld->getStates())
-	{
-		for (auto province: state.second.getProvinces())
-		{
-			string owner = state.second.getOwner();
-			provinceToOwnerMap.insert(make_pair(province, owner));
-		}
-	}
-}
-
-
 double HoI4WarCreator::GetFactionStrength(const shared_ptr<HoI4::Faction>& Faction, int years) const
 {
 	double strength = 0;
@@ -858,39 +836,37 @@ vector<shared_ptr<HoI4::Faction>> HoI4WarCreator::fascistWarMaker(shared_ptr<HoI
 	{
 		Log(LogLevel::Info) << "\t\t\tDoing Neighbor calcs";
 	}
-	for (auto neigh: CloseNeighbors)
+	const auto leaderStrength = Leader->getStrengthOverTime(1.5);
+	for (const auto& [unused, neighbor]: CloseNeighbors)
 	{
 		// lets check to see if they are not our ally and not a great country
-		if (!Allies.contains(neigh.second->getTag()) && !neigh.second->isGreatPower())
+		if (!Allies.contains(neighbor->getTag()) && !neighbor->isGreatPower())
 		{
-			volatile double enemystrength = neigh.second->getStrengthOverTime(1.5);
-			volatile double mystrength = Leader->getStrengthOverTime(1.5);
+			const auto neighborStrength = neighbor->getStrengthOverTime(1.5);
 			// lets see their strength is at least < 20%
-			if (neigh.second->getStrengthOverTime(1.5) < Leader->getStrengthOverTime(1.5) * 0.2 &&
-				 findFaction(neigh.second)->getMembers().size() == 1)
+			if (neighborStrength < leaderStrength * 0.2 && findFaction(neighbor)->getMembers().size() == 1)
 			{
 				// they are very weak
-				Anschluss.push_back(neigh.second);
+				Anschluss.push_back(neighbor);
 			}
 			// if not, lets see their strength is at least < 60%
-			else if (neigh.second->getStrengthOverTime(1.5) < Leader->getStrengthOverTime(1.5) * 0.6 &&
-						neigh.second->getStrengthOverTime(1.5) > Leader->getStrengthOverTime(1.5) * 0.2 &&
-						findFaction(neigh.second)->getMembers().size() == 1)
+			else if (neighborStrength < leaderStrength * 0.6 && neighborStrength > leaderStrength * 0.2 &&
+						findFaction(neighbor)->getMembers().size() == 1)
 			{
 				// they are weak and we can get 1 of these countries in sudeten deal
-				Sudeten.push_back(neigh.second);
+				Sudeten.push_back(neighbor);
 			}
 			// if not, lets see their strength is at least = to ours%
-			else if (neigh.second->getStrengthOverTime(1.5) < Leader->getStrengthOverTime(1.5))
+			else if (neighborStrength < leaderStrength)
 			{
 				// EqualTargets.push_back(neigh);
-				EqualTargets.push_back(neigh.second);
+				EqualTargets.push_back(neighbor);
 			}
 			// if not, lets see their strength is at least < 120%
-			else if (neigh.second->getStrengthOverTime(1.5) < Leader->getStrengthOverTime(1.5) * 1.2)
+			else if (neighborStrength < leaderStrength * 1.2)
 			{
 				// StrongerTargets.push_back(neigh);
-				DifficultTargets.push_back(neigh.second);
+				DifficultTargets.push_back(neighbor);
 			}
 		}
 	}
@@ -914,7 +890,7 @@ vector<shared_ptr<HoI4::Faction>> HoI4WarCreator::fascistWarMaker(shared_ptr<HoI
 		}
 	}
 	// gives us generic focus tree start
-	auto FocusTree = genericFocusTree->makeCustomizedCopy(*Leader);
+	auto FocusTree = genericFocusTree.makeCustomizedCopy(*Leader);
 
 	FocusTree->addFascistAnnexationBranch(Leader, nan, theWorld->getEvents(), hoi4Localisations);
 	nan.clear();
@@ -1275,7 +1251,7 @@ vector<shared_ptr<HoI4::Faction>> HoI4WarCreator::communistWarCreator(shared_ptr
 			break;
 	}
 
-	auto FocusTree = genericFocusTree->makeCustomizedCopy(*Leader);
+	auto FocusTree = genericFocusTree.makeCustomizedCopy(*Leader);
 	FocusTree->addCommunistCoupBranch(Leader, forcedtakeover, majorIdeologies, hoi4Localisations);
 	FocusTree->addCommunistWarBranch(Leader, TargetsByTech, theWorld->getEvents(), hoi4Localisations);
 	FocusTree->addGPWarBranch(Leader, newAllies, finalTargets, "Communist", theWorld->getEvents(), hoi4Localisations);
@@ -1292,7 +1268,7 @@ vector<shared_ptr<HoI4::Faction>> HoI4WarCreator::democracyWarCreator(shared_ptr
 	map<int, shared_ptr<HoI4::Country>> CountriesToContain;
 	vector<shared_ptr<HoI4::Country>> vCountriesToContain;
 	set<string> Allies = Leader->getAllies();
-	auto FocusTree = genericFocusTree->makeCustomizedCopy(*Leader);
+	auto FocusTree = genericFocusTree.makeCustomizedCopy(*Leader);
 	for (auto GC: theWorld->getGreatPowers())
 	{
 		auto relations = Leader->getRelations(GC->getTag());
@@ -1326,7 +1302,7 @@ vector<shared_ptr<HoI4::Faction>> HoI4WarCreator::absolutistWarCreator(shared_pt
 	 const HoI4::ProvinceDefinitions& provinceDefinitions,
 	 HoI4::Localisation& hoi4Localisations)
 {
-	auto focusTree = genericFocusTree->makeCustomizedCopy(*country);
+	auto focusTree = genericFocusTree.makeCustomizedCopy(*country);
 
 	auto name = country->getName();
 	if (name)
@@ -1368,8 +1344,8 @@ void HoI4WarCreator::generateReconquestWars(std::ofstream& AILog,
 			continue;
 		}
 		int numWarsWithNeighbors = 0;
-		auto focusTree = genericFocusTree->makeCustomizedCopy(*country);
-		const auto& coreHolders = focusTree->addReconquestBranch(country, numWarsWithNeighbors, theWorld->getMajorIdeologies(), theWorld->getStates(), hoi4Localisations);
+		auto focusTree = genericFocusTree.makeCustomizedCopy(*country);
+		const auto& coreHolders = focusTree->addReconquestBranch(country, numWarsWithNeighbors, theWorld->getMajorIdeologies(), theWorld->getGeography(), hoi4Localisations);
 		if (!coreHolders.empty())
 		{
 			country->giveNationalFocus(focusTree);
@@ -1414,9 +1390,9 @@ std::vector<std::shared_ptr<HoI4::Faction>> HoI4WarCreator::neighborWarCreator(s
 	}
 
 	int numWarsWithNeighbors = 0;
-	auto focusTree = genericFocusTree->makeCustomizedCopy(*country);
+	auto focusTree = genericFocusTree.makeCustomizedCopy(*country);
 
-	const auto& coreHolders = focusTree->addReconquestBranch(country, numWarsWithNeighbors, theWorld->getMajorIdeologies(), theWorld->getStates(), hoi4Localisations);
+	const auto& coreHolders = focusTree->addReconquestBranch(country, numWarsWithNeighbors, theWorld->getMajorIdeologies(), theWorld->getGeography(), hoi4Localisations);
 	const auto& conquerTags = focusTree->addConquerBranch(country, numWarsWithNeighbors, theWorld->getMajorIdeologies(), coreHolders, hoi4Localisations);
 
 	for (const auto& target: closeNeighbors)
@@ -1493,7 +1469,7 @@ set<int> HoI4WarCreator::findBorderState(shared_ptr<HoI4::Country> country,
 	 const HoI4::ProvinceDefinitions& provinceDefinitions)
 {
 	set<int> demandedStates;
-	std::map<int, int> provinceToStateIdMapping = world->getProvinceToStateIDMap();
+	const auto& geography = world->getGeography();
 	for (auto leaderprov: country->getProvinces())
 	{
 		for (int prov: theMapData.getNeighbors(leaderprov))
@@ -1503,13 +1479,9 @@ set<int> HoI4WarCreator::findBorderState(shared_ptr<HoI4::Country> country,
 				continue;
 			}
 
-			if (provinceToOwnerMap.contains(prov))
+			if (geography.getOwnerOfProvince(prov) == neighbor->getTag())
 			{
-				string owner = provinceToOwnerMap.find(prov)->second;
-				if (owner == neighbor->getTag())
-				{
-					demandedStates.insert(provinceToStateIdMapping[prov]);
-				}
+				demandedStates.insert(*geography.getStateOfProvince(prov));
 			}
 		}
 	}
@@ -1522,7 +1494,7 @@ std::vector<int> HoI4WarCreator::sortStatesByCapitalDistance(const std::set<int>
 {
 	std::multimap<double, int> statesWithDistance;
 	std::pair<int, int> capitalCoords = getCapitalPosition(country);
-	std::map<int, HoI4::State> statesMapping = world->getStates();
+	const auto& statesMapping = world->getStates();
 
 	for (int stateID: stateList)
 	{
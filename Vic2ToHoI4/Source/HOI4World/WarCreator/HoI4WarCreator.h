@@ -33,7 +33,6 @@ class HoI4WarCreator
 	HoI4WarCreator(const HoI4WarCreator&) = delete;
 	HoI4WarCreator& operator=(const HoI4WarCreator&) = delete;
 
-	void determineProvinceOwners();
 	void addAllTargetsToWorldTargetMap();
 	void addTargetsToWorldTargetMap(shared_ptr<HoI4::Country> country);
 	map<double, shared_ptr<HoI4::Country>> getDistancesToGreatPowers(shared_ptr<HoI4::Country> country);
@@ -154,14 +153,12 @@ class HoI4WarCreator
 	map<string, shared_ptr<HoI4::Country>> getNearbyCountries(shared_ptr<HoI4::Country> checkingCountry);
 
 
-	HoI4FocusTree* genericFocusTree;
+	const HoI4FocusTree& genericFocusTree;
 	HoI4::World* theWorld;
 
 	vector<HoI4::Country*> AggressorFactions;
 	map<shared_ptr<HoI4::Country>, vector<shared_ptr<HoI4::Country>>> WorldTargetMap;
 	map<int, pair<int, int>> provincePositions;
-
-	map<int, string> provinceToOwnerMap;
 };
 
 
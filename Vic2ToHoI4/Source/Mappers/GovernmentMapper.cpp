@@ -134,6 +134,62 @@ void governmentMapper::init()
 	});
 
 	parseFile("Configurables/governmentMapping.txt");
+	indexGovernmentMappings();
+}
+
+
+void governmentMapper::indexGovernmentMappings()
+{
+	std::set<std::string> governments{""};
+	std::set<std::string> rulingIdeologies{""};
+	for (const auto& mapping: governmentMap)
+	{
+		governments.insert(mapping.vic2Government);
+		rulingIdeologies.insert(mapping.rulingPartyRequired);
+	}
+
+	mappingsIndex.clear();
+	for (const auto& government: governments)
+	{
+		auto& governmentIndex = mappingsIndex[government];
+		for (const auto& rulingIdeology: rulingIdeologies)
+		{
+			auto& candidates = governmentIndex[rulingIdeology];
+			for (size_t i = 0; i < governmentMap.size(); ++i)
+			{
+				const auto& mapping = governmentMap[i];
+				if ((mapping.vic2Government.empty() || mapping.vic2Government == government) &&
+					 (mapping.rulingPartyRequired.empty() || mapping.rulingPartyRequired == rulingIdeology))
+				{
+					candidates.push_back(i);
+				}
+			}
+		}
+	}
+}
+
+
+const std::vector<size_t>& governmentMapper::getCandidateMappings(const std::string& government,
+	 const std::string& rulingIdeology) const
+{
+	static const std::vector<size_t> noCandidates;
+
+	auto governmentIndex = mappingsIndex.find(government);
+	if (governmentIndex == mappingsIndex.end())
+	{
+		governmentIndex = mappingsIndex.find("");
+		if (governmentIndex == mappingsIndex.end())
+		{
+			return noCandidates;
+		}
+	}
+
+	const auto& rulingIdeologyIndex = governmentIndex->second;
+	if (const auto candidates = rulingIdeologyIndex.find(rulingIdeology); candidates != rulingIdeologyIndex.end())
+	{
+		return candidates->second;
+	}
+	return rulingIdeologyIndex.find("")->second;
 }
 
 
@@ -143,10 +199,9 @@ std::string governmentMapper::getIdeologyForCountry(const std::string& sourceTag
 	 bool debug) const
 {
 	std::string ideology = "neutrality";
-	for (auto mapping: governmentMap)
+	for (const auto i: getCandidateMappings(sourceGovernment, Vic2RulingIdeology))
 	{
-		if (governmentMatches(mapping, sourceGovernment) && rulingIdeologyMatches(mapping, Vic2RulingIdeology) &&
-			 tagMatches(mapping, sourceTag))
+		if (const auto& mapping = governmentMap[i]; tagMatches(mapping, sourceTag))
 		{
 			ideology = mapping.HoI4GovernmentIdeology;
 			break;
@@ -167,10 +222,9 @@ std::string governmentMapper::getLeaderIdeologyForCountry(const std::string& sou
 	 bool debug) const
 {
 	std::string ideology = "neutrality";
-	for (auto mapping: governmentMap)
+	for (const auto i: getCandidateMappings(sourceGovernment, Vic2RulingIdeology))
 	{
-		if (governmentMatches(mapping, sourceGovernment) && rulingIdeologyMatches(mapping, Vic2RulingIdeology) &&
-			 tagMatches(mapping, sourceTag))
+		if (const auto& mapping = governmentMap[i]; tagMatches(mapping, sourceTag))
 		{
 			ideology = mapping.HoI4LeaderIdeology;
 			break;
@@ -193,9 +247,9 @@ std::string governmentMapper::getExistingIdeologyForCountry(const std::string& t
 	 bool debug) const
 {
 	std::string ideology = "neutrality";
-	for (auto mapping: governmentMap)
+	for (const auto i: getCandidateMappings(government, Vic2RulingIdeology))
 	{
-		if (governmentMatches(mapping, government) && rulingIdeologyMatches(mapping, Vic2RulingIdeology) &&
+		if (const auto& mapping = governmentMap[i];
 			 tagMatches(mapping, tag) && ideologyIsValid(mapping, majorIdeologies, ideologies))
 		{
 			ideology = mapping.HoI4GovernmentIdeology;
@@ -219,9 +273,9 @@ std::string governmentMapper::getExistingLeaderIdeologyForCountry(const std::str
 	 bool debug) const
 {
 	std::string ideology = "neutrality";
-	for (auto mapping: governmentMap)
+	for (const auto i: getCandidateMappings(government, Vic2RulingIdeology))
 	{
-		if (governmentMatches(mapping, government) && rulingIdeologyMatches(mapping, Vic2RulingIdeology) &&
+		if (const auto& mapping = governmentMap[i];
 			 tagMatches(mapping, tag) && ideologyIsValid(mapping, majorIdeologies, ideologies))
 		{
 			ideology = mapping.HoI4LeaderIdeology;
@@ -237,18 +291,6 @@ std::string governmentMapper::getExistingLeaderIdeologyForCountry(const std::str
 }
 
 
-bool governmentMapper::governmentMatches(const governmentMapping& mapping, const std::string& government) const
-{
-	return ((mapping.vic2Government.empty()) || (mapping.vic2Government == government));
-}
-
-
-bool governmentMapper::rulingIdeologyMatches(const governmentMapping& mapping, const std::string& rulingIdeology) const
-{
-	return ((mapping.rulingPartyRequired.empty()) || (mapping.rulingPartyRequired == rulingIdeology));
-}
-
-
 bool governmentMapper::tagMatches(const governmentMapping& mapping, const std::string& tag) const
 {
 	return ((mapping.tagRequired.empty()) || (mapping.tagRequired == tag));
@@ -269,7 +311,7 @@ std::string governmentMapper::getSupportedIdeology(const std::string& rulingIdeo
 	 const std::set<std::string>& majorIdeologies) const
 {
 	std::string ideology = "neutrality";
-	for (auto mapping: partyMap)
+	for (const auto& mapping: partyMap)
 	{
 		if ((rulingIdeology == mapping.rulingIdeology) && (Vic2Ideology == mapping.vic2Ideology) &&
 			 majorIdeologies.contains(mapping.supportedIdeology))
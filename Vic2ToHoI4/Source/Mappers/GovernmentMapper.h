@@ -5,6 +5,7 @@
 
 #include "HOI4World/Ideologies/Ideologies.h"
 #include "Parser.h"
+#include <map>
 #include <set>
 #include <string>
 #include <vector>
@@ -63,14 +64,16 @@ class governmentMapper: commonItems::parser
 		 const std::string& Vic2Ideology,
 		 const std::set<std::string>& majorIdeologies) const;
 
-	auto getGovernmentMappings() const { return governmentMap; }
+	const auto& getGovernmentMappings() const { return governmentMap; }
 
   private:
 	governmentMapper(const governmentMapper&) = delete;
 	governmentMapper& operator=(const governmentMapper&) = delete;
 
-	bool governmentMatches(const governmentMapping& mapping, const std::string& government) const;
-	bool rulingIdeologyMatches(const governmentMapping& mapping, const std::string& rulingIdeology) const;
+	void indexGovernmentMappings();
+	const std::vector<size_t>& getCandidateMappings(const std::string& government,
+		 const std::string& rulingIdeology) const;
+
 	bool tagMatches(const governmentMapping& mapping, const std::string& tag) const;
 	static bool ideologyIsValid(const governmentMapping& mapping,
 		 const std::set<std::string>& majorIdeologies,
@@ -78,6 +81,10 @@ class governmentMapper: commonItems::parser
 
 	std::vector<governmentMapping> governmentMap;
 	std::vector<partyMapping> partyMap;
+
+	// government -> ruling ideology -> indexes (in file order) of every mapping that could match that pair. Governments
+	// and ideologies no mapping names are filed under "", which holds the mappings that match any value.
+	std::map<std::string, std::map<std::string, std::vector<size_t>, std::less<>>, std::less<>> mappingsIndex;
 };
 
 
@@ -12,7 +12,11 @@ class governmentMapper::Builder
 {
   public:
 	Builder() { theGovernmentMapper = std::make_unique<governmentMapper>(); }
-	std::unique_ptr<governmentMapper> Build() { return std::move(theGovernmentMapper); }
+	std::unique_ptr<governmentMapper> Build()
+	{
+		theGovernmentMapper->indexGovernmentMappings();
+		return std::move(theGovernmentMapper);
+	}
 
 	Builder& addGovernmentMapping(const governmentMapping& theGovernmentMapping)
 	{
@@ -24,6 +24,20 @@ class graphicsMapper::Builder
 		theGraphicsMapper->graphicalCulture2dMap.insert(std::make_pair(cultureGroup, graphicalCulture2d));
 		return *this;
 	}
+	Builder& addLeaderPortraits(const std::string& cultureGroup,
+		 const std::string& ideology,
+		 const std::vector<std::string>& portraits)
+	{
+		theGraphicsMapper->loadLeaderPortraitMappings(cultureGroup, {{ideology, portraits}});
+		return *this;
+	}
+	Builder& addIdeologyMinisterPortraits(const std::string& cultureGroup,
+		 const std::string& ideology,
+		 const std::vector<std::string>& portraits)
+	{
+		theGraphicsMapper->loadIdeologyMinisterPortraitMappings(cultureGroup, {{ideology, portraits}});
+		return *this;
+	}
 
   private:
 	std::unique_ptr<graphicsMapper> theGraphicsMapper;
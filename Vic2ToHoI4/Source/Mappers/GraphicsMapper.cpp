@@ -2,6 +2,7 @@
 #include "CommonRegexes.h"
 #include "Log.h"
 #include "ParserHelpers.h"
+#include "RandomStream.h"
 
 
 
@@ -122,12 +123,13 @@ void graphicsMapper::loadIdeologyMinisterPortraitMappings(const std::string& cul
 }
 
 
-std::string graphicsMapper::getLeaderPortrait(const std::string& cultureGroup, const std::string& ideology)
+std::string graphicsMapper::getLeaderPortrait(const std::string& cultureGroup,
+	 const std::string& ideology,
+	 const std::string& key) const
 {
-	if (auto portraits = getLeaderPortraits(cultureGroup, ideology))
+	if (auto portraits = getLeaderPortraits(cultureGroup, ideology); portraits && !portraits->empty())
 	{
-		std::uniform_int_distribution<int> firstNameGen(0, static_cast<int>(portraits->size()) - 1);
-		return (*portraits)[firstNameGen(rng)];
+		return (*portraits)[RandomStream{key, "leader_portrait"}.pick(portraits->size())];
 	}
 	else
 	{
@@ -151,14 +153,15 @@ std::optional<std::vector<std::string>> graphicsMapper::getLeaderPortraits(const
 }
 
 
-std::string graphicsMapper::getIdeologyMinisterPortrait(const std::string& cultureGroup, const std::string& ideology)
+std::string graphicsMapper::getIdeologyMinisterPortrait(const std::string& cultureGroup,
+	 const std::string& ideology,
+	 const std::string& key) const
 {
 	auto portraits = getIdeologyMinisterPortraits(cultureGroup, ideology);
 
-	if (portraits)
+	if (portraits && !portraits->empty())
 	{
-		std::uniform_int_distribution<int> firstNameGen(0, static_cast<int>(portraits->size()) - 1);
-		return (*portraits)[firstNameGen(rng)];
+		return (*portraits)[RandomStream{key, ideology + "_minister_portrait"}.pick(portraits->size())];
 	}
 	else
 	{
@@ -29,7 +29,6 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 #include "Parser.h"
 #include <map>
 #include <optional>
-#include <random>
 #include <string>
 #include <vector>
 
@@ -50,8 +49,13 @@ class graphicsMapper: commonItems::parser
 
 	class Builder;
 
-	std::string getLeaderPortrait(const std::string& cultureGroup, const std::string& ideology);
-	std::string getIdeologyMinisterPortrait(const std::string& cultureGroup, const std::string& ideology);
+	// key names the entity being portrayed (such as a country tag), the same key always gets the same portrait
+	std::string getLeaderPortrait(const std::string& cultureGroup,
+		 const std::string& ideology,
+		 const std::string& key) const;
+	std::string getIdeologyMinisterPortrait(const std::string& cultureGroup,
+		 const std::string& ideology,
+		 const std::string& key) const;
 	std::string getGeneralPortrait(const std::string& cultureGroup) const;
 	std::optional<std::string> getGraphicalCulture(const std::string& cultureGroup) const;
 	std::optional<std::string> get2dGraphicalCulture(const std::string& cultureGroup) const;
@@ -74,8 +78,6 @@ class graphicsMapper: commonItems::parser
 	ideologyToPortraitsMap ideologyMinisterMappings;
 	cultureGroupToGraphicalCultureMap graphicalCultureMap;
 	cultureGroupToGraphicalCultureMap graphicalCulture2dMap;
-
-	std::mt19937 rng;
 };
 
 
@@ -0,0 +1,35 @@
+#include "DenseProvinceMapping.h"
+
+
+
+Mappers::DenseProvinceMapping::DenseProvinceMapping(const std::map<int, std::vector<int>>& mapping)
+{
+	if (mapping.empty() || mapping.rbegin()->first < 0)
+	{
+		return;
+	}
+
+	const auto numProvinces = static_cast<size_t>(mapping.rbegin()->first) + 1;
+	offsets.assign(numProvinces + 1, 0);
+	mapped.assign(numProvinces, false);
+
+	size_t totalProvinces = 0;
+	for (const auto& [province, mappedProvinces]: mapping)
+	{
+		totalProvinces += mappedProvinces.size();
+	}
+	provinces.reserve(totalProvinces);
+
+	auto nextProvince = mapping.lower_bound(0);
+	for (size_t province = 0; province < numProvinces; ++province)
+	{
+		offsets[province] = static_cast<uint32_t>(provinces.size());
+		if (nextProvince != mapping.end() && static_cast<size_t>(nextProvince->first) == province)
+		{
+			mapped[province] = true;
+			provinces.insert(provinces.end(), nextProvince->second.begin(), nextProvince->second.end());
+			++nextProvince;
+		}
+	}
+	offsets[numProvinces] = static_cast<uint32_t>(provinces.size());
+}
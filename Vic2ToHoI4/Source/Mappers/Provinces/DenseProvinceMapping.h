@@ -0,0 +1,50 @@
+#ifndef DENSE_PROVINCE_MAPPING_H
+#define DENSE_PROVINCE_MAPPING_H
+
+
+
+#include <cstdint>
+#include <map>
+#include <span>
+#include <vector>
+
+
+
+namespace Mappers
+{
+
+// A province mapping compiled into arrays indexed by province number: the provinces mapped from province p are
+// provinces[offsets[p]] up to provinces[offsets[p + 1]]. Province numbers are small and dense, so a lookup is two
+// array reads with no allocation.
+class DenseProvinceMapping
+{
+  public:
+	DenseProvinceMapping() = default;
+	explicit DenseProvinceMapping(const std::map<int, std::vector<int>>& mapping);
+
+	// empty for provinces without a mapping
+	[[nodiscard]] std::span<const int> getProvinces(const int province) const
+	{
+		if (province < 0 || static_cast<size_t>(province) >= mapped.size())
+		{
+			return {};
+		}
+		return std::span<const int>(provinces).subspan(offsets[province], offsets[province + 1] - offsets[province]);
+	}
+
+	[[nodiscard]] bool contains(const int province) const
+	{
+		return province >= 0 && static_cast<size_t>(province) < mapped.size() && mapped[province];
+	}
+
+  private:
+	std::vector<uint32_t> offsets;
+	std::vector<bool> mapped;
+	std::vector<int> provinces;
+};
+
+} // namespace Mappers
+
+
+
+#endif // DENSE_PROVINCE_MAPPING_H
@@ -3,9 +3,8 @@
 
 
 
-#include "ProvinceMappingTypes.h"
-#include <map>
-#include <vector>
+#include "DenseProvinceMapping.h"
+#include <span>
 
 
 
@@ -18,8 +17,15 @@ class ProvinceMapper
 	class Factory;
 	class Builder;
 
-	[[nodiscard]] std::vector<int> getVic2ToHoI4ProvinceMapping(int Vic2Province) const;
-	[[nodiscard]] std::vector<int> getHoI4ToVic2ProvinceMapping(int HoI4Province) const;
+	// empty when the province has no mapping
+	[[nodiscard]] std::span<const int> getVic2ToHoI4ProvinceMapping(const int Vic2Province) const
+	{
+		return Vic2ToHoI4ProvinceMap.getProvinces(Vic2Province);
+	}
+	[[nodiscard]] std::span<const int> getHoI4ToVic2ProvinceMapping(const int HoI4Province) const
+	{
+		return HoI4ToVic2ProvinceMap.getProvinces(HoI4Province);
+	}
 
 	[[nodiscard]] bool isVic2ProvinceMapped(int vic2ProvinceNum) const
 	{
@@ -27,8 +33,8 @@ class ProvinceMapper
 	}
 
   private:
-	HoI4ToVic2ProvinceMapping HoI4ToVic2ProvinceMap;
-	Vic2ToHoI4ProvinceMapping Vic2ToHoI4ProvinceMap;
+	DenseProvinceMapping HoI4ToVic2ProvinceMap;
+	DenseProvinceMapping Vic2ToHoI4ProvinceMap;
 };
 
 } // namespace Mappers
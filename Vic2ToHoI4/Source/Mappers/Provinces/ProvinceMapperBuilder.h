@@ -4,7 +4,9 @@
 
 
 #include "ProvinceMapper.h"
+#include "ProvinceMappingTypes.h"
 #include <memory>
+#include <vector>
 
 
 
@@ -15,22 +17,29 @@ class ProvinceMapper::Builder
 {
   public:
 	Builder() { provinceMapper = std::make_unique<ProvinceMapper>(); }
-	std::unique_ptr<ProvinceMapper> Build() { return std::move(provinceMapper); }
+	std::unique_ptr<ProvinceMapper> Build()
+	{
+		provinceMapper->HoI4ToVic2ProvinceMap = DenseProvinceMapping(HoI4ToVic2ProvinceMap);
+		provinceMapper->Vic2ToHoI4ProvinceMap = DenseProvinceMapping(Vic2ToHoI4ProvinceMap);
+		return std::move(provinceMapper);
+	}
 
 	Builder& addHoI4ToVic2ProvinceMapping(int HoI4Province, std::vector<int> Vic2Provinces)
 	{
-		provinceMapper->HoI4ToVic2ProvinceMap.insert(std::make_pair(HoI4Province, std::move(Vic2Provinces)));
+		HoI4ToVic2ProvinceMap.insert(std::make_pair(HoI4Province, std::move(Vic2Provinces)));
 		return *this;
 	}
 
 	Builder& addVic2ToHoI4ProvinceMap(int Vic2Province, std::vector<int> HoI4Provinces)
 	{
-		provinceMapper->Vic2ToHoI4ProvinceMap.insert(std::make_pair(Vic2Province, std::move(HoI4Provinces)));
+		Vic2ToHoI4ProvinceMap.insert(std::make_pair(Vic2Province, std::move(HoI4Provinces)));
 		return *this;
 	}
 
   private:
 	std::unique_ptr<ProvinceMapper> provinceMapper;
+	HoI4ToVic2ProvinceMapping HoI4ToVic2ProvinceMap;
+	Vic2ToHoI4ProvinceMapping Vic2ToHoI4ProvinceMap;
 };
 
 } // namespace Mappers
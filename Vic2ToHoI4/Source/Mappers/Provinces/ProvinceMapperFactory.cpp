@@ -82,8 +82,8 @@ Mappers::ProvinceMapper::Factory::Factory(const Configuration& theConfiguration)
 	registerRegex(R"(\d\.[\d]+\.\d)", [this, theConfiguration](const std::string& unused, std::istream& theStream) {
 		const auto thisVersionsMappings = versionedMappingsFactory.importVersionedMappings(theStream);
 		checkAllHoI4ProvincesMapped(*thisVersionsMappings, theConfiguration);
-		provinceMapper->HoI4ToVic2ProvinceMap = thisVersionsMappings->getHoI4ToVic2Mapping();
-		provinceMapper->Vic2ToHoI4ProvinceMap = thisVersionsMappings->getVic2ToHoI4Mapping();
+		provinceMapper->HoI4ToVic2ProvinceMap = DenseProvinceMapping(thisVersionsMappings->getHoI4ToVic2Mapping());
+		provinceMapper->Vic2ToHoI4ProvinceMap = DenseProvinceMapping(thisVersionsMappings->getVic2ToHoI4Mapping());
 	});
 	registerRegex(commonItems::catchallRegex, commonItems::ignoreItem);
 }
@@ -111,30 +111,4 @@ std::unique_ptr<Mappers::ProvinceMapper> Mappers::ProvinceMapper::Factory::impor
 	}
 
 	return std::move(provinceMapper);
-}
-
-
-std::vector<int> Mappers::ProvinceMapper::getVic2ToHoI4ProvinceMapping(const int Vic2Province) const
-{
-	const auto mapping = Vic2ToHoI4ProvinceMap.find(Vic2Province);
-	if (mapping == Vic2ToHoI4ProvinceMap.end())
-	{
-		Log(LogLevel::Warning) << "No mapping found for Vic2 province " << Vic2Province;
-		return {};
-	}
-
-	return mapping->second;
-}
-
-
-std::vector<int> Mappers::ProvinceMapper::getHoI4ToVic2ProvinceMapping(const int HoI4Province) const
-{
-	const auto mapping = HoI4ToVic2ProvinceMap.find(HoI4Province);
-	if (mapping == HoI4ToVic2ProvinceMap.end())
-	{
-		Log(LogLevel::Warning) << "No mapping found for HoI4 province " << HoI4Province;
-		return {};
-	}
-
-	return mapping->second;
 }
\ No newline at end of file
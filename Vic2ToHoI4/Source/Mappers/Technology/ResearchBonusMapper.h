@@ -4,6 +4,10 @@
 
 
 #include "ResearchBonusMapping.h"
+#include "TechRequirementsMatcher.h"
+#include <functional>
+#include <set>
+#include <string>
 #include <vector>
 
 
@@ -16,10 +20,22 @@ class ResearchBonusMapper
   public:
 	class Factory;
 
-	[[nodiscard]] auto getResearchBonusMappings() const { return researchBonusMappings; }
+	[[nodiscard]] const auto& getResearchBonusMappings() const { return researchBonusMappings; }
+
+	// the mappings whose Vic2 requirements are all in technologiesAndInventions, in file order
+	[[nodiscard]] auto getMatchingMappings(const std::set<std::string>& technologiesAndInventions) const
+	{
+		std::vector<std::reference_wrapper<const ResearchBonusMapping>> matchingMappings;
+		for (const auto i: requirementsMatcher.getMatchingMappings(technologiesAndInventions))
+		{
+			matchingMappings.emplace_back(researchBonusMappings[i]);
+		}
+		return matchingMappings;
+	}
 
   private:
 	std::vector<ResearchBonusMapping> researchBonusMappings;
+	TechRequirementsMatcher requirementsMatcher;
 };
 
 } // namespace Mappers
@@ -5,8 +5,9 @@
 Mappers::ResearchBonusMapper::Factory::Factory()
 {
 	registerKeyword("link", [this](std::istream& theStream) {
-		researchBonusMapper->researchBonusMappings.push_back(
-			 *researchBonusMappingFactory.importResearchBonusMapping(theStream));
+		const auto researchBonusMapping = researchBonusMappingFactory.importResearchBonusMapping(theStream);
+		researchBonusMapper->requirementsMatcher.addMapping(researchBonusMapping->getVic2Requirements());
+		researchBonusMapper->researchBonusMappings.push_back(std::move(*researchBonusMapping));
 	});
 }
 
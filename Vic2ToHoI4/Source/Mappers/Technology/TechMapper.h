@@ -4,6 +4,10 @@
 
 
 #include "TechMapping.h"
+#include "TechRequirementsMatcher.h"
+#include <functional>
+#include <set>
+#include <string>
 #include <vector>
 
 
@@ -16,10 +20,22 @@ class TechMapper
   public:
 	class Factory;
 
-	[[nodiscard]] auto getTechMappings() const { return techMappings; }
+	[[nodiscard]] const auto& getTechMappings() const { return techMappings; }
+
+	// the mappings whose Vic2 requirements are all in technologiesAndInventions, in file order
+	[[nodiscard]] auto getMatchingMappings(const std::set<std::string>& technologiesAndInventions) const
+	{
+		std::vector<std::reference_wrapper<const TechMapping>> matchingMappings;
+		for (const auto i: requirementsMatcher.getMatchingMappings(technologiesAndInventions))
+		{
+			matchingMappings.emplace_back(techMappings[i]);
+		}
+		return matchingMappings;
+	}
 
   private:
 	std::vector<TechMapping> techMappings;
+	TechRequirementsMatcher requirementsMatcher;
 };
 
 } // namespace Mappers
@@ -5,7 +5,9 @@
 Mappers::TechMapper::Factory::Factory()
 {
 	registerKeyword("link", [this](std::istream& theStream) {
-		techMapper->techMappings.push_back(*techMappingFactory.importTechMapping(theStream));
+		const auto techMapping = techMappingFactory.importTechMapping(theStream);
+		techMapper->requirementsMatcher.addMapping(techMapping->getVic2Requirements());
+		techMapper->techMappings.push_back(std::move(*techMapping));
 	});
 }
 
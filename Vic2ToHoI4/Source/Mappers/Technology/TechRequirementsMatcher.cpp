@@ -0,0 +1,68 @@
+#include "TechRequirementsMatcher.h"
+
+
+
+namespace
+{
+
+constexpr size_t BITS_PER_WORD = 64;
+
+} // namespace
+
+
+
+void Mappers::TechRequirementsMatcher::addMapping(const std::set<std::string>& requirements)
+{
+	Bits required;
+	for (const auto& requirement: requirements)
+	{
+		const auto [position, unused] = bitPositions.emplace(requirement, bitPositions.size());
+		const auto bit = position->second;
+		if (required.size() <= bit / BITS_PER_WORD)
+		{
+			required.resize(bit / BITS_PER_WORD + 1);
+		}
+		required[bit / BITS_PER_WORD] |= uint64_t{1} << (bit % BITS_PER_WORD);
+	}
+
+	requiredBits.push_back(std::move(required));
+}
+
+
+std::vector<size_t> Mappers::TechRequirementsMatcher::getMatchingMappings(
+	 const std::set<std::string>& technologiesAndInventions) const
+{
+	Bits held((bitPositions.size() + BITS_PER_WORD - 1) / BITS_PER_WORD);
+	for (const auto& techOrInvention: technologiesAndInventions)
+	{
+		if (const auto position = bitPositions.find(techOrInvention); position != bitPositions.end())
+		{
+			held[position->second / BITS_PER_WORD] |= uint64_t{1} << (position->second % BITS_PER_WORD);
+		}
+	}
+
+	std::vector<size_t> matchingMappings;
+	for (size_t i = 0; i < requiredBits.size(); ++i)
+	{
+		if (containsAll(held, requiredBits[i]))
+		{
+			matchingMappings.push_back(i);
+		}
+	}
+
+	return matchingMappings;
+}
+
+
+bool Mappers::TechRequirementsMatcher::containsAll(const Bits& held, const Bits& required)
+{
+	for (size_t word = 0; word < required.size(); ++word)
+	{
+		if ((held[word] & required[word]) != required[word])
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
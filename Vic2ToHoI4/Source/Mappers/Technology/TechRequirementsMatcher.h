@@ -0,0 +1,43 @@
+#ifndef TECH_REQUIREMENTS_MATCHER_H
+#define TECH_REQUIREMENTS_MATCHER_H
+
+
+
+#include <cstdint>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+
+namespace Mappers
+{
+
+// Finds which mappings have all their Vic2 technology and invention requirements met. Each tech or invention named by
+// a mapping is given its own bit when the mapping is added, so checking a mapping is a handful of word comparisons
+// instead of a string lookup per requirement.
+class TechRequirementsMatcher
+{
+  public:
+	// mappings are numbered in the order they are added
+	void addMapping(const std::set<std::string>& requirements);
+
+	// the numbers of the mappings whose requirements are all in technologiesAndInventions, in ascending order
+	[[nodiscard]] std::vector<size_t> getMatchingMappings(
+		 const std::set<std::string>& technologiesAndInventions) const;
+
+  private:
+	using Bits = std::vector<uint64_t>;
+
+	[[nodiscard]] static bool containsAll(const Bits& held, const Bits& required);
+
+	std::unordered_map<std::string, size_t> bitPositions;
+	std::vector<Bits> requiredBits;
+};
+
+} // namespace Mappers
+
+
+
+#endif // TECH_REQUIREMENTS_MATCHER_H
@@ -1,15 +1,11 @@
 #include "../../common_items/CommonFunctions.h"
 #include "OutAiStrategy.h"
 #include "HOI4World/HoI4Country.h"
+#include "OutHoi4/OutputSink.h"
 
 void HoI4::outputAIStrategy(const HoI4::Country& theCountry, const std::string& outputName)
 {
-	std::ofstream output("output/" + outputName + "/common/ai_strategy/converted_" + theCountry.getTag() + ".txt");
-	if (!output.is_open())
-	{
-		throw std::runtime_error(
-			 "Could not open output/" + outputName + "/common/ai_strategy/converted_" + theCountry.getTag() + ".txt");
-	}
+	OutputFile output("output/" + outputName + "/common/ai_strategy/converted_" + theCountry.getTag() + ".txt");
 	output << commonItems::utf8BOM; // add the BOM to make HoI4 happy
 
 	output << "converted_war_strategies_" << theCountry.getTag() << " = {\n";
@@ -1,6 +1,6 @@
 #include "OutDecisions.h"
 #include "OutDecisionsCategories.h"
-#include <fstream>
+#include "OutHoi4/OutputSink.h"
 
 
 
@@ -11,12 +11,7 @@ void HoI4::outputDecisions(const decisions& theDecisions,
 	outputDecisionCategories("output/" + outputName + "/common/decisions/categories/00_decision_categories.txt",
 		 theDecisions.getIdeologicalCategories());
 
-	std::ofstream outStream("output/" + outputName + "/common/decisions/lar_agent_recruitment_decisions.txt");
-	if (!outStream.is_open())
-	{
-		throw std::runtime_error(
-			 "Could not open output/" + outputName + "/common/decisions/categories/00_decision_categories.txt");
-	}
+	OutputFile outStream("output/" + outputName + "/common/decisions/lar_agent_recruitment_decisions.txt");
 	for (const auto& category: theDecisions.getAgentRecruitmentDecisions())
 	{
 		outStream << category;
@@ -24,10 +19,6 @@ void HoI4::outputDecisions(const decisions& theDecisions,
 	outStream.close();
 
 	outStream.open("output/" + outputName + "/common/decisions/stability_war_support.txt");
-	if (!outStream.is_open())
-	{
-		throw std::runtime_error("Could not open output/" + outputName + "/common/decisions/stability_war_support.txt");
-	}
 	for (const auto& category: theDecisions.getStabilityDecisions())
 	{
 		outStream << category;
@@ -35,10 +26,6 @@ void HoI4::outputDecisions(const decisions& theDecisions,
 	outStream.close();
 
 	outStream.open("output/" + outputName + "/common/decisions/political_decisions.txt");
-	if (!outStream.is_open())
-	{
-		throw std::runtime_error("Could not open output/" + outputName + "/common/decisions/political_decisions.txt");
-	}
 	for (const auto& category: theDecisions.getPoliticalDecisions())
 	{
 		outStream << category;
@@ -46,11 +33,6 @@ void HoI4::outputDecisions(const decisions& theDecisions,
 	outStream.close();
 
 	outStream.open("output/" + outputName + "/common/decisions/_exiled_governments_decisions.txt");
-	if (!outStream.is_open())
-	{
-		throw std::runtime_error(
-			 "Could not open output/" + outputName + "/common/decisions/_exiled_governments_decisions.txt");
-	}
 	for (const auto& category: theDecisions.getExiledGovernmentsDecisions())
 	{
 		outStream << category;
@@ -58,10 +40,6 @@ void HoI4::outputDecisions(const decisions& theDecisions,
 	outStream.close();
 
 	outStream.open("output/" + outputName + "/common/decisions/foreign_influence.txt");
-	if (!outStream.is_open())
-	{
-		throw std::runtime_error("Could not open output/" + outputName + "/common/decisions/foreign_influence.txt");
-	}
 	for (const auto& category: theDecisions.getForeignInfluenceDecisions())
 	{
 		outStream << category;
@@ -69,10 +47,6 @@ void HoI4::outputDecisions(const decisions& theDecisions,
 	outStream.close();
 
 	outStream.open("output/" + outputName + "/common/decisions/MTG_naval_treaty.txt");
-	if (!outStream.is_open())
-	{
-		throw std::runtime_error("Could not open output/" + outputName + "/common/decisions/MTG_naval_treaty.txt");
-	}
 	for (const auto& category: theDecisions.getNavalTreatyDecisions())
 	{
 		outStream << category;
@@ -80,10 +54,6 @@ void HoI4::outputDecisions(const decisions& theDecisions,
 	outStream.close();
 
 	outStream.open("output/" + outputName + "/common/decisions/resource_prospecting.txt");
-	if (!outStream.is_open())
-	{
-		throw std::runtime_error("Could not open output/" + outputName + "/common/decisions/resource_prospecting.txt");
-	}
 	for (const auto& category: theDecisions.getResourceProspectingDecisions())
 	{
 		outStream << category;
@@ -91,10 +61,6 @@ void HoI4::outputDecisions(const decisions& theDecisions,
 	outStream.close();
 
 	outStream.open("output/" + outputName + "/common/decisions/_generic_decisions.txt");
-	if (!outStream.is_open())
-	{
-		throw std::runtime_error("Could not open output/" + outputName + "/common/decisions/_generic_decisions.txt");
-	}
 	for (const auto& category: theDecisions.getGenericDecisions())
 	{
 		outStream << category;
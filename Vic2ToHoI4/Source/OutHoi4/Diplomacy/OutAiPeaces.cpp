@@ -1,5 +1,5 @@
 #include "OutAiPeaces.h"
-#include <fstream>
+#include "OutHoi4/OutputSink.h"
 
 
 
@@ -12,7 +12,7 @@ void HoI4::outAiPeaces(const AiPeaces& aiPeaces,
 	{
 		if (thePeace.getName() == "communist_peace")
 		{
-			std::ofstream outFile("output/" + outputName + "/common/ai_peace/1_communist.txt");
+			OutputFile outFile("output/" + outputName + "/common/ai_peace/1_communist.txt");
 			if (majorIdeologies.contains("communist"))
 			{
 				outFile << thePeace;
@@ -21,7 +21,7 @@ void HoI4::outAiPeaces(const AiPeaces& aiPeaces,
 		}
 		if (thePeace.getName() == "radical_peace")
 		{
-			std::ofstream outFile("output/" + outputName + "/common/ai_peace/1_radical.txt");
+			OutputFile outFile("output/" + outputName + "/common/ai_peace/1_radical.txt");
 			if (majorIdeologies.contains("radical"))
 			{
 				outFile << thePeace;
@@ -30,7 +30,7 @@ void HoI4::outAiPeaces(const AiPeaces& aiPeaces,
 		}
 		else if (thePeace.getName() == "fascist_peace")
 		{
-			std::ofstream outFile("output/" + outputName + "/common/ai_peace/1_fascist.txt");
+			OutputFile outFile("output/" + outputName + "/common/ai_peace/1_fascist.txt");
 			if (majorIdeologies.contains("fascism"))
 			{
 				outFile << thePeace;
@@ -39,7 +39,7 @@ void HoI4::outAiPeaces(const AiPeaces& aiPeaces,
 		}
 		else if (thePeace.getName() == "absolutist_peace")
 		{
-			std::ofstream outFile("output/" + outputName + "/common/ai_peace/1_absolutist.txt");
+			OutputFile outFile("output/" + outputName + "/common/ai_peace/1_absolutist.txt");
 			if (majorIdeologies.contains("absolutist"))
 			{
 				outFile << thePeace;
@@ -48,7 +48,7 @@ void HoI4::outAiPeaces(const AiPeaces& aiPeaces,
 		}
 		else if (thePeace.getName() == "democratic_peace")
 		{
-			std::ofstream outFile("output/" + outputName + "/common/ai_peace/1_democratic.txt");
+			OutputFile outFile("output/" + outputName + "/common/ai_peace/1_democratic.txt");
 			if (majorIdeologies.contains("democratic"))
 			{
 				outFile << thePeace;
@@ -1,6 +1,6 @@
 #include "OutEvents.h"
 #include "OSCompatibilityLayer.h"
-#include <fstream>
+#include "OutHoi4/OutputSink.h"
 
 
 
@@ -20,12 +20,6 @@ void outputGovernmentInExileDecision(const HoI4::Event& governmentInExileEvent,
 
 void HoI4::outputEvents(const Events& theEvents, const std::string& outputName)
 {
-	const auto eventPath = "output/" + outputName + "/events";
-	if (!commonItems::TryCreateFolder(eventPath))
-	{
-		throw std::runtime_error("Could not create \"output/" + outputName + "/events\"");
-	}
-
 	outputActualEvents("NF_events.txt", "NFEvents", theEvents.getNationalFocusEvents(), outputName);
 	outputActualEvents("newsEvents.txt", "news", theEvents.getNewsEvents(), outputName);
 	outputActualEvents("converterPoliticalEvents.txt", "conv.political", theEvents.getPoliticalEvents(), outputName);
@@ -47,11 +41,7 @@ void outputActualEvents(const std::string& eventsFileName,
 	 const std::vector<HoI4::Event>& events,
 	 const std::string& outputName)
 {
-	std::ofstream outEvents("output/" + outputName + "/events/" + eventsFileName);
-	if (!outEvents.is_open())
-	{
-		throw std::runtime_error("Could not create " + eventsFileName);
-	}
+	HoI4::OutputFile outEvents("output/" + outputName + "/events/" + eventsFileName);
 
 	outEvents << "\xEF\xBB\xBF";
 	outEvents << "add_namespace = " + eventNamespace + "\n";
@@ -67,11 +57,8 @@ void outputActualEvents(const std::string& eventsFileName,
 
 void outputWarJustificationEvents(const std::vector<HoI4::Event>& warJustificationEvents, const std::string& outputName)
 {
-	std::ofstream outWarJustificationEvents("output/" + outputName + "/events/WarJustification.txt", std::ios_base::app);
-	if (!outWarJustificationEvents.is_open())
-	{
-		throw std::runtime_error("Could not open WarJustification.txt");
-	}
+	HoI4::OutputFile outWarJustificationEvents("output/" + outputName + "/events/WarJustification.txt",
+		 std::ios_base::app);
 
 	for (const auto& theEvent: warJustificationEvents)
 	{
@@ -88,11 +75,7 @@ void outputStabilityEvents(const std::map<std::string, HoI4::Event>& stabilityEv
 	 const std::map<std::string, HoI4::Event>& mutinyEvents,
 	 const std::string& outputName)
 {
-	std::ofstream outStabilityEvents("output/" + outputName + "/events/stability_events.txt");
-	if (!outStabilityEvents.is_open())
-	{
-		throw std::runtime_error("Could not open StabilityEvents.txt");
-	}
+	HoI4::OutputFile outStabilityEvents("output/" + outputName + "/events/stability_events.txt");
 
 	outStabilityEvents << "\xEF\xBB\xBF"; // add the BOM to make HoI4 happy
 	outStabilityEvents << "###########################\n";
@@ -128,11 +111,7 @@ void outputStabilityEvents(const std::map<std::string, HoI4::Event>& stabilityEv
 
 void outputGovernmentInExileDecision(const HoI4::Event& governmentInExileEvent, const std::string& outputName)
 {
-	std::ofstream outEvents("output/" + outputName + "/events/MTG_generic.txt", std::ofstream::app);
-	if (!outEvents.is_open())
-	{
-		throw std::runtime_error("Could not add to MTG_generic.txt");
-	}
+	HoI4::OutputFile outEvents("output/" + outputName + "/events/MTG_generic.txt", std::ios_base::app);
 
 	outEvents << governmentInExileEvent;
 	outEvents.close();
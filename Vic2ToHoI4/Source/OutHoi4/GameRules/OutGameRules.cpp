@@ -1,20 +1,12 @@
 #include "OutGameRules.h"
 #include "OSCompatibilityLayer.h"
-#include <fstream>
+#include "OutHoi4/OutputSink.h"
 
 
 
 void HoI4::outputGameRules(const GameRules& rules, const std::string& outputName)
 {
-	if (!commonItems::TryCreateFolder("output/" + outputName + "/common/game_rules"))
-	{
-		throw std::runtime_error{ "Could not create output/" + outputName + "/common/game_rules"};
-	}
-	std::ofstream rulesFile("output/" + outputName + "/common/game_rules/00_game_rules.txt");
-	if (!rulesFile.is_open())
-	{
-		throw std::runtime_error{ "Could not open output/" + outputName + "/common/game_rules/00_game_rules.txt" };
-	}
+	OutputFile rulesFile("output/" + outputName + "/common/game_rules/00_game_rules.txt");
 
 	for (const auto& rule: rules.getGameRules())
 	{
@@ -1,7 +1,7 @@
 #include "OutIdeas.h"
 #include "HOI4World/Ideas/IdeaGroup.h"
 #include "HOI4World/Ideas/Ideas.h"
-#include <fstream>
+#include "OutHoi4/OutputSink.h"
 
 
 
@@ -20,7 +20,7 @@ void outputIdeologicalIdeas(const std::map<std::string, HoI4::IdeaGroup>& ideolo
 	 const std::set<std::string>& majorIdeologies,
 	 const std::string& outputName)
 {
-	std::ofstream ideasFile("output/" + outputName + "/common/ideas/convertedIdeas.txt");
+	HoI4::OutputFile ideasFile("output/" + outputName + "/common/ideas/convertedIdeas.txt");
 	ideasFile << "ideas = {\n";
 	ideasFile << "\tcountry = {\n";
 	for (const auto& majorIdeology: majorIdeologies)
@@ -41,8 +41,8 @@ void outputIdeologicalIdeas(const std::map<std::string, HoI4::IdeaGroup>& ideolo
 }
 
 
-std::ofstream openIdeaFile(const std::string& fileName);
-void closeIdeaFile(std::ofstream& fileStream);
+HoI4::OutputFile openIdeaFile(const std::string& fileName);
+void closeIdeaFile(HoI4::OutputFile& fileStream);
 void outputGeneralIdeas(const std::vector<HoI4::IdeaGroup>& generalIdeas, const std::string& outputName)
 {
 	auto manpowerFile = openIdeaFile("output/" + outputName + "/common/ideas/_manpower.txt");
@@ -71,15 +71,15 @@ void outputGeneralIdeas(const std::vector<HoI4::IdeaGroup>& generalIdeas, const
 }
 
 
-std::ofstream openIdeaFile(const std::string& fileName)
+HoI4::OutputFile openIdeaFile(const std::string& fileName)
 {
-	std::ofstream theFile(fileName);
+	HoI4::OutputFile theFile(fileName);
 	theFile << "ideas = {\n";
 	return theFile;
 }
 
 
-void closeIdeaFile(std::ofstream& fileStream)
+void closeIdeaFile(HoI4::OutputFile& fileStream)
 {
 	fileStream << "}";
 	fileStream.close();
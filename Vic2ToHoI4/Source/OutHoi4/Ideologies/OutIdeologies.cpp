@@ -1,16 +1,12 @@
 #include "OutIdeologies.h"
 #include "OSCompatibilityLayer.h"
-#include <fstream>
+#include "OutHoi4/OutputSink.h"
 
 
 
 void HoI4::outputIdeologies(const Ideologies& ideologies, const std::string& outputName)
 {
-	if (!commonItems::TryCreateFolder("output/" + outputName + "/common/ideologies/"))
-	{
-		Log(LogLevel::Error) << "Could not create output/" + outputName + "/common/ideologies/";
-	}
-	std::ofstream ideologyFile("output/" + outputName + "/common/ideologies/00_ideologies.txt");
+	OutputFile ideologyFile("output/" + outputName + "/common/ideologies/00_ideologies.txt");
 	ideologyFile << "ideologies = {\n";
 	ideologyFile << "\t\n";
 	for (const auto& ideologyName: ideologies.getMajorIdeologies())
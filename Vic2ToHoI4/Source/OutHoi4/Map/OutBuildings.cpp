@@ -1,27 +1,19 @@
 #include "OutBuildings.h"
 #include "OutBuilding.h"
-#include <fstream>
+#include "OutHoi4/OutputSink.h"
 
 
 
 void HoI4::outputBuildings(const Buildings& buildings, const std::string& outputName)
 {
-	std::ofstream out("output/" + outputName + "/map/buildings.txt");
-	if (!out.is_open())
-	{
-		throw std::runtime_error("Could not open output/" + outputName + "/map/buildings.txt");
-	}
+	OutputFile out("output/" + outputName + "/map/buildings.txt");
 	for (const auto& building: buildings.getBuildings())
 	{
 		out << building.second;
 	}
 	out.close();
 
-	std::ofstream airportsFile("output/" + outputName + "/map/airports.txt");
-	if (!airportsFile.is_open())
-	{
-		throw std::runtime_error("Could not create output/" + outputName + "/map/airports.txt");
-	}
+	OutputFile airportsFile("output/" + outputName + "/map/airports.txt");
 	for (const auto& airportLocation: buildings.getAirportLocations())
 	{
 		airportsFile << airportLocation.first << "={" << airportLocation.second << " }\n";
@@ -1,15 +1,11 @@
 #include "OutStrategicRegion.h"
-#include <fstream>
+#include "OutHoi4/OutputSink.h"
 
 
 
 void HoI4::outputStrategicRegion(const StrategicRegion& strategicRegion, const std::string& path)
 {
-	std::ofstream out(path + strategicRegion.getFilename());
-	if (!out.is_open())
-	{
-		throw std::runtime_error("Could not open " + path + strategicRegion.getFilename());
-	}
+	OutputFile out(path + strategicRegion.getFilename());
 
 	out << "\n";
 	out << "strategic_region={\n";
@@ -1,16 +1,12 @@
 #include "OutSupplyZone.h"
-#include <fstream>
+#include "OutHoi4/OutputSink.h"
 
 
 
 void HoI4::outputSupplyZone(const SupplyZone& supplyZone, const std::string& filename, const std::string& outputName)
 {
 	const auto fullFilename("output/" + outputName + "/map/supplyareas/" + filename);
-	std::ofstream out(fullFilename);
-	if (!out.is_open())
-	{
-		throw std::runtime_error("Could not open \"output/input/map/supplyareas/" + filename);
-	}
+	OutputFile out(fullFilename);
 	out << "\n";
 	out << "supply_area={\n";
 	out << "\tid=" << supplyZone.getId() << "\n";
@@ -1,11 +1,11 @@
 #include "OutOperativeNamesSet.h"
-#include <fstream>
+#include "OutHoi4/OutputSink.h"
 
 
 
 void HoI4::outputOperativeNamesSet(const OperativeNamesSet& operativeNamesSet, const std::string& outputName)
 {
-	std::ofstream out("output/" + outputName + "/common/units/codenames_operatives/" + operativeNamesSet.getFilename());
+	OutputFile out("output/" + outputName + "/common/units/codenames_operatives/" + operativeNamesSet.getFilename());
 
 	out << operativeNamesSet.getWrapper() << " = {\n";
 	out << "\tname = " << operativeNamesSet.getName() << "\n";
@@ -2,6 +2,7 @@
 #include "HOI4World/HoI4Country.h"
 #include "Log.h"
 #include "OSCompatibilityLayer.h"
+#include "OutputSink.h"
 #include "V2World/Countries/Country.h"
 #include "targa.h"
 #include <optional>
@@ -20,6 +21,7 @@ std::vector<std::string> getSourceFlagPaths(const std::string& Vic2Tag,
 	 const std::string& vic2ModPath);
 std::optional<tga_image*> readFlag(const std::string& path);
 tga_image* createNewFlag(const tga_image* sourceFlag, unsigned int sizeX, unsigned int sizeY);
+void writeFlag(tga_image* flag, const std::string& path);
 void createBigFlag(const tga_image* sourceFlag, const std::string& filename, const std::string& outputName);
 void createMediumFlag(const tga_image* sourceFlag, const std::string& filename, const std::string& outputName);
 void createSmallFlag(const tga_image* sourceFlag, const std::string& filename, const std::string& outputName);
@@ -46,23 +48,6 @@ void HoI4::copyFlags(const std::map<std::string, std::shared_ptr<Country>>& coun
 {
 	Log(LogLevel::Info) << "\tCreating flags";
 
-	if (!commonItems::TryCreateFolder("output/" + outputName + "/gfx"))
-	{
-		throw std::runtime_error("Could not create output/" + outputName + "/gfx");
-	}
-	if (!commonItems::TryCreateFolder("output/" + outputName + "/gfx/flags"))
-	{
-		throw std::runtime_error("Could not create output/" + outputName + "/gfx/flags");
-	}
-	if (!commonItems::TryCreateFolder("output/" + outputName + "/gfx/flags/medium"))
-	{
-		throw std::runtime_error("Could not create output/" + outputName + "/gfx/flags/medium");
-	}
-	if (!commonItems::TryCreateFolder("output/" + outputName + "/gfx/flags/small"))
-	{
-		throw std::runtime_error("Could not create output/" + outputName + "/gfx/flags/small");
-	}
-
 	for (const auto& country: countries)
 	{
 		processFlagsForCountry(country, outputName, vic2Mods, vic2ModPath);
@@ -298,21 +283,54 @@ tga_image* HoI4::createNewFlag(const tga_image* const sourceFlag, const unsigned
 }
 
 
-void HoI4::createBigFlag(const tga_image* const sourceFlag, const std::string& filename, const std::string& outputName)
+// tga_write only writes to a path on disk, so the image is laid out here and handed to the output sink instead: the
+// header, the uncompressed pixels, and the TGA 2.0 footer. Flags from createNewFlag have no id or color map.
+void HoI4::writeFlag(tga_image* const flag, const std::string& path)
 {
-	const auto destFlag = createNewFlag(sourceFlag, 82, 52);
-
-	const tga_result result = tga_write(("output/" + outputName + "/gfx/flags/" + filename).c_str(), destFlag);
-	if (result)
+	if (flag->image_data == nullptr)
 	{
-		tga_free_buffers(destFlag);
-		delete destFlag;
-		throw std::runtime_error(
-			 "Could not create output/" + outputName + "/gfx/flags/" + filename + " : " + tga_error(result));
+		delete flag;
+		throw std::runtime_error("Could not create " + path + " : out of memory");
 	}
 
-	tga_free_buffers(destFlag);
-	delete destFlag;
+	std::string contents;
+	const auto imageSize = static_cast<size_t>(flag->width) * flag->height * (flag->pixel_depth / 8);
+	contents.reserve(18 + imageSize + 26);
+
+	const auto addByte = [&contents](const uint8_t byte) {
+		contents.push_back(static_cast<char>(byte));
+	};
+	const auto addShort = [&addByte](const uint16_t value) {
+		addByte(static_cast<uint8_t>(value & 0xFF));
+		addByte(static_cast<uint8_t>(value >> 8));
+	};
+	addByte(flag->image_id_length);
+	addByte(flag->color_map_type);
+	addByte(flag->image_type);
+	addShort(flag->color_map_origin);
+	addShort(flag->color_map_length);
+	addByte(flag->color_map_depth);
+	addShort(flag->origin_x);
+	addShort(flag->origin_y);
+	addShort(flag->width);
+	addShort(flag->height);
+	addByte(flag->pixel_depth);
+	addByte(flag->image_descriptor);
+	contents.append(reinterpret_cast<const char*>(flag->image_data), imageSize);
+	contents.append(8, '\0');
+	contents.append("TRUEVISION-XFILE.");
+	contents.push_back('\0');
+
+	tga_free_buffers(flag);
+	delete flag;
+
+	getOutputSink().writeBinaryFile(path, std::move(contents));
+}
+
+
+void HoI4::createBigFlag(const tga_image* const sourceFlag, const std::string& filename, const std::string& outputName)
+{
+	writeFlag(createNewFlag(sourceFlag, 82, 52), "output/" + outputName + "/gfx/flags/" + filename);
 }
 
 
@@ -320,19 +338,7 @@ void HoI4::createMediumFlag(const tga_image* const sourceFlag,
 	 const std::string& filename,
 	 const std::string& outputName)
 {
-	const auto destFlag = createNewFlag(sourceFlag, 41, 26);
-
-	const tga_result result = tga_write(("output/" + outputName + "/gfx/flags/medium/" + filename).c_str(), destFlag);
-	if (result)
-	{
-		tga_free_buffers(destFlag);
-		delete destFlag;
-		throw std::runtime_error(
-			 "Could not create output/" + outputName + "/gfx/flags/medium/" + filename + " : " + tga_error(result));
-	}
-
-	tga_free_buffers(destFlag);
-	delete destFlag;
+	writeFlag(createNewFlag(sourceFlag, 41, 26), "output/" + outputName + "/gfx/flags/medium/" + filename);
 }
 
 
@@ -340,17 +346,5 @@ void HoI4::createSmallFlag(const tga_image* const sourceFlag,
 	 const std::string& filename,
 	 const std::string& outputName)
 {
-	const auto destFlag = createNewFlag(sourceFlag, 10, 7);
-
-	const tga_result result = tga_write(("output/" + outputName + "/gfx/flags/small/" + filename).c_str(), destFlag);
-	if (result)
-	{
-		tga_free_buffers(destFlag);
-		delete destFlag;
-		throw std::runtime_error(
-			 "Could not create output/" + outputName + "/gfx/flags/small/" + filename + " : " + tga_error(result));
-	}
-
-	tga_free_buffers(destFlag);
-	delete destFlag;
-}
\ No newline at end of file
+	writeFlag(createNewFlag(sourceFlag, 10, 7), "output/" + outputName + "/gfx/flags/small/" + filename);
+}
@@ -1,18 +1,14 @@
 #include "OutFocusTree.h"
 #include "OutFocus.h"
 #include "OutSharedFocus.h"
-#include <fstream>
+#include "OutputSink.h"
 #include <string>
 
 
 
 void HoI4::outputFocusTree(const HoI4FocusTree& focusTree, const std::string& filename)
 {
-	std::ofstream out(filename);
-	if (!out.is_open())
-	{
-		throw std::runtime_error("Could not create " + filename);
-	}
+	OutputFile out(filename);
 
 	out << "focus_tree = {\n";
 	if (!focusTree.getDestinationCountryTag().empty())
@@ -52,11 +48,7 @@ void HoI4::outputFocusTree(const HoI4FocusTree& focusTree, const std::string& fi
 
 void HoI4::outputSharedFocuses(const HoI4FocusTree& focusTree, const std::string& filename)
 {
-	std::ofstream SharedFocuses(filename);
-	if (!SharedFocuses.is_open())
-	{
-		throw std::runtime_error("Could not create " + filename);
-	}
+	OutputFile SharedFocuses(filename);
 
 	for (const auto& focus: focusTree.getSharedFocuses())
 	{
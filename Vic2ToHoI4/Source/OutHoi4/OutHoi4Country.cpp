@@ -19,6 +19,7 @@
 #include "OSCompatibilityLayer.h"
 #include "OutFocusTree.h"
 #include "OutTechnologies.h"
+#include "OutputSink.h"
 #include "V2World/Countries/Country.h"
 #include <string>
 
@@ -41,7 +42,7 @@ void HoI4::outputColors(std::ostream& out, const Country& theCountry)
 
 
 void outputNamesSet(std::ostream& namesFile,
-	 const std::optional<std::vector<std::string>>& names,
+	 const std::optional<std::span<const std::string_view>>& names,
 	 const std::string& tabs);
 
 void HoI4::outputToNamesFiles(std::ostream& namesFile, const Names& names, const Country& theCountry)
@@ -90,7 +91,7 @@ void HoI4::outputToNamesFiles(std::ostream& namesFile, const Names& names, const
 
 
 void outputNamesSet(std::ostream& namesFile,
-	 const std::optional<std::vector<std::string>>& names,
+	 const std::optional<std::span<const std::string_view>>& names,
 	 const std::string& tabs)
 {
 	if (names)
@@ -124,24 +125,14 @@ void HoI4::outputToUnitNamesFiles(const Country& theCountry, const Configuration
 {
 	const auto& tag = theCountry.getTag();
 
-	std::ofstream legacyUnitNamesFile(
+	OutputFile legacyUnitNamesFile(
 		 "output/" + theConfiguration.getOutputName() + "/common/units/names/" + tag + "_names.txt");
-	if (!legacyUnitNamesFile.is_open())
-	{
-		throw std::runtime_error(
-			 "Could not open output/" + theConfiguration.getOutputName() + "/common/units/names/" + tag + "_names.txt");
-	}
 	legacyUnitNamesFile << "\xEF\xBB\xBF"; // add the BOM to make HoI4 happy
 	outLegacyNavyNames(legacyUnitNamesFile, theCountry.getNavyNames().getLegacyShipTypeNames(), tag);
 	legacyUnitNamesFile.close();
 
-	std::ofstream mtgUnitNamesFile(
+	OutputFile mtgUnitNamesFile(
 		 "output/" + theConfiguration.getOutputName() + "/common/units/names_ships/" + tag + "_ship_names.txt");
-	if (!mtgUnitNamesFile.is_open())
-	{
-		throw std::runtime_error("Could not open output/" + theConfiguration.getOutputName() +
-										 "/common/units/names_ships/" + tag + "_ship_names.txt");
-	}
 	mtgUnitNamesFile << "\xEF\xBB\xBF"; // add the BOM to make HoI4 happy
 	outMtgNavyNames(mtgUnitNamesFile, theCountry.getNavyNames().getMtgShipTypeNames(), tag);
 	mtgUnitNamesFile.close();
@@ -185,7 +176,9 @@ void HoI4::outputIdeaGraphics(std::ostream& ideasFile, const Country& theCountry
 }
 
 
-void outputHistory(const HoI4::Country& theCountry, const Configuration& theConfiguration);
+void outputHistory(const HoI4::Country& theCountry,
+	 const Configuration& theConfiguration,
+	 std::vector<std::string>& warnings);
 void outputOOB(const std::vector<HoI4::DivisionTemplateType>& divisionTemplates,
 	 const HoI4::Country& theCountry,
 	 const Configuration& theConfiguration);
@@ -194,26 +187,29 @@ void outputAdvisorIdeas(const std::string& tag,
 	 const std::set<HoI4::Advisor>& ideologicalAdvisors,
 	 const Configuration& theConfiguration);
 
-void HoI4::outputCountry(const std::set<Advisor>& ideologicalMinisters,
+std::vector<std::string> HoI4::outputCountry(const std::set<Advisor>& ideologicalMinisters,
 	 const std::vector<DivisionTemplateType>& divisionTemplates,
 	 const Country& theCountry,
 	 const Configuration& theConfiguration)
 {
+	std::vector<std::string> warnings;
 	if (theCountry.getCapitalState())
 	{
-		outputHistory(theCountry, theConfiguration);
+		outputHistory(theCountry, theConfiguration, warnings);
 		outputOOB(divisionTemplates, theCountry, theConfiguration);
 		outputCommonCountryFile(theCountry, theConfiguration);
 		outputAdvisorIdeas(theCountry.getTag(), ideologicalMinisters, theConfiguration);
 		outputAIStrategy(theCountry, theConfiguration.getOutputName());
 
-		if (auto nationalFocus = theCountry.getNationalFocus(); nationalFocus)
+		if (const auto& nationalFocus = theCountry.getNationalFocus(); nationalFocus)
 		{
 			outputFocusTree(*nationalFocus,
 				 "output/" + theConfiguration.getOutputName() + "/common/national_focus/" + theCountry.getTag() +
 					  "_NF.txt");
 		}
 	}
+
+	return warnings;
 }
 
 
@@ -243,8 +239,9 @@ void outputRelations(std::ostream& output,
 	 const std::map<std::string, HoI4::Relations>& relations);
 void outputFactions(std::ostream& output,
 	 const std::string& tag,
-	 const std::optional<HoI4::Faction>& faction,
-	 const std::optional<std::string>& possibleLeaderName);
+	 const std::shared_ptr<const HoI4::Faction>& faction,
+	 const std::optional<std::string>& possibleLeaderName,
+	 std::vector<std::string>& warnings);
 void outputGuaranteedSpherelings(std::ostream& output, const std::vector<std::string>& guaranteed);
 void outputIdeas(std::ostream& output,
 	 const bool& greatPower,
@@ -261,19 +258,16 @@ void outputCommanders(std::ostream& output,
 	 const std::vector<HoI4::Admiral>& admirals);
 
 
-void outputHistory(const HoI4::Country& theCountry, const Configuration& theConfiguration)
+void outputHistory(const HoI4::Country& theCountry,
+	 const Configuration& theConfiguration,
+	 std::vector<std::string>& warnings)
 {
 	const auto& tag = theCountry.getTag();
 	const auto& governmentIdeology = theCountry.getGovernmentIdeology();
 	const auto& primaryCulture = theCountry.getPrimaryCulture();
 
-	std::ofstream output("output/" + theConfiguration.getOutputName() + "/history/countries/" +
+	HoI4::OutputFile output("output/" + theConfiguration.getOutputName() + "/history/countries/" +
 								commonItems::normalizeUTF8Path(theCountry.getFilename()));
-	if (!output.is_open())
-	{
-		throw std::runtime_error("Could not open output/" + theConfiguration.getOutputName() + "/history/countries/" +
-										 commonItems::normalizeUTF8Path(theCountry.getFilename()));
-	}
 	output << "\xEF\xBB\xBF"; // add the BOM to make HoI4 happy
 
 	outputCapital(output, theCountry.getCapitalState());
@@ -301,7 +295,7 @@ void outputHistory(const HoI4::Country& theCountry, const Configuration& theConf
 		 theCountry.areElectionsAllowed(),
 		 theCountry.getIdeologySupport());
 	outputRelations(output, tag, theCountry.getRelations());
-	outputFactions(output, tag, theCountry.getFaction(), theCountry.getName());
+	outputFactions(output, tag, theCountry.getFaction(), theCountry.getName(), warnings);
 	outputGuaranteedSpherelings(output, theCountry.getGuaranteed());
 	outputIdeas(output,
 		 theCountry.isGreatPower(),
@@ -584,8 +578,9 @@ void outputRelations(std::ostream& output,
 
 void outputFactions(std::ostream& output,
 	 const std::string& tag,
-	 const std::optional<HoI4::Faction>& faction,
-	 const std::optional<std::string>& possibleLeaderName)
+	 const std::shared_ptr<const HoI4::Faction>& faction,
+	 const std::optional<std::string>& possibleLeaderName,
+	 std::vector<std::string>& warnings)
 {
 	if (faction && (faction->getLeader()->getTag() == tag))
 	{
@@ -596,7 +591,7 @@ void outputFactions(std::ostream& output,
 		}
 		else
 		{
-			Log(LogLevel::Warning) << "Could not name alliance";
+			warnings.emplace_back("Could not name alliance");
 			allianceName = "faction";
 		}
 		output << "create_faction = \"" + allianceName + "\"\n";
@@ -694,12 +689,7 @@ void outputOOB(const std::vector<HoI4::DivisionTemplateType>& divisionTemplates,
 {
 	const auto& tag = theCountry.getTag();
 
-	std::ofstream output("output/" + theConfiguration.getOutputName() + "/history/units/" + tag + "_OOB.txt");
-	if (!output.is_open())
-	{
-		throw std::runtime_error(
-			 "Could not open output/" + theConfiguration.getOutputName() + "/history/units/" + tag + "_OOB.txt");
-	}
+	HoI4::OutputFile output("output/" + theConfiguration.getOutputName() + "/history/units/" + tag + "_OOB.txt");
 	output << "\xEF\xBB\xBF"; // add the BOM to make HoI4 happy
 
 	output << "start_equipment_factor = 0\n";
@@ -802,11 +792,11 @@ void outputOOB(const std::vector<HoI4::DivisionTemplateType>& divisionTemplates,
 	output.close();
 
 	auto& navies = theCountry.getNavies();
-	std::ofstream legacyNavy(
+	HoI4::OutputFile legacyNavy(
 		 "output/" + theConfiguration.getOutputName() + "/history/units/" + tag + "_1936_naval_legacy.txt");
 	outputLegacyNavies(navies, *technologies, tag, legacyNavy);
 
-	std::ofstream mtgNavy(
+	HoI4::OutputFile mtgNavy(
 		 "output/" + theConfiguration.getOutputName() + "/history/units/" + tag + "_1936_naval_mtg.txt");
 	outputMtgNavies(navies, *technologies, tag, mtgNavy);
 }
@@ -815,13 +805,8 @@ void outputOOB(const std::vector<HoI4::DivisionTemplateType>& divisionTemplates,
 void outputCommonCountryFile(const HoI4::Country& theCountry, const Configuration& theConfiguration)
 {
 	const auto& commonCountryFile = theCountry.getCommonCountryFile();
-	std::ofstream output("output/" + theConfiguration.getOutputName() + "/common/countries/" +
+	HoI4::OutputFile output("output/" + theConfiguration.getOutputName() + "/common/countries/" +
 								commonItems::normalizeUTF8Path(commonCountryFile));
-	if (!output.is_open())
-	{
-		throw std::runtime_error("Could not open output/" + theConfiguration.getOutputName() + "/common/countries/" +
-										 commonItems::normalizeUTF8Path(commonCountryFile));
-	}
 
 	auto& graphicalCulture = theCountry.getGraphicalCulture();
 	auto& graphicalCulture2d = theCountry.getGraphicalCulture2d();
@@ -840,12 +825,7 @@ void outputAdvisorIdeas(const std::string& tag,
 	 const std::set<HoI4::Advisor>& ideologicalAdvisors,
 	 const Configuration& theConfiguration)
 {
-	std::ofstream ideasFile("output/" + theConfiguration.getOutputName() + "/common/ideas/" + tag + ".txt");
-	if (!ideasFile.is_open())
-	{
-		throw std::runtime_error(
-			 "Could not open output/" + theConfiguration.getOutputName() + "/common/ideas/" + tag + ".txt");
-	}
+	HoI4::OutputFile ideasFile("output/" + theConfiguration.getOutputName() + "/common/ideas/" + tag + ".txt");
 
 	ideasFile << "ideas = {\n";
 	ideasFile << "\tpolitical_advisor = {\n";
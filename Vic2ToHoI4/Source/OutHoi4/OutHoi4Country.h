@@ -11,6 +11,7 @@
 #include "Mappers/GraphicsMapper.h"
 #include <ostream>
 #include <set>
+#include <string>
 #include <vector>
 
 
@@ -23,7 +24,8 @@ void outputColors(std::ostream& out, const Country& theCountry);
 void outputToNamesFiles(std::ostream& namesFile, const Names& names, const Country& theCountry);
 void outputToUnitNamesFiles(const Country& theCountry, const Configuration& theConfiguration);
 void outputIdeaGraphics(std::ostream& ideasFile, const Country& theCountry);
-void outputCountry(const std::set<Advisor>& ideologicalMinisters,
+// returns the warnings raised while writing, for the caller to log
+std::vector<std::string> outputCountry(const std::set<Advisor>& ideologicalMinisters,
 	 const std::vector<DivisionTemplateType>& divisionTemplates,
 	 const Country& theCountry,
 	 const Configuration& theConfiguration);
@@ -19,6 +19,8 @@
 #include "OutHoi4Country.h"
 #include "OutLocalisation.h"
 #include "OutOnActions.h"
+#include "OutputSink.h"
+#include "ParallelMap.h"
 #include "ScriptedEffects/OutScriptedEffects.h"
 #include "ScriptedLocalisations/OutScriptedLocalisations.h"
 #include "ScriptedTriggers/OutScriptedTriggers.h"
@@ -45,6 +47,7 @@ void outputColorsFile(const std::map<std::string, std::shared_ptr<Country>>& cou
 void outputNames(const Names& names,
 	 const std::map<std::string, std::shared_ptr<Country>>& countries,
 	 const std::string& outputName);
+std::vector<const Country*> getCountriesToOutput(const std::map<std::string, std::shared_ptr<Country>>& countries);
 void outputUnitNames(const std::map<std::string, std::shared_ptr<Country>>& countries,
 	 const Configuration& theConfiguration);
 void outputMap(const States& states, const StrategicRegions& strategicRegions, const std::string& outputName);
@@ -160,11 +163,6 @@ void HoI4::OutputWorld(const World& world,
 
 	Log(LogLevel::Info) << "\tOutputting world";
 
-	if (!commonItems::TryCreateFolder("output/" + outputName + "/history"))
-	{
-		throw std::runtime_error("Could not create output/" + outputName + "/history");
-	}
-
 	outputCommonCountries(world.getCountries(), outputName);
 	outputColorsFile(world.getCountries(), outputName);
 	outputNames(world.getNames(), world.getCountries(), outputName);
@@ -207,16 +205,7 @@ void HoI4::outputCommonCountries(const std::map<std::string, std::shared_ptr<Cou
 	 const std::string& outputName)
 {
 	Log(LogLevel::Info) << "\t\tCreating country tags";
-	if (!commonItems::TryCreateFolder("output/" + outputName + "/common/country_tags"))
-	{
-		throw std::runtime_error("Could not create output/" + outputName + "/common/country_tags");
-	}
-
-	std::ofstream allCountriesFile("output/" + outputName + "/common/country_tags/00_countries.txt");
-	if (!allCountriesFile.is_open())
-	{
-		throw std::runtime_error("Could not create output/" + outputName + "/common/country_tags/00_countries.txt");
-	}
+	OutputFile allCountriesFile("output/" + outputName + "/common/country_tags/00_countries.txt");
 
 	for (const auto& country: countries)
 	{
@@ -244,16 +233,7 @@ void HoI4::outputColorsFile(const std::map<std::string, std::shared_ptr<Country>
 {
 	Log(LogLevel::Info) << "\t\tWriting country colors";
 
-	if (!commonItems::TryCreateFolder("output/" + outputName + "/common/countries"))
-	{
-		throw std::runtime_error("Could not create output/" + outputName + "/common/countries");
-	}
-
-	std::ofstream output("output/" + outputName + "/common/countries/colors.txt");
-	if (!output.is_open())
-	{
-		throw std::runtime_error("Could not open output/" + outputName + "/common/countries/colors.txt");
-	}
+	OutputFile output("output/" + outputName + "/common/countries/colors.txt");
 
 	output << "#reload countrycolors\n";
 	for (const auto& country: countries)
@@ -274,11 +254,7 @@ void HoI4::outputNames(const Names& names,
 {
 	Log(LogLevel::Info) << "\t\tWriting names";
 
-	std::ofstream namesFile("output/" + outputName + "/common/names/01_names.txt");
-	if (!namesFile.is_open())
-	{
-		throw std::runtime_error("Could not open output/" + outputName + "/common/names/01_names.txt");
-	}
+	OutputFile namesFile("output/" + outputName + "/common/names/01_names.txt");
 
 	namesFile << "\xEF\xBB\xBF"; // add the BOM to make HoI4 happy
 
@@ -292,18 +268,30 @@ void HoI4::outputNames(const Names& names,
 }
 
 
-void HoI4::outputUnitNames(const std::map<std::string, std::shared_ptr<Country>>& countries,
-	 const Configuration& theConfiguration)
+// only countries with a capital are written out
+std::vector<const HoI4::Country*> HoI4::getCountriesToOutput(
+	 const std::map<std::string, std::shared_ptr<Country>>& countries)
 {
-	Log(LogLevel::Info) << "\t\tWriting unit names";
-
-	for (const auto& country: countries)
+	std::vector<const Country*> countriesToOutput;
+	for (const auto& [unused, country]: countries)
 	{
-		if (country.second->getCapitalState())
+		if (country->getCapitalState())
 		{
-			outputToUnitNamesFiles(*country.second, theConfiguration);
+			countriesToOutput.push_back(country.get());
 		}
 	}
+	return countriesToOutput;
+}
+
+
+void HoI4::outputUnitNames(const std::map<std::string, std::shared_ptr<Country>>& countries,
+	 const Configuration& theConfiguration)
+{
+	Log(LogLevel::Info) << "\t\tWriting unit names";
+
+	parallelForEach(getCountriesToOutput(countries), [&theConfiguration](const Country* country) {
+		outputToUnitNamesFiles(*country, theConfiguration);
+	});
 }
 
 
@@ -311,16 +299,7 @@ void HoI4::outputMap(const States& states, const StrategicRegions& strategicRegi
 {
 	Log(LogLevel::Info) << "\t\tWriting map info";
 
-	if (!commonItems::TryCreateFolder("output/" + outputName + "/map"))
-	{
-		throw std::runtime_error("Could not create output/" + outputName + "/map");
-	}
-
-	std::ofstream rocketSitesFile("output/" + outputName + "/map/rocketsites.txt");
-	if (!rocketSitesFile.is_open())
-	{
-		throw std::runtime_error("Could not create output/" + outputName + "/map/rocketsites.txt");
-	}
+	OutputFile rocketSitesFile("output/" + outputName + "/map/rocketsites.txt");
 	for (const auto& state: states.getStates())
 	{
 		if (auto provinces = state.second.getProvinces(); !provinces.empty())
@@ -338,11 +317,6 @@ void HoI4::outputGenericFocusTree(const HoI4FocusTree& genericFocusTree, const s
 {
 	Log(LogLevel::Info) << "\t\tWriting generic focus tree";
 
-	if (!commonItems::TryCreateFolder("output/" + outputName + "/common/national_focus"))
-	{
-		throw std::runtime_error("Could not create output/" + outputName + "/common/national_focus");
-	}
-
 	outputSharedFocuses(genericFocusTree, "output/" + outputName + "/common/national_focus/shared_focuses.txt");
 }
 
@@ -355,40 +329,23 @@ void HoI4::outputCountries(const std::set<Advisor>& activeIdeologicalAdvisors,
 {
 	Log(LogLevel::Info) << "\t\tWriting countries";
 
-	if (!commonItems::TryCreateFolder("output/" + outputName + "/history"))
-	{
-		throw std::runtime_error("Could not create output/" + outputName + "/history");
-	}
-	if (!commonItems::TryCreateFolder("output/" + outputName + "/history/countries"))
-	{
-		throw std::runtime_error("Could not create output/" + outputName + "/history/countries");
-	}
-	if (!commonItems::TryCreateFolder("output/" + outputName + "/history/states"))
-	{
-		throw std::runtime_error("Could not create output/" + outputName + "/history/states");
-	}
-	if (!commonItems::TryCreateFolder("output/" + outputName + "/history/units"))
-	{
-		throw std::runtime_error("Could not create output/" + outputName + "/history/units");
-	}
-
-	for (const auto& country: countries)
-	{
-		if (country.second->getCapitalState())
+	// each country writes only its own files, so the countries are written side by side. Their warnings are logged
+	// afterwards, from this thread and in country order.
+	const auto& divisionTemplates =
+		 theMilitaryMappings.getMilitaryMappings(theConfiguration.getVic2Mods()).getDivisionTemplates();
+	const auto countryWarnings = parallelMap(getCountriesToOutput(countries),
+		 [&activeIdeologicalAdvisors, &divisionTemplates, &theConfiguration](const Country* country) {
+			 return outputCountry(activeIdeologicalAdvisors, divisionTemplates, *country, theConfiguration);
+		 });
+	for (const auto& warnings: countryWarnings)
+	{
+		for (const auto& warning: warnings)
 		{
-			const auto& specificMilitaryMappings = theMilitaryMappings.getMilitaryMappings(theConfiguration.getVic2Mods());
-			outputCountry(activeIdeologicalAdvisors,
-				 specificMilitaryMappings.getDivisionTemplates(),
-				 *country.second,
-				 theConfiguration);
+			Log(LogLevel::Warning) << warning;
 		}
 	}
 
-	std::ofstream ideasFile("output/" + outputName + "/interface/converter_ideas.gfx");
-	if (!ideasFile.is_open())
-	{
-		throw std::runtime_error("Could not open output/" + outputName + "/interface/converter_ideas.gfx");
-	}
+	OutputFile ideasFile("output/" + outputName + "/interface/converter_ideas.gfx");
 
 	ideasFile << "spriteTypes = {\n";
 	for (const auto& country: countries)
@@ -407,16 +364,7 @@ void HoI4::outputRelations(const std::string& outputName)
 {
 	Log(LogLevel::Info) << "\t\tWriting opinion modifiers";
 
-	if (!commonItems::TryCreateFolder("output/" + outputName + "/common/opinion_modifiers"))
-	{
-		throw std::runtime_error("Could not create output/" + outputName + "/common/opinion_modifiers/");
-	}
-	std::ofstream out("output/" + outputName + "/common/opinion_modifiers/01_opinion_modifiers.txt");
-	if (!out.is_open())
-	{
-		throw std::runtime_error(
-			 "Could not create output/" + outputName + "/common/opinion_modifiers/01_opinion_modifiers.txt");
-	}
+	OutputFile out("output/" + outputName + "/common/opinion_modifiers/01_opinion_modifiers.txt");
 
 	out << "opinion_modifiers = {\n";
 	for (auto i = -200; i <= 200; i++)
@@ -462,11 +410,7 @@ void HoI4::outputLeaderTraits(const std::map<std::string, std::vector<std::strin
 {
 	Log(LogLevel::Info) << "\t\tWriting leader traits";
 
-	std::ofstream traitsFile("output/" + outputName + "/common/country_leader/converterTraits.txt");
-	if (!traitsFile.is_open())
-	{
-		throw std::runtime_error("Could not create output/" + outputName + "/common/country_leader/converterTraits.txt");
-	}
+	OutputFile traitsFile("output/" + outputName + "/common/country_leader/converterTraits.txt");
 
 	traitsFile << "leader_traits = {\n";
 	for (const auto& majorIdeology: majorIdeologies)
@@ -493,11 +437,7 @@ void HoI4::outputBookmarks(const std::vector<std::shared_ptr<Country>>& greatPow
 {
 	Log(LogLevel::Info) << "\t\tWriting bookmarks";
 
-	std::ofstream bookmarkFile("output/" + outputName + "/common/bookmarks/the_gathering_storm.txt");
-	if (!bookmarkFile.is_open())
-	{
-		throw std::runtime_error("Could not create output/" + outputName + "/common/bookmarks/the_gathering_storm.txt");
-	}
+	OutputFile bookmarkFile("output/" + outputName + "/common/bookmarks/the_gathering_storm.txt");
 
 	bookmarkFile << "bookmarks = {\n";
 	bookmarkFile << "\tbookmark = {\n";
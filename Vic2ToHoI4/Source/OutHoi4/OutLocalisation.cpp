@@ -2,7 +2,7 @@
 #include "Configuration.h"
 #include "Log.h"
 #include "OSCompatibilityLayer.h"
-#include <fstream>
+#include "OutputSink.h"
 
 
 
@@ -14,11 +14,7 @@ void outputLocalisations(const std::string& filenameStart, const HoI4::languageT
 		{
 			continue;
 		}
-		std::ofstream localisationFile(filenameStart + languageToLocalisations.first + ".yml", std::ios_base::app);
-		if (!localisationFile.is_open())
-		{
-			throw std::runtime_error("Could not update localisation text file");
-		}
+		HoI4::OutputFile localisationFile(filenameStart + languageToLocalisations.first + ".yml", std::ios_base::app);
 		localisationFile << "\xEF\xBB\xBF"; // output a BOM to make HoI4 happy
 		localisationFile << "l_" << languageToLocalisations.first << ":\n";
 
@@ -39,12 +35,8 @@ void outputStateLocalisations(const std::string& localisationPath,
 		{
 			continue;
 		}
-		std::ofstream localisationFile(localisationPath + "/state_names_l_" + languageToLocalisations.first + ".yml",
+		HoI4::OutputFile localisationFile(localisationPath + "/state_names_l_" + languageToLocalisations.first + ".yml",
 			 std::ios_base::app);
-		if (!localisationFile.is_open())
-		{
-			throw std::runtime_error("Could not update state localisation text file");
-		}
 		localisationFile << "\xEF\xBB\xBF"; // output a BOM to make HoI4 happy
 		localisationFile << "l_" << languageToLocalisations.first << ":\n";
 
@@ -60,11 +52,6 @@ void HoI4::outputLocalisation(const Localisation& localisation, const std::strin
 {
 	Log(LogLevel::Debug) << "Writing localisations";
 	const auto localisationPath = "output/" + outputName + "/localisation";
-	if (!commonItems::TryCreateFolder(localisationPath))
-	{
-		throw std::runtime_error("Could not create localisation folder");
-	}
-
 	outputLocalisations(localisationPath + "/countries_mod_l_", localisation.getCountryLocalisations());
 	outputLocalisations(localisationPath + "/focus_mod_l_", localisation.getNewFocuses());
 	outputStateLocalisations(localisationPath, localisation.getStateLocalisations());
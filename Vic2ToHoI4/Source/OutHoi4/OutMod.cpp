@@ -3,30 +3,16 @@
 #include "OSCompatibilityLayer.h"
 #include "OutFlags.h"
 #include "OutHoi4World.h"
+#include "OutputSink.h"
 #include <string>
 
 
 
-void createOutputFolder(const std::string& outputName);
+void createOutputFolder();
 void createModFiles(const std::string& outputName);
 
 
 
-void clearOutputFolder(const std::string& outputName)
-{
-	const auto outputFolder = "output/" + outputName;
-	if (commonItems::DoesFolderExist(outputFolder))
-	{
-		Log(LogLevel::Info) << "Removing pre-existing copy of " << outputName;
-		if (!commonItems::DeleteFolder(outputFolder))
-		{
-			throw std::runtime_error("Could not remove pre-existing output folder " + outputFolder +
-											 ". Please delete folder and try converting again.");
-		}
-	}
-}
-
-
 void output(const HoI4::World& destWorld,
 	 const std::string& outputName,
 	 const bool debugEnabled,
@@ -37,24 +23,26 @@ void output(const HoI4::World& destWorld,
 	Log(LogLevel::Progress) << "45%";
 	Log(LogLevel::Info) << "Outputting mod";
 
-	createOutputFolder(outputName);
-	createModFiles(outputName);
-	copyFlags(destWorld.getCountries(), outputName, vic2Mods, vic2ModPath);
-	OutputWorld(destWorld, outputName, debugEnabled, theConfiguration);
+	createOutputFolder();
+
+	// the mod is gathered in memory and only replaces any earlier copy once it is complete
+	HoI4::MemorySink sink("output/" + outputName, "blankMod/output");
+	{
+		const HoI4::OutputSinkScope scope(sink);
+		createModFiles(outputName);
+		copyFlags(destWorld.getCountries(), outputName, vic2Mods, vic2ModPath);
+		OutputWorld(destWorld, outputName, debugEnabled, theConfiguration);
+	}
+	sink.commit();
 }
 
 
-void createOutputFolder(const std::string& outputName)
+void createOutputFolder()
 {
-	Log(LogLevel::Info) << "\tCopying blank mod";
 	if (!commonItems::TryCreateFolder("output"))
 	{
 		throw std::runtime_error("Could not create output folder");
 	}
-	if (!commonItems::CopyFolder("blankMod/output", "output/" + outputName))
-	{
-		throw std::runtime_error("Could not copy blankMod");
-	}
 }
 
 
@@ -62,11 +50,7 @@ void createModFiles(const std::string& outputName)
 {
 	Log(LogLevel::Info) << "\tCreating .mod files";
 
-	std::ofstream modFile("output/" + outputName + ".mod");
-	if (!modFile.is_open())
-	{
-		throw std::runtime_error("Could not create .mod file");
-	}
+	HoI4::OutputFile modFile("output/" + outputName + ".mod");
 	modFile << "name = \"Converted - " << outputName << "\"\n";
 	modFile << "path = \"mod/" << outputName << "/\"\n";
 	modFile << "user_dir = \"" << outputName << "_user_dir\"\n";
@@ -76,11 +60,7 @@ void createModFiles(const std::string& outputName)
 	modFile << "supported_version=\"1.10.*\"";
 	modFile.close();
 
-	std::ofstream descriptorFile("output/" + outputName + "/descriptor.mod");
-	if (!descriptorFile.is_open())
-	{
-		throw std::runtime_error("Could not create descriptor.mod");
-	}
+	HoI4::OutputFile descriptorFile("output/" + outputName + "/descriptor.mod");
 	descriptorFile << "name = \"Converted - " << outputName << "\"\n";
 	descriptorFile << "replace_path=\"common/ideologies\"\n";
 	descriptorFile << "replace_path=\"history/countries\"\n";
@@ -7,7 +7,6 @@
 
 
 
-void clearOutputFolder(const std::string& outputName);
 void output(const HoI4::World& destWorld,
 	 const std::string& outputName,
 	 bool debugEnabled,
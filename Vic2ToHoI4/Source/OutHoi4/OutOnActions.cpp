@@ -1,5 +1,5 @@
 #include "OutOnActions.h"
-#include <fstream>
+#include "OutputSink.h"
 
 
 
@@ -12,11 +12,7 @@ void HoI4::outputOnActions(const OnActions& onActions,
 	 const std::set<std::string>& majorIdeologies,
 	 const std::string& outputName)
 {
-	std::ofstream onActionsFile("output/" + outputName + "/common/on_actions/99_converter_on_actions.txt");
-	if (!onActionsFile.is_open())
-	{
-		throw std::runtime_error("Could not create NF_events.txt");
-	}
+	OutputFile onActionsFile("output/" + outputName + "/common/on_actions/99_converter_on_actions.txt");
 
 	onActionsFile << "on_actions = {\n";
 	onActionsFile << "\t# country\n";
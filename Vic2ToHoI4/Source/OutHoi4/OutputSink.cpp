@@ -0,0 +1,384 @@
+#include "OutputSink.h"
+#include "Log.h"
+#include "OSCompatibilityLayer.h"
+#include "ParallelMap.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+
+
+namespace
+{
+
+HoI4::DirectorySink directorySink;
+HoI4::OutputSink* activeSink = &directorySink;
+std::mutex folderCreationMutex;
+
+
+std::string normalizePath(std::string path)
+{
+	std::ranges::replace(path, '\\', '/');
+	path.erase(std::unique(path.begin(),
+						path.end(),
+						[](const char first, const char second) {
+							return first == '/' && second == '/';
+						}),
+		 path.end());
+	return path;
+}
+
+
+std::string getParentFolder(const std::string& path)
+{
+	const auto lastSlash = path.find_last_of('/');
+	if (lastSlash == std::string::npos)
+	{
+		return {};
+	}
+	return path.substr(0, lastSlash);
+}
+
+
+void createParentFolder(const std::string& path)
+{
+	std::scoped_lock lock(folderCreationMutex);
+	if (const auto parentFolder = getParentFolder(path);
+		 !parentFolder.empty() && !commonItems::TryCreateFolder(parentFolder))
+	{
+		throw std::runtime_error("Could not create " + parentFolder);
+	}
+}
+
+
+struct BaseFile
+{
+	std::string source;
+	std::string destination;
+	bool continued = false;
+};
+
+
+// returns the path on failure
+std::optional<std::string> writeToDisk(const std::string& path,
+	 std::string_view contents,
+	 const std::ios_base::openmode mode)
+{
+	std::ofstream file(path, mode);
+	file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+	file.close();
+	if (!file)
+	{
+		return path;
+	}
+	return std::nullopt;
+}
+
+
+// Base files that the mod takes unchanged are hard linked into it, which costs no copying. Where the file system does
+// not allow that, or when the mod continues the file and would otherwise append to the shared original, it is copied.
+bool installBaseFile(const std::string& source, const std::string& destination, const bool mayLink)
+{
+	if (mayLink)
+	{
+		std::error_code error;
+		std::filesystem::create_hard_link(std::filesystem::path(std::u8string(source.begin(), source.end())),
+			 std::filesystem::path(std::u8string(destination.begin(), destination.end())),
+			 error);
+		if (!error)
+		{
+			return true;
+		}
+	}
+
+	return commonItems::TryCopyFile(source, destination);
+}
+
+} // namespace
+
+
+
+void HoI4::DirectorySink::writeFile(const std::string& path, std::string contents)
+{
+	createParentFolder(path);
+	if (const auto failure = writeToDisk(path, contents, std::ios_base::out); failure)
+	{
+		throw std::runtime_error("Could not write " + *failure);
+	}
+}
+
+
+void HoI4::DirectorySink::writeBinaryFile(const std::string& path, std::string contents)
+{
+	createParentFolder(path);
+	if (const auto failure = writeToDisk(path, contents, std::ios_base::out | std::ios_base::binary); failure)
+	{
+		throw std::runtime_error("Could not write " + *failure);
+	}
+}
+
+
+void HoI4::DirectorySink::appendToFile(const std::string& path, std::string_view contents)
+{
+	createParentFolder(path);
+	if (const auto failure = writeToDisk(path, contents, std::ios_base::app); failure)
+	{
+		throw std::runtime_error("Could not write " + *failure);
+	}
+}
+
+
+HoI4::MemorySink::MemorySink(std::string modFolder, std::string baseFolder):
+	 modFolder(normalizePath(std::move(modFolder))), baseFolder(normalizePath(std::move(baseFolder)))
+{
+}
+
+
+void HoI4::MemorySink::writeFile(const std::string& path, std::string contents)
+{
+	std::scoped_lock lock(filesMutex);
+	files[normalizePath(path)] = File{.contents = std::move(contents)};
+}
+
+
+void HoI4::MemorySink::writeBinaryFile(const std::string& path, std::string contents)
+{
+	std::scoped_lock lock(filesMutex);
+	files[normalizePath(path)] = File{.contents = std::move(contents), .binary = true};
+}
+
+
+void HoI4::MemorySink::appendToFile(const std::string& path, std::string_view contents)
+{
+	std::scoped_lock lock(filesMutex);
+	const auto [file, inserted] = files.try_emplace(normalizePath(path));
+	if (inserted)
+	{
+		file->second.continuesExistingFile = true;
+	}
+	file->second.contents += contents;
+}
+
+
+std::optional<std::string_view> HoI4::MemorySink::getFile(const std::string& path) const
+{
+	std::scoped_lock lock(filesMutex);
+	if (const auto file = files.find(normalizePath(path)); file != files.end())
+	{
+		return file->second.contents;
+	}
+	return std::nullopt;
+}
+
+
+std::optional<std::string> HoI4::MemorySink::getPathInMod(const std::string& path) const
+{
+	if (path.size() <= modFolder.size() || !path.starts_with(modFolder) || path[modFolder.size()] != '/')
+	{
+		return std::nullopt;
+	}
+	return path.substr(modFolder.size() + 1);
+}
+
+
+void HoI4::MemorySink::commit(const unsigned int numThreads) const
+{
+	std::scoped_lock lock(filesMutex);
+	Log(LogLevel::Info) << "\tWriting " << files.size() << " files to " << modFolder;
+
+	const auto scratchFolder = modFolder + "-incomplete";
+	const auto replacedFolder = modFolder + "-replaced";
+	if (commonItems::DoesFolderExist(scratchFolder) && !commonItems::DeleteFolder(scratchFolder))
+	{
+		throw std::runtime_error("Could not remove " + scratchFolder + ". Please delete folder and try converting again.");
+	}
+
+	std::set<std::string> folders{scratchFolder};
+	std::vector<BaseFile> baseFiles;
+	if (commonItems::DoesFolderExist(baseFolder))
+	{
+		for (const auto& baseFile: commonItems::GetAllFilesInFolderRecursive(baseFolder))
+		{
+			const auto pathInMod = normalizePath(baseFile);
+			const auto file = files.find(modFolder + '/' + pathInMod);
+			if (file != files.end() && !file->second.continuesExistingFile)
+			{
+				continue;
+			}
+			baseFiles.push_back(BaseFile{.source = baseFolder + '/' + pathInMod,
+				 .destination = scratchFolder + '/' + pathInMod,
+				 .continued = file != files.end()});
+			folders.insert(getParentFolder(baseFiles.back().destination));
+		}
+	}
+
+	std::vector<std::pair<std::string, const File*>> modFiles;
+	for (const auto& [path, file]: files)
+	{
+		if (const auto pathInMod = getPathInMod(path); pathInMod)
+		{
+			modFiles.emplace_back(scratchFolder + '/' + *pathInMod, &file);
+			folders.insert(getParentFolder(modFiles.back().first));
+		}
+	}
+
+	for (const auto& folder: folders)
+	{
+		if (!commonItems::TryCreateFolder(folder))
+		{
+			throw std::runtime_error("Could not create " + folder);
+		}
+	}
+
+	// files that continue a base file are appended to its copy, so every base file has to be in place first
+	auto failures = parallelMap(
+		 baseFiles,
+		 [](const BaseFile& baseFile) -> std::optional<std::string> {
+			 if (!installBaseFile(baseFile.source, baseFile.destination, !baseFile.continued))
+			 {
+				 return baseFile.destination;
+			 }
+			 return std::nullopt;
+		 },
+		 numThreads);
+	const auto writeFailures = parallelMap(
+		 modFiles,
+		 [](const std::pair<std::string, const File*>& modFile) {
+			 auto mode = modFile.second->continuesExistingFile ? std::ios_base::app : std::ios_base::out;
+			 if (modFile.second->binary)
+			 {
+				 mode |= std::ios_base::binary;
+			 }
+			 return writeToDisk(modFile.first, modFile.second->contents, mode);
+		 },
+		 numThreads);
+	failures.insert(failures.end(), writeFailures.begin(), writeFailures.end());
+	if (const auto failure = std::ranges::find_if(failures,
+			  [](const std::optional<std::string>& possibleFailure) {
+				  return possibleFailure.has_value();
+			  });
+		 failure != failures.end())
+	{
+		commonItems::DeleteFolder(scratchFolder);
+		throw std::runtime_error("Could not write " + **failure);
+	}
+
+	if (commonItems::DoesFolderExist(modFolder))
+	{
+		if (commonItems::DoesFolderExist(replacedFolder))
+		{
+			commonItems::DeleteFolder(replacedFolder);
+		}
+		if (!commonItems::RenameFolder(modFolder, replacedFolder))
+		{
+			throw std::runtime_error("Could not replace pre-existing output folder " + modFolder +
+											 ". Please delete folder and try converting again.");
+		}
+	}
+	if (!commonItems::RenameFolder(scratchFolder, modFolder))
+	{
+		commonItems::RenameFolder(replacedFolder, modFolder);
+		throw std::runtime_error("Could not move " + scratchFolder + " to " + modFolder);
+	}
+	if (commonItems::DoesFolderExist(replacedFolder) && !commonItems::DeleteFolder(replacedFolder))
+	{
+		Log(LogLevel::Warning) << "Could not remove " << replacedFolder;
+	}
+
+	for (const auto& [path, file]: files)
+	{
+		if (!getPathInMod(path))
+		{
+			if (file.binary)
+			{
+				directorySink.writeBinaryFile(path, file.contents);
+			}
+			else if (file.continuesExistingFile)
+			{
+				directorySink.appendToFile(path, file.contents);
+			}
+			else
+			{
+				directorySink.writeFile(path, file.contents);
+			}
+		}
+	}
+}
+
+
+HoI4::OutputSinkScope::OutputSinkScope(OutputSink& sink): previousSink(activeSink)
+{
+	activeSink = &sink;
+}
+
+
+HoI4::OutputSinkScope::~OutputSinkScope()
+{
+	activeSink = previousSink;
+}
+
+
+HoI4::OutputSink& HoI4::getOutputSink()
+{
+	return *activeSink;
+}
+
+
+HoI4::OutputFile::OutputFile(std::string path, const std::ios_base::openmode mode)
+{
+	open(std::move(path), mode);
+}
+
+
+HoI4::OutputFile::OutputFile(OutputFile&& other) noexcept:
+	 std::ostringstream(std::move(other)), path(std::move(other.path)), append(other.append)
+{
+	other.path.reset();
+}
+
+
+HoI4::OutputFile::~OutputFile()
+{
+	try
+	{
+		close();
+	}
+	catch (const std::exception& e)
+	{
+		Log(LogLevel::Error) << e.what();
+	}
+}
+
+
+void HoI4::OutputFile::open(std::string newPath, const std::ios_base::openmode mode)
+{
+	close();
+	path = std::move(newPath);
+	append = (mode & std::ios_base::app) != 0;
+}
+
+
+void HoI4::OutputFile::close()
+{
+	if (!path)
+	{
+		return;
+	}
+
+	const auto finishedPath = std::move(*path);
+	path.reset();
+	if (append)
+	{
+		getOutputSink().appendToFile(finishedPath, str());
+	}
+	else
+	{
+		getOutputSink().writeFile(finishedPath, str());
+	}
+	str({});
+	clear();
+}
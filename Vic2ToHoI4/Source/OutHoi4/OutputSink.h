@@ -0,0 +1,123 @@
+#ifndef OUTPUT_SINK_H
+#define OUTPUT_SINK_H
+
+
+
+#include <ios>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+
+
+
+namespace HoI4
+{
+
+// Where the converted mod's files end up. Writers still name each file by its path under output/, but hand over its
+// finished text in one piece, and the sink decides whether that text reaches the disk right away or later.
+// Sinks accept files from several threads at once.
+class OutputSink
+{
+  public:
+	virtual ~OutputSink() = default;
+
+	virtual void writeFile(const std::string& path, std::string contents) = 0;
+	virtual void writeBinaryFile(const std::string& path, std::string contents) = 0;
+	virtual void appendToFile(const std::string& path, std::string_view contents) = 0;
+};
+
+
+// Writes every file straight to disk, creating folders as needed. Output goes here while no other sink is active.
+class DirectorySink: public OutputSink
+{
+  public:
+	void writeFile(const std::string& path, std::string contents) override;
+	void writeBinaryFile(const std::string& path, std::string contents) override;
+	void appendToFile(const std::string& path, std::string_view contents) override;
+};
+
+
+// Holds every file in memory until commit() puts the whole mod on disk in one pass.
+class MemorySink: public OutputSink
+{
+  public:
+	// The files in modFolder are laid over a copy of baseFolder. A file that is appended to before it is written
+	// continues its namesake in baseFolder.
+	MemorySink(std::string modFolder, std::string baseFolder);
+
+	void writeFile(const std::string& path, std::string contents) override;
+	void writeBinaryFile(const std::string& path, std::string contents) override;
+	void appendToFile(const std::string& path, std::string_view contents) override;
+
+	struct File
+	{
+		std::string contents;
+		bool continuesExistingFile = false;
+		bool binary = false;
+	};
+	[[nodiscard]] const auto& getFiles() const { return files; }
+	[[nodiscard]] std::optional<std::string_view> getFile(const std::string& path) const;
+
+	// Builds the mod in a scratch folder beside modFolder, installing baseFolder and writing the files over it on a pool
+	// of worker threads, then swaps the scratch folder in for modFolder by renaming it. Until that rename, any earlier
+	// copy of the mod is left as it was. Files outside modFolder, such as the .mod file, are written afterwards.
+	// Base files the mod does not touch are hard linked where possible, so they share their storage with baseFolder;
+	// base files the mod continues are always copied.
+	void commit(unsigned int numThreads = std::thread::hardware_concurrency()) const;
+
+  private:
+	[[nodiscard]] std::optional<std::string> getPathInMod(const std::string& path) const;
+
+	std::string modFolder;
+	std::string baseFolder;
+
+	std::map<std::string, File> files;
+	mutable std::mutex filesMutex;
+};
+
+
+// Makes sink the destination of every OutputFile until the scope ends, then restores the previous destination.
+class OutputSinkScope
+{
+  public:
+	explicit OutputSinkScope(OutputSink& sink);
+	~OutputSinkScope();
+	OutputSinkScope(const OutputSinkScope&) = delete;
+	OutputSinkScope& operator=(const OutputSinkScope&) = delete;
+
+  private:
+	OutputSink* previousSink;
+};
+
+[[nodiscard]] OutputSink& getOutputSink();
+
+
+// Used by the output code in place of std::ofstream. The text is gathered in memory and handed to the active sink when
+// the file is closed or destroyed. Nothing touches the disk on open, so a file that cannot be written is reported
+// by the sink rather than by is_open().
+class OutputFile: public std::ostringstream
+{
+  public:
+	OutputFile() = default;
+	explicit OutputFile(std::string path, std::ios_base::openmode mode = std::ios_base::out);
+	OutputFile(OutputFile&& other) noexcept;
+	~OutputFile() override;
+
+	void open(std::string path, std::ios_base::openmode mode = std::ios_base::out);
+	[[nodiscard]] bool is_open() const { return path.has_value(); }
+	void close();
+
+  private:
+	std::optional<std::string> path;
+	bool append = false;
+};
+
+} // namespace HoI4
+
+
+
+#endif // OUTPUT_SINK_H
@@ -1,6 +1,6 @@
 #include "OutScriptedEffects.h"
+#include "OutHoi4/OutputSink.h"
 #include "OutScriptedEffect.h"
-#include <fstream>
 
 
 
@@ -100,24 +100,14 @@ void HoI4::outputScriptedEffects(const ScriptedEffects& scriptedEffects,
 	 const std::set<std::string>& majorIdeologies,
 	 const std::string& outputName)
 {
-	std::ofstream operationStratEffects("output/" + outputName + "/common/scripted_effects/operation_strat_effects.txt");
-	if (!operationStratEffects.is_open())
-	{
-		throw std::runtime_error(
-			 "Could not open output/" + outputName + "/common/scripted_effects/operation_strat_effects.txt");
-	}
+	OutputFile operationStratEffects("output/" + outputName + "/common/scripted_effects/operation_strat_effects.txt");
 	for (const auto& effect: scriptedEffects.getOperationStratEffects())
 	{
 		operationStratEffects << effect << "\n";
 	}
 
-	std::ofstream scriptedEffectsFile("output/" + outputName + "/common/scripted_effects/00_scripted_effects.txt",
+	OutputFile scriptedEffectsFile("output/" + outputName + "/common/scripted_effects/00_scripted_effects.txt",
 		 std::ios::app);
-	if (!scriptedEffectsFile.is_open())
-	{
-		throw std::runtime_error(
-			 "Could not open output/" + outputName + "/common/scripted_effects/00_scripted_effects.txt");
-	}
 
 	outputGetBestAllianceMatchIdeologyEffects(majorIdeologies, scriptedEffectsFile);
 	outputRemoveFromAllowedParty(majorIdeologies, scriptedEffectsFile);
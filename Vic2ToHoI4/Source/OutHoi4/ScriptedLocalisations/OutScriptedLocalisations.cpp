@@ -1,22 +1,22 @@
 #include "OutScriptedLocalisations.h"
+#include "OutHoi4/OutputSink.h"
 #include "OutScriptedLocalisation.h"
-#include <fstream>
 
 
 
 void HoI4::outputScriptedLocalisations(const std::string& outputName,
 	 const ScriptedLocalisations& scriptedLocalisations)
 {
-	std::ofstream scriptedLocalisationsFile(
+	OutputFile scriptedLocalisationsFile(
 		 "output/" + outputName + "/common/scripted_localisation/00_scripted_localisation.txt",
-		 std::ofstream::app);
+		 std::ios_base::app);
 	for (const auto& localisation: scriptedLocalisations.getLocalisations())
 	{
 		scriptedLocalisationsFile << localisation;
 	}
 	scriptedLocalisationsFile.close();
 
-	std::ofstream ideologyLocalisationsFile("output/" + outputName + "/common/scripted_localisation/ideologies.txt");
+	OutputFile ideologyLocalisationsFile("output/" + outputName + "/common/scripted_localisation/ideologies.txt");
 	for (const auto& localisation: scriptedLocalisations.getIdeologyLocalisations())
 	{
 		ideologyLocalisationsFile << localisation;
@@ -27,7 +27,7 @@ void HoI4::outputScriptedLocalisations(const std::string& outputName,
 	{
 		auto filename{"output/" + outputName + "/common/scripted_localisation/000_scripted_localisation_" +
 						  localisationsInLanguage.first + "_loc.txt"};
-		std::ofstream adjectiveLocalisationsFile(filename, std::ofstream::app);
+		OutputFile adjectiveLocalisationsFile(filename, std::ios_base::app);
 
 		for (const auto& localisation: localisationsInLanguage.second)
 		{
@@ -1,11 +1,11 @@
 #include "OutScriptedTriggers.h"
-#include <fstream>
+#include "OutHoi4/OutputSink.h"
 
 
 
 void HoI4::outputScriptedTriggers(const ScriptedTriggers& scriptedTriggers, const std::string& outputName)
 {
-	std::ofstream outIdeology("output/" + outputName + "/common/scripted_triggers/ideology_scripted_triggers.txt",
+	OutputFile outIdeology("output/" + outputName + "/common/scripted_triggers/ideology_scripted_triggers.txt",
 		 std::ostream::app);
 	for (const auto& scriptedTrigger: scriptedTriggers.getIdeologyScriptedTriggers())
 	{
@@ -13,7 +13,7 @@ void HoI4::outputScriptedTriggers(const ScriptedTriggers& scriptedTriggers, cons
 	}
 	outIdeology.close();
 
-	std::ofstream outElections("output/" + outputName + "/common/scripted_triggers/Elections_scripted_triggers.txt",
+	OutputFile outElections("output/" + outputName + "/common/scripted_triggers/Elections_scripted_triggers.txt",
 		 std::ostream::app);
 	for (const auto& scriptedTrigger: scriptedTriggers.getElectionsScriptedTriggers())
 	{
@@ -21,7 +21,7 @@ void HoI4::outputScriptedTriggers(const ScriptedTriggers& scriptedTriggers, cons
 	}
 	outElections.close();
 
-	std::ofstream outLawsWarSupport("output/" + outputName + "/common/scripted_triggers/laws_war_support.txt",
+	OutputFile outLawsWarSupport("output/" + outputName + "/common/scripted_triggers/laws_war_support.txt",
 		 std::ostream::app);
 	for (const auto& scriptedTrigger: scriptedTriggers.getLawsWarSupportTriggers())
 	{
@@ -29,7 +29,7 @@ void HoI4::outputScriptedTriggers(const ScriptedTriggers& scriptedTriggers, cons
 	}
 	outLawsWarSupport.close();
 
-	std::ofstream outNationalFocus(
+	OutputFile outNationalFocus(
 		"output/" + outputName + "/common/scripted_triggers/nf_triggers.txt",
 		std::ostream::app
 	);
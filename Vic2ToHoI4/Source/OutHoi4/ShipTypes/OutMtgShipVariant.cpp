@@ -3,11 +3,20 @@
 
 
 std::ostream& HoI4::operator<<(std::ostream& output, const MtgShipVariant& theVariant)
+{
+	outputMtgShipVariant(output, theVariant, "");
+	return output;
+}
+
+
+void HoI4::outputMtgShipVariant(std::ostream& output,
+	 const MtgShipVariant& theVariant,
+	 const std::string& owningCountryTag)
 {
 	output << "\tcreate_equipment_variant = {\n";
 	output << "\t\tname = \"" << theVariant.name << "\"\n";
 	output << "\t\ttype = " << theVariant.type << "\n";
-	output << "\t\tname_group = " << theVariant.owningCountryTag << "_" << theVariant.nameGroup << "\n";
+	output << "\t\tname_group = " << owningCountryTag << "_" << theVariant.nameGroup << "\n";
 	output << "\t\tparent_version = 0\n";
 	if (theVariant.modules)
 	{
@@ -18,5 +27,4 @@ std::ostream& HoI4::operator<<(std::ostream& output, const MtgShipVariant& theVa
 		output << "\t\tobsolete = yes\n";
 	}
 	output << "\t}\n";
-	return output;
 }
\ No newline at end of file
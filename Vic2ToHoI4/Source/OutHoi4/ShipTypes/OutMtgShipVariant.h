@@ -5,6 +5,7 @@
 
 #include "HOI4World/ShipTypes/MtgShipVariant.h"
 #include <ostream>
+#include <string>
 
 
 
@@ -13,6 +14,9 @@ namespace HoI4
 
 std::ostream& operator<<(std::ostream& output, const MtgShipVariant& theVariant);
 
+// outputs a variant shared between countries with the name group of the country using it
+void outputMtgShipVariant(std::ostream& output, const MtgShipVariant& theVariant, const std::string& owningCountryTag);
+
 }
 
 
@@ -1,4 +1,6 @@
 #include "OutShipVariants.h"
+#include "OutLegacyShipVariant.h"
+#include "OutMtgShipVariant.h"
 
 
 
@@ -7,16 +9,16 @@ std::ostream& HoI4::operator<<(std::ostream& output, const ShipVariants& theVari
 	output << "### VARIANTS ###\n";
 	output << "if = {\n";
 	output << "\tlimit = { not = { has_dlc = \"Man the Guns\" } }\n";
-	for (const auto& variant: theVariants.legacyVariants)
+	for (const auto variant: theVariants.legacyVariants)
 	{
-		output << variant.second;
+		output << (*theVariants.legacyVariantTable)[variant];
 	}
 	output << "}\n";
 	output << "if = {\n";
 	output << "\tlimit = { has_dlc = \"Man the Guns\" }\n";
-	for (const auto& variant: theVariants.mtgVariants)
+	for (const auto variant: theVariants.mtgVariants)
 	{
-		output << variant.second;
+		outputMtgShipVariant(output, (*theVariants.mtgVariantTable)[variant], theVariants.countryTag);
 	}
 	output << "}\n";
 
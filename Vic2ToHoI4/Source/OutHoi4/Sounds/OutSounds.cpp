@@ -1,17 +1,13 @@
 #include "OutSounds.h"
 #include "OSCompatibilityLayer.h"
+#include "OutHoi4/OutputSink.h"
 
-#include <fstream>
 #include <vector>
 
 
 void HoI4::outputSounds(const std::string& outputName, const std::vector<SoundEffect>& soundEffects)
 {
-	std::ofstream output("output/" + outputName + "/sounds/vo_conv.asset", std::ios::app);
-	if (!output.is_open())
-	{
-		throw std::runtime_error("Could not create output/" + outputName + "/sounds/vo_conv.asset");
-	}
+	OutputFile output("output/" + outputName + "/sounds/vo_conv.asset", std::ios::app);
 
 	output << "category = {\n";
 	output << "\tname = \"Voices\"\n";
@@ -2,7 +2,7 @@
 #include "Log.h"
 #include "OSCompatibilityLayer.h"
 #include "OutHoI4State.h"
-#include <fstream>
+#include "OutHoi4/OutputSink.h"
 
 
 
@@ -10,28 +10,16 @@ void HoI4::outputStates(const States& theStates, const std::string& outputName,
 {
 	Log(LogLevel::Info) << "\t\tWriting states";
 
-	if (!commonItems::TryCreateFolder("output/" + outputName + "/history/states"))
-	{
-		throw std::runtime_error("Could not create \"output/" + outputName + "/history/states");
-	}
 	for (const auto& state: theStates.getStates())
 	{
 		auto filename("output/" + outputName + "/history/states/" + std::to_string(state.first) + ".txt");
-		std::ofstream out(filename);
-		if (!out.is_open())
-		{
-			throw std::runtime_error("Could not open \"" + filename + "\"");
-		}
+		OutputFile out(filename);
 		outputHoI4State(out, state.second, debugEnabled);
 		out.close();
 	}
 
 	auto filename("output/" + outputName + "/common/scripted_triggers/state_triggers_FR_loc.txt");
-	std::ofstream out(filename);
-	if (!out.is_open())
-	{
-		throw std::runtime_error("Could not open \"" + filename + "\"");
-	}
+	OutputFile out(filename);
 	for (const auto& [category, stateIds]: theStates.getLanguageCategories())
 	{
 		if (category.empty())
@@ -1,12 +1,12 @@
 #include "outDifficultySettings.h"
-#include <fstream>
+#include "OutputSink.h"
 
 
 
 void HoI4::outputDifficultySettings(const std::vector<std::shared_ptr<Country>>& greatPowers,
 	 const std::string& outputName)
 {
-	std::ofstream outStream;
+	OutputFile outStream;
 
 	outStream.open("output/" + outputName + "/common/difficulty_settings/00_difficulty.txt");
 	outStream << "difficulty_settings = {\n";
@@ -0,0 +1,78 @@
+#ifndef PARALLEL_MAP_H
+#define PARALLEL_MAP_H
+
+
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+
+
+// Applies function to every input using a pool of worker threads and returns the results in input order. Each result
+// is written to the slot of its input, so the output never depends on the number of threads or on scheduling.
+// function must only read shared data; anything it needs to change in shared state has to be applied by the caller
+// afterwards, in input order.
+template <typename Input, typename Function>
+auto parallelMap(const std::vector<Input>& inputs,
+	 Function&& function,
+	 unsigned int numThreads = std::thread::hardware_concurrency())
+{
+	using Result = std::decay_t<std::invoke_result_t<Function&, const Input&>>;
+	std::vector<Result> results(inputs.size());
+
+	numThreads = std::clamp(numThreads, 1U, static_cast<unsigned int>(std::max(inputs.size(), size_t{1})));
+	if (numThreads == 1)
+	{
+		for (size_t i = 0; i < inputs.size(); ++i)
+		{
+			results[i] = function(inputs[i]);
+		}
+		return results;
+	}
+
+	std::atomic<size_t> nextInput = 0;
+	auto worker = [&inputs, &results, &function, &nextInput]() {
+		for (auto i = nextInput++; i < inputs.size(); i = nextInput++)
+		{
+			results[i] = function(inputs[i]);
+		}
+	};
+
+	std::vector<std::future<void>> workers;
+	workers.reserve(numThreads);
+	for (unsigned int i = 0; i < numThreads; ++i)
+	{
+		workers.push_back(std::async(std::launch::async, worker));
+	}
+	for (auto& finishedWorker: workers)
+	{
+		finishedWorker.get();
+	}
+
+	return results;
+}
+
+
+// Applies function to every input on a pool of worker threads, for functions whose only effect is on shared state that
+// is safe to change from several threads at once.
+template <typename Input, typename Function>
+void parallelForEach(const std::vector<Input>& inputs,
+	 Function&& function,
+	 unsigned int numThreads = std::thread::hardware_concurrency())
+{
+	parallelMap(
+		 inputs,
+		 [&function](const Input& input) {
+			 function(input);
+			 return true;
+		 },
+		 numThreads);
+}
+
+
+
+#endif // PARALLEL_MAP_H
@@ -0,0 +1,64 @@
+#ifndef RANDOM_STREAM_H
+#define RANDOM_STREAM_H
+
+
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+
+
+// A counter-based random stream (SplitMix64) seeded from the entity it serves and the purpose of the draw, such as a
+// country tag and "leader_portrait". The same key and purpose always give the same sequence on every platform, no
+// matter what else has been drawn before, so results do not depend on the order in which entities are converted.
+class RandomStream
+{
+  public:
+	RandomStream(std::string_view key, std::string_view purpose): seed(hash(purpose, hash(key, FNV_OFFSET_BASIS))) {}
+
+	[[nodiscard]] uint64_t next() { return mix(seed + (++counter * GOLDEN_GAMMA)); }
+
+	// uniformly distributed in [0, size), size must be positive
+	[[nodiscard]] size_t pick(size_t size)
+	{
+		const auto bound = static_cast<uint64_t>(size);
+		const auto threshold = (0 - bound) % bound;
+		while (true)
+		{
+			if (const auto value = next(); value >= threshold)
+			{
+				return static_cast<size_t>(value % bound);
+			}
+		}
+	}
+
+  private:
+	static constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+	static constexpr uint64_t FNV_PRIME = 0x100000001b3ULL;
+	static constexpr uint64_t GOLDEN_GAMMA = 0x9e3779b97f4a7c15ULL;
+
+	// FNV-1a, with a terminating zero so that ("ab", "c") and ("a", "bc") seed different streams
+	static constexpr uint64_t hash(std::string_view text, uint64_t basis)
+	{
+		for (const auto character: text)
+		{
+			basis = (basis ^ static_cast<unsigned char>(character)) * FNV_PRIME;
+		}
+		return basis * FNV_PRIME;
+	}
+
+	static constexpr uint64_t mix(uint64_t value)
+	{
+		value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+		value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+		return value ^ (value >> 31);
+	}
+
+	uint64_t seed;
+	uint64_t counter = 0;
+};
+
+
+
+#endif // RANDOM_STREAM_H
@@ -7,11 +7,11 @@
 Vic2::AI::Factory::Factory()
 {
 	registerKeyword("conquer_prov", [this](const std::string& strategyType, std::istream& theStream) {
-		ai->conquerStrategies.push_back(*aiStrategyFactory.importStrategy(strategyType, theStream));
+		ai->conquerStrategies.push_back(std::move(*aiStrategyFactory.importStrategy(strategyType, theStream)));
 	});
 	registerRegex("threat|antagonize|befriend|protect|rival",
 		 [this](const std::string& strategyType, std::istream& theStream) {
-			 ai->aiStrategies.push_back(*aiStrategyFactory.importStrategy(strategyType, theStream));
+			 ai->aiStrategies.push_back(std::move(*aiStrategyFactory.importStrategy(strategyType, theStream)));
 		 });
 	registerRegex(commonItems::catchallRegex, commonItems::ignoreItem);
 }
@@ -48,16 +48,16 @@ std::tuple<std::map<std::string, Vic2::CommonCountryData>, std::vector<Vic2::Par
 		auto tag = line.substr(0, 3);
 		auto countryFileName = extractCountryFileName(line);
 		auto countryData = commonCountryDataFactory.importCommonCountryData(countryFileName, vic2Mods, theConfiguration);
-		commonCountriesData[tag] = *countryData;
 		for (const auto& party: countryData->getParties())
 		{
 			parties.emplace_back(party);
 		}
+		commonCountriesData.insert_or_assign(tag, std::move(*countryData));
 	}
 
 	V2CountriesInput.close();
 
-	return std::make_tuple(commonCountriesData, parties);
+	return std::make_tuple(std::move(commonCountriesData), std::move(parties));
 }
 
 
@@ -73,7 +73,7 @@ std::tuple<std::map<std::string, Vic2::CommonCountryData>, std::vector<Vic2::Par
 			 processCountriesDotTxt(modFolder + "/common/countries.txt", theConfiguration.getVic2Mods(), theConfiguration);
 		if (!commonCountriesData.empty())
 		{
-			return std::make_tuple(commonCountriesData, parties);
+			return std::make_tuple(std::move(commonCountriesData), std::move(parties));
 		}
 	}
 
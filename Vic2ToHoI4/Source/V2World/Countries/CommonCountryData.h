@@ -25,7 +25,7 @@ class CommonCountryData
 
 	[[nodiscard]] auto getColor() const { return theColor; }
 	[[nodiscard]] auto getUnitNames() const { return unitNames; }
-	[[nodiscard]] auto getParties() const { return parties; }
+	[[nodiscard]] const auto& getParties() const { return parties; }
 
   private:
 	std::optional<commonItems::Color> theColor;
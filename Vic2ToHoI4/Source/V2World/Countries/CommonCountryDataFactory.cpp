@@ -20,7 +20,7 @@ Vic2::CommonCountryData::Factory::Factory()
 		commonCountryData->unitNames = unitNamesFactory.importUnitNames(theStream);
 	});
 	registerKeyword("party", [this](std::istream& theStream) {
-		commonCountryData->parties.emplace_back(*partyFactory.getParty(theStream));
+		commonCountryData->parties.emplace_back(std::move(*partyFactory.getParty(theStream)));
 	});
 	registerRegex(commonItems::catchallRegex, commonItems::ignoreItem);
 }
@@ -3,8 +3,12 @@
 #include "V2World/Culture/CultureGroups.h"
 #include "V2World/Localisations/Vic2Localisations.h"
 #include "V2World/Pops/Pop.h"
+#include "V2World/Pops/PopSummary.h"
 #include "V2World/Provinces/Province.h"
 #include "V2World/States/State.h"
+#include <algorithm>
+#include <iterator>
+#include <unordered_map>
 
 
 
@@ -15,24 +19,33 @@ void Vic2::Country::eatCountry(Country& target, bool debug)
 		return;
 	}
 
+	states.reserve(states.size() + target.states.size());
 	for (auto& state: target.states)
 	{
 		state.setOwner(tag);
 		states.push_back(std::move(state));
 	}
+	target.states.clear();
+
+	cores.reserve(cores.size() + target.cores.size());
 	for (auto& core: target.cores)
 	{
 		core->addCore(tag);
 		core->removeCore(target.tag);
-		addCore(core);
+		addCore(std::move(core));
 	}
-	for (auto& provinceItr: target.provinces)
+	target.cores.clear();
+
+	for (auto& [unused, province]: target.provinces)
 	{
-		provinceItr.second->setOwner(tag);
-		provinces.insert(provinceItr);
+		province->setOwner(tag);
 	}
-	technologiesAndInventions.insert(target.technologiesAndInventions.begin(), target.technologiesAndInventions.end());
-	armies.insert(armies.end(), target.armies.begin(), target.armies.end());
+	provinces.merge(target.provinces);
+	technologiesAndInventions.merge(target.technologiesAndInventions);
+
+	armies.reserve(armies.size() + target.armies.size());
+	std::move(target.armies.begin(), target.armies.end(), std::back_inserter(armies));
+	target.armies.clear();
 
 	if (debug)
 	{
@@ -41,29 +54,31 @@ void Vic2::Country::eatCountry(Country& target, bool debug)
 }
 
 
+// Partial states with a shared ID are combined into whichever of them comes first. States are moved into place once,
+// so merging is linear in the number of states.
 void Vic2::Country::mergeStates(const StateDefinitions& stateDefinitions)
 {
-	for (auto state = states.begin(); state != states.end(); ++state)
+	std::vector<State> mergedStates;
+	mergedStates.reserve(states.size());
+	std::unordered_map<std::string, size_t> partialStateIndexes;
+
+	for (auto& state: states)
 	{
-		if (!state->isPartialState())
+		const auto stateID = state.getStateID();
+		if (const auto partialState = partialStateIndexes.find(stateID); partialState != partialStateIndexes.end())
 		{
+			mergedStates[partialState->second].eatState(state, stateDefinitions);
 			continue;
 		}
 
-		auto state2 = state;
-		++state2;
-		while (state2 != states.end())
+		if (state.isPartialState())
 		{
-			if (state->getStateID() != state2->getStateID())
-			{
-				++state2;
-				continue;
-			}
-
-			state->eatState(*state2, stateDefinitions);
-			state2 = states.erase(state2);
+			partialStateIndexes.emplace(stateID, mergedStates.size());
 		}
+		mergedStates.push_back(std::move(state));
 	}
+
+	states.swap(mergedStates);
 }
 
 
@@ -163,23 +178,13 @@ void Vic2::Country::handleMissingCulture(const CultureGroups& theCultureGroups)
 
 std::map<std::string, int> Vic2::Country::determineCultureSizes()
 {
-	std::map<std::string, int> cultureSizes;
-
-	for (auto [unused, province]: provinces)
+	PopSummary popSummary;
+	for (const auto& [unused, province]: provinces)
 	{
-		for (const auto& pop: province->getPops())
-		{
-			const auto& popSize = pop.getSize();
-			const auto& popCulture = pop.getCulture();
-			auto [existing, inserted] = cultureSizes.insert(std::make_pair(popCulture, popSize));
-			if (!inserted)
-			{
-				existing->second += pop.getSize();
-			}
-		}
+		popSummary.add(province->getPopSummary());
 	}
 
-	return cultureSizes;
+	return popSummary.getCultureSizes();
 }
 
 
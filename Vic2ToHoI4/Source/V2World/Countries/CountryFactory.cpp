@@ -114,13 +114,13 @@ Vic2::Country::Factory::Factory(const Configuration& theConfiguration,
 		}
 	});
 	registerRegex("[A-Z][A-Z0-9]{2}", [this](const std::string& countryTag, std::istream& theStream) {
-		country->relations.insert(std::make_pair(countryTag, *relationsFactory.getRelations(theStream)));
+		country->relations.emplace(countryTag, std::move(*relationsFactory.getRelations(theStream)));
 	});
 	registerKeyword("ai", [this](std::istream& theStream) {
-		country->vic2AI = *aiFactory.importAI(theStream);
+		country->vic2AI = std::move(*aiFactory.importAI(theStream));
 	});
 	registerKeyword("army", [this](std::istream& theStream) {
-		country->armies.push_back(*armyFactory.getArmy(country->tag, theStream));
+		country->armies.push_back(std::move(*armyFactory.getArmy(country->tag, theStream)));
 	});
 	registerKeyword("navy", [this](std::istream& theStream) {
 		const auto navy = armyFactory.getArmy(country->tag, theStream);
@@ -128,13 +128,13 @@ Vic2::Country::Factory::Factory(const Configuration& theConfiguration,
 		{
 			country->armies.push_back(transportedArmy);
 		}
-		country->armies.push_back(*navy);
+		country->armies.push_back(std::move(*navy));
 	});
 	registerKeyword("leader", [this](std::istream& theStream) {
-		country->leaders.push_back(*leaderFactory->getLeader(theStream));
+		country->leaders.push_back(std::move(*leaderFactory->getLeader(theStream)));
 	});
 	registerKeyword("state", [this, &theStateDefinitions](std::istream& theStream) {
-		country->states.push_back(*stateFactory->getState(theStream, country->tag, theStateDefinitions));
+		country->states.push_back(std::move(*stateFactory->getState(theStream, country->tag, theStateDefinitions)));
 	});
 	registerKeyword("flags", [this](std::istream& theStream) {
 		for (const auto& [flag, unused]: commonItems::assignments{theStream}.getAssignments())
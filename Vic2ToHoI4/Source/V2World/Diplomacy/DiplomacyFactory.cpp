@@ -8,7 +8,7 @@
 Vic2::Diplomacy::Factory::Factory()
 {
 	registerRegex(commonItems::catchallRegex, [this](const std::string& agreementType, std::istream& theStream) {
-		diplomacy->agreements.push_back(*agreementFactory.getAgreement(agreementType, theStream));
+		diplomacy->agreements.push_back(std::move(*agreementFactory.getAgreement(agreementType, theStream)));
 	});
 }
 
@@ -2,8 +2,74 @@
 #include "Configuration.h"
 #include "Log.h"
 #include "OSCompatibilityLayer.h"
+#include <algorithm>
 #include <array>
 #include <fstream>
+#include <iterator>
+
+
+
+namespace
+{
+
+// the encodings of the columns of Vic2 localisation files, in the order of Vic2::localisationLanguages
+constexpr std::array<Vic2::Encoding, Vic2::localisationLanguages.size()> encodings{Vic2::Encoding::Win1252,
+	 Vic2::Encoding::Win1252,
+	 Vic2::Encoding::Win1252,
+	 Vic2::Encoding::Win1250,
+	 Vic2::Encoding::Win1252,
+	 Vic2::Encoding::Win1252,
+	 Vic2::Encoding::Win1250,
+	 Vic2::Encoding::Win1250,
+	 Vic2::Encoding::Win1250,
+	 Vic2::Encoding::Win1252,
+	 Vic2::Encoding::Win1252,
+	 Vic2::Encoding::Win1251,
+	 Vic2::Encoding::Win1252};
+
+
+// the UTF-8 encoding of each character of a codepage
+using TranscodingTable = std::array<std::string, 256>;
+
+template <typename Converter> TranscodingTable makeTranscodingTable(Converter convert)
+{
+	TranscodingTable table;
+	for (size_t character = 0; character < table.size(); ++character)
+	{
+		const std::string rawCharacter(1, static_cast<char>(character));
+		table[character] = (character < 0x80) ? rawCharacter : convert(rawCharacter);
+	}
+
+	return table;
+}
+
+
+const TranscodingTable& getTranscodingTable(const Vic2::Encoding encoding)
+{
+	static const auto win1250Table = makeTranscodingTable([](const std::string& text) {
+		return commonItems::convertWin1250ToUTF8(text);
+	});
+	static const auto win1251Table = makeTranscodingTable([](const std::string& text) {
+		return commonItems::convertWin1251ToUTF8(text);
+	});
+	static const auto win1252Table = makeTranscodingTable([](const std::string& text) {
+		return commonItems::convertWin1252ToUTF8(text);
+	});
+
+	if (encoding == Vic2::Encoding::Win1250)
+	{
+		return win1250Table;
+	}
+	if (encoding == Vic2::Encoding::Win1251)
+	{
+		return win1251Table;
+	}
+
+	// if (encoding == Encoding::Win1252)
+	return win1252Table;
+}
+
+} // namespace
 
 
 
@@ -25,7 +91,10 @@ std::unique_ptr<Vic2::Localisations> Vic2::Localisations::Factory::importLocalis
 		ReadFromFile("Configurables/Vic2Localisations.csv");
 	}
 
-	return std::make_unique<Localisations>(localisations, localisationToKeyMap);
+	textStore.shrink_to_fit();
+	return std::make_unique<Localisations>(std::move(localisations),
+		 std::move(textStore),
+		 std::move(localisationToKeyMap));
 }
 
 
@@ -40,86 +109,83 @@ void Vic2::Localisations::Factory::ReadFromAllFilesInFolder(const std::string& f
 
 void Vic2::Localisations::Factory::ReadFromFile(const std::string& fileName)
 {
-	std::ifstream in(fileName);
+	std::ifstream in(fileName, std::ios::binary);
+	const std::string contents{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+	in.close();
 
-	while (!in.eof())
+	std::string_view remainingContents(contents);
+	while (!remainingContents.empty())
 	{
-		std::string line;
-		getline(in, line);
-		if (line[0] != '#')
+		const auto lineEnd = remainingContents.find('\n');
+		auto line = remainingContents.substr(0, lineEnd);
+		remainingContents.remove_prefix((lineEnd == std::string_view::npos) ? remainingContents.size() : lineEnd + 1);
+
+		if (line.ends_with('\r'))
+		{
+			line.remove_suffix(1);
+		}
+		if (!line.empty() && line.front() != '#')
 		{
 			processLine(line);
 		}
 	}
-
-	in.close();
 }
 
 
-constexpr std::array<std::pair<const char*, Vic2::Encoding>, 13> languages = {{
-	 {"english", Vic2::Encoding::Win1252},
-	 {"french", Vic2::Encoding::Win1252},
-	 {"german", Vic2::Encoding::Win1252},
-	 {"polish", Vic2::Encoding::Win1250},
-	 {"spanish", Vic2::Encoding::Win1252},
-	 {"italian", Vic2::Encoding::Win1252},
-	 {"swedish", Vic2::Encoding::Win1250},
-	 {"czech", Vic2::Encoding::Win1250},
-	 {"hungarian", Vic2::Encoding::Win1250},
-	 {"dutch", Vic2::Encoding::Win1252},
-	 {"braz_por", Vic2::Encoding::Win1252},
-	 {"russian", Vic2::Encoding::Win1251},
-	 {"finnish", Vic2::Encoding::Win1252},
-}};
-void Vic2::Localisations::Factory::processLine(const std::string& line)
+void Vic2::Localisations::Factory::processLine(std::string_view line)
 {
-	auto division = line.find_first_of(';');
-	const auto key = line.substr(0, division);
-
-	for (const auto& [language, encoding]: languages)
+	const auto division = line.find(';');
+	if (division == std::string_view::npos)
 	{
-		auto [rawLocalisation, newDivision] = extractNextLocalisation(line, division);
-		division = newDivision;
+		return;
+	}
+	const std::string key(line.substr(0, division));
+	line.remove_prefix(division + 1);
 
-		auto UTF8Result = convertToUtf8(rawLocalisation, encoding);
+	auto& texts = localisations[key];
+	for (size_t language = 0; language < localisationLanguages.size(); ++language)
+	{
+		const auto rawText = line.substr(0, line.find(';'));
+		line.remove_prefix(std::min(rawText.size() + 1, line.size()));
 
-		if (strcmp(language, "english") == 0)
+		const auto text = transcodeText(rawText, encodings[language]);
+		if (language == 0)
 		{
-			localisationToKeyMap[UTF8Result] = key;
+			localisationToKeyMap[textStore.substr(text.start, text.length)] = key;
 		}
 
-		if (!UTF8Result.empty())
+		if (text.length > 0)
 		{
-			localisations[key][language] = UTF8Result;
+			texts[language] = text;
 		}
-		else if (strcmp(language, "english") != 0)
+		else if (language != 0)
 		{
-			localisations[key][language] = localisations[key]["english"];
+			texts[language].source = TextSource::english;
+			if (texts[0].source == TextSource::none)
+			{
+				texts[0] = Text{static_cast<uint32_t>(textStore.size()), 0, TextSource::own};
+			}
 		}
 	}
 }
 
 
-std::tuple<std::string, size_t> Vic2::Localisations::Factory::extractNextLocalisation(const std::string& line,
-	 size_t division)
+Vic2::Localisations::Text Vic2::Localisations::Factory::transcodeText(std::string_view rawText, Encoding encoding)
 {
-	const auto frontDivision = division + 1;
-	division = line.find_first_of(';', frontDivision);
-	return {line.substr(frontDivision, division - frontDivision), division};
-}
-
+	const auto& table = getTranscodingTable(encoding);
 
-std::string Vic2::Localisations::Factory::convertToUtf8(const std::string& rawLocalisation, Encoding encoding)
-{
-	if (encoding == Encoding::Win1250)
-	{
-		return commonItems::convertWin1250ToUTF8(rawLocalisation);
-	}
-	if (encoding == Encoding::Win1251)
+	const auto start = textStore.size();
+	for (const auto character: rawText)
 	{
-		return commonItems::convertWin1251ToUTF8(rawLocalisation);
+		if (const auto byte = static_cast<unsigned char>(character); byte < 0x80)
+		{
+			textStore += character;
+		}
+		else
+		{
+			textStore += table[byte];
+		}
 	}
 
-	// if (encoding == Encoding::Win1252)
-	return commonItems::convertWin1252ToUTF8(rawLocalisation);
+	return Text{static_cast<uint32_t>(start), static_cast<uint32_t>(textStore.size() - start), TextSource::own};
 }
\ No newline at end of file
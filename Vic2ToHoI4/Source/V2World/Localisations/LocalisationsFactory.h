@@ -5,6 +5,7 @@
 
 #include "Configuration.h"
 #include "Vic2Localisations.h"
+#include <string_view>
 
 
 
@@ -27,11 +28,11 @@ class Localisations::Factory
   private:
 	void ReadFromAllFilesInFolder(const std::string& folderPath);
 	void ReadFromFile(const std::string& fileName);
-	void processLine(const std::string& line);
-	static std::tuple<std::string, size_t> extractNextLocalisation(const std::string& line, size_t division);
-	static std::string convertToUtf8(const std::string& rawLocalisation, Encoding encoding);
+	void processLine(std::string_view line);
+	Text transcodeText(std::string_view rawText, Encoding encoding);
 
-	KeyToLocalisationsMap localisations;
+	std::unordered_map<std::string, TextInEachLanguage> localisations;
+	std::string textStore;
 	std::map<std::string, std::string> localisationToKeyMap;
 };
 
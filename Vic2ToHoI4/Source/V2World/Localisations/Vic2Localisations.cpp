@@ -1,9 +1,46 @@
 #include "Vic2Localisations.h"
 #include "Log.h"
-#include <regex>
 
 
 
+namespace
+{
+
+std::optional<size_t> getLanguageIndex(std::string_view language)
+{
+	for (size_t i = 0; i < Vic2::localisationLanguages.size(); ++i)
+	{
+		if (Vic2::localisationLanguages[i] == language)
+		{
+			return i;
+		}
+	}
+
+	return std::nullopt;
+}
+
+} // namespace
+
+
+
+Vic2::Localisations::Localisations(const KeyToLocalisationsMap& _localisations,
+	 std::map<std::string, std::string> _localisationToKeyMap):
+	 localisationToKeyMap(std::move(_localisationToKeyMap))
+{
+	for (const auto& [key, textInEachLanguage]: _localisations)
+	{
+		auto& texts = localisations[key];
+		for (const auto& [language, text]: textInEachLanguage)
+		{
+			if (const auto languageIndex = getLanguageIndex(language); languageIndex)
+			{
+				texts[*languageIndex] = storeText(text);
+			}
+		}
+	}
+}
+
+
 std::optional<std::string> Vic2::Localisations::getTextInLanguage(const std::string& key,
 	 const std::string& language) const
 {
@@ -13,13 +50,17 @@ std::optional<std::string> Vic2::Localisations::getTextInLanguage(const std::str
 		return std::nullopt;
 	}
 
-	const auto LanguageToLocalisationMapping = KeyToLocalisationsMapping->second.find(language);
-	if (LanguageToLocalisationMapping == KeyToLocalisationsMapping->second.end())
+	const auto languageIndex = getLanguageIndex(language);
+	if (!languageIndex)
 	{
 		return std::nullopt;
 	}
 
-	return LanguageToLocalisationMapping->second;
+	if (const auto text = getText(KeyToLocalisationsMapping->second, *languageIndex); text)
+	{
+		return std::string(*text);
+	}
+	return std::nullopt;
 }
 
 
@@ -31,24 +72,77 @@ Vic2::LanguageToLocalisationMap Vic2::Localisations::getTextInEachLanguage(const
 		return LanguageToLocalisationMap{};
 	}
 
-	return KeyToLocalisationsMappings->second;
+	LanguageToLocalisationMap textInEachLanguage;
+	for (size_t i = 0; i < localisationLanguages.size(); ++i)
+	{
+		if (const auto text = getText(KeyToLocalisationsMappings->second, i); text)
+		{
+			textInEachLanguage.emplace(localisationLanguages[i], *text);
+		}
+	}
+
+	return textInEachLanguage;
+}
+
+
+std::optional<std::string_view> Vic2::Localisations::getText(const TextInEachLanguage& texts, size_t language) const
+{
+	const auto& text = (texts[language].source == TextSource::english) ? texts[0] : texts[language];
+	if (text.source != TextSource::own)
+	{
+		return std::nullopt;
+	}
+
+	return std::string_view(textStore).substr(text.start, text.length);
+}
+
+
+Vic2::Localisations::Text Vic2::Localisations::storeText(std::string_view text)
+{
+	const Text storedText{static_cast<uint32_t>(textStore.size()), static_cast<uint32_t>(text.size()), TextSource::own};
+	textStore += text;
+	return storedText;
 }
 
 
 void Vic2::Localisations::updateDomainCountry(const std::string& tag, const std::string& domainName)
 {
-	if (!localisations.contains(tag))
+	const auto nameInAllLanguages = localisations.find(tag);
+	if (nameInAllLanguages == localisations.end())
 	{
 		return;
 	}
 
-	auto& nameInAllLanguages = localisations.at(tag);
 	const auto& regionLocalisations = lookupRegionLocalisations(domainName);
 
-	for (auto& [language, nameToUpdate]: nameInAllLanguages)
+	// resolve every name before storing any, as untranslated names refer to the English one
+	std::array<std::optional<std::string>, localisationLanguages.size()> updatedNames;
+	for (size_t i = 0; i < localisationLanguages.size(); ++i)
+	{
+		const auto nameToUpdate = getText(nameInAllLanguages->second, i);
+		if (!nameToUpdate)
+		{
+			continue;
+		}
+
+		constexpr std::string_view placeholder = "$REGION$";
+		const auto replacementName =
+			 determineReplacementName(domainName, regionLocalisations, std::string(localisationLanguages[i]));
+		std::string updatedName(*nameToUpdate);
+		for (auto position = updatedName.find(placeholder); position != std::string::npos;
+			  position = updatedName.find(placeholder, position + replacementName.size()))
+		{
+			updatedName.replace(position, placeholder.size(), replacementName);
+		}
+		updatedNames[i] = updatedName;
+	}
+
+	for (size_t i = 0; i < localisationLanguages.size(); ++i)
 	{
-		auto replacementName = determineReplacementName(domainName, regionLocalisations, language);
-		nameToUpdate = std::regex_replace(nameToUpdate, std::regex(R"(\$REGION\$)"), replacementName);
+		if (updatedNames[i])
+		{
+			nameInAllLanguages->second[i] = storeText(*updatedNames[i]);
+		}
 	}
 }
 
@@ -3,9 +3,12 @@
 
 
 
+#include <array>
+#include <cstdint>
 #include <map>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 
@@ -16,14 +19,50 @@ namespace Vic2
 using LanguageToLocalisationMap = std::map<std::string, std::string>;
 using KeyToLocalisationsMap = std::unordered_map<std::string, LanguageToLocalisationMap>;
 
+// the languages of the columns of Vic2 localisation files, in column order
+constexpr std::array<std::string_view, 13> localisationLanguages{"english",
+	 "french",
+	 "german",
+	 "polish",
+	 "spanish",
+	 "italian",
+	 "swedish",
+	 "czech",
+	 "hungarian",
+	 "dutch",
+	 "braz_por",
+	 "russian",
+	 "finnish"};
+
 
 class Localisations
 {
   public:
 	class Factory;
 
-	Localisations(KeyToLocalisationsMap _localisations, std::map<std::string, std::string> _localisationToKeyMap):
-		 localisations(std::move(_localisations)), localisationToKeyMap(std::move(_localisationToKeyMap))
+	enum class TextSource: uint8_t
+	{
+		none,
+		own,
+		english // untranslated, so the English text is used
+	};
+
+	// a text in the shared text store
+	typedef struct Text
+	{
+		uint32_t start = 0;
+		uint32_t length = 0;
+		TextSource source = TextSource::none;
+	} Text;
+	using TextInEachLanguage = std::array<Text, localisationLanguages.size()>;
+
+	Localisations(const KeyToLocalisationsMap& _localisations,
+		 std::map<std::string, std::string> _localisationToKeyMap);
+	Localisations(std::unordered_map<std::string, TextInEachLanguage> _localisations,
+		 std::string _textStore,
+		 std::map<std::string, std::string> _localisationToKeyMap):
+		 localisations(std::move(_localisations)),
+		 textStore(std::move(_textStore)), localisationToKeyMap(std::move(_localisationToKeyMap))
 	{
 	}
 
@@ -34,12 +73,16 @@ class Localisations
 	void updateDomainCountry(const std::string& tag, const std::string& domainName);
 
   private:
+	[[nodiscard]] std::optional<std::string_view> getText(const TextInEachLanguage& texts, size_t language) const;
+	Text storeText(std::string_view text);
+
 	LanguageToLocalisationMap lookupRegionLocalisations(const std::string& domainName);
 	static std::string determineReplacementName(const std::string& domainName,
 		 const LanguageToLocalisationMap& regionLocalisations,
 		 const std::string& language);
 
-	KeyToLocalisationsMap localisations;
+	std::unordered_map<std::string, TextInEachLanguage> localisations;
+	std::string textStore;
 	std::map<std::string, std::string> localisationToKeyMap;
 };
 
@@ -14,14 +14,14 @@ Vic2::Army::Factory::Factory()
 		army->location = commonItems::singleInt{theStream}.getInt();
 	});
 	registerKeyword("regiment", [this](std::istream& theStream) {
-		army->units.push_back(*unitFactory.getUnit(theStream));
+		army->units.push_back(std::move(*unitFactory.getUnit(theStream)));
 	});
 	registerKeyword("ship", [this](std::istream& theStream) {
-		army->units.push_back(*unitFactory.getUnit(theStream));
+		army->units.push_back(std::move(*unitFactory.getUnit(theStream)));
 	});
 	registerKeyword("army", [this](std::istream& theStream) {
 		auto tempArmy = std::move(army);
-		tempArmy->transportedArmies.push_back(*getArmy(tempArmy->owner, theStream));
+		tempArmy->transportedArmies.push_back(std::move(*getArmy(tempArmy->owner, theStream)));
 		army = std::move(tempArmy);
 	});
 	registerRegex(commonItems::catchallRegex, commonItems::ignoreItem);
@@ -0,0 +1,88 @@
+#include "PopSummary.h"
+
+
+
+namespace
+{
+
+constexpr double minimumLiteracyWeighting = 0.1;
+constexpr double literacyWeighting = 0.9;
+int calculateLiteracyWeightedPop(const Vic2::Pop& thePop)
+{
+	return static_cast<int>(thePop.getSize() * (thePop.getLiteracy() * literacyWeighting + minimumLiteracyWeighting));
+}
+
+} // namespace
+
+
+
+Vic2::PopSummary::PopSummary(const std::vector<Pop>& pops)
+{
+	for (const auto& pop: pops)
+	{
+		const auto literacyWeightedPopulation = calculateLiteracyWeightedPop(pop);
+
+		totalPopulation += pop.getSize();
+		totalLiteracyWeightedPopulation += literacyWeightedPopulation;
+
+		auto& totals = typeTotals[pop.getType()];
+		totals.population += pop.getSize();
+		totals.literacyWeightedPopulation += literacyWeightedPopulation;
+
+		cultureSizes[pop.getCulture()] += pop.getSize();
+	}
+}
+
+
+void Vic2::PopSummary::add(const PopSummary& other)
+{
+	totalPopulation += other.totalPopulation;
+	totalLiteracyWeightedPopulation += other.totalLiteracyWeightedPopulation;
+	for (const auto& [type, otherTotals]: other.typeTotals)
+	{
+		auto& totals = typeTotals[type];
+		totals.population += otherTotals.population;
+		totals.literacyWeightedPopulation += otherTotals.literacyWeightedPopulation;
+	}
+	for (const auto& [culture, size]: other.cultureSizes)
+	{
+		cultureSizes[culture] += size;
+	}
+}
+
+
+int Vic2::PopSummary::getPopulation(const std::string& type) const
+{
+	if (const auto totals = typeTotals.find(type); totals != typeTotals.end())
+	{
+		return totals->second.population;
+	}
+
+	return 0;
+}
+
+
+int Vic2::PopSummary::getLiteracyWeightedPopulation(const std::string& type) const
+{
+	if (const auto totals = typeTotals.find(type); totals != typeTotals.end())
+	{
+		return totals->second.literacyWeightedPopulation;
+	}
+
+	return 0;
+}
+
+
+int Vic2::PopSummary::getPopulationWithCultures(const std::set<std::string>& cultures) const
+{
+	auto populationOfCultures = 0;
+	for (const auto& [culture, size]: cultureSizes)
+	{
+		if (cultures.contains(culture))
+		{
+			populationOfCultures += size;
+		}
+	}
+
+	return populationOfCultures;
+}
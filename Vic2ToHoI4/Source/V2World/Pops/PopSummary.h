@@ -0,0 +1,51 @@
+#ifndef VIC2_POP_SUMMARY_H_
+#define VIC2_POP_SUMMARY_H_
+
+
+
+#include "Pop.h"
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+
+
+namespace Vic2
+{
+
+// Population totals for a group of pops, by pop type and by culture, gathered in one pass over the pops. Summaries of
+// provinces can be added together for states and countries without going back to the pops.
+class PopSummary
+{
+  public:
+	PopSummary() = default;
+	explicit PopSummary(const std::vector<Pop>& pops);
+
+	void add(const PopSummary& other);
+
+	[[nodiscard]] int getPopulation() const { return totalPopulation; }
+	[[nodiscard]] int getPopulation(const std::string& type) const;
+	[[nodiscard]] int getLiteracyWeightedPopulation() const { return totalLiteracyWeightedPopulation; }
+	[[nodiscard]] int getLiteracyWeightedPopulation(const std::string& type) const;
+	[[nodiscard]] int getPopulationWithCultures(const std::set<std::string>& cultures) const;
+	[[nodiscard]] const auto& getCultureSizes() const { return cultureSizes; }
+
+  private:
+	typedef struct TypeTotals
+	{
+		int population = 0;
+		int literacyWeightedPopulation = 0;
+	} TypeTotals;
+
+	int totalPopulation = 0;
+	int totalLiteracyWeightedPopulation = 0;
+	std::map<std::string, TypeTotals> typeTotals;
+	std::map<std::string, int> cultureSizes;
+};
+
+} // namespace Vic2
+
+
+
+#endif // VIC2_POP_SUMMARY_H_
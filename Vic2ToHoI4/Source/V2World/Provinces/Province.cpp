@@ -4,64 +4,38 @@
 
 int Vic2::Province::getTotalPopulation() const
 {
-	return getPopulation();
+	return popSummary.getPopulation();
 }
 
 
 int Vic2::Province::getPopulation(const std::optional<std::string>& type) const
 {
-	auto totalPopulation = 0;
-	for (const auto& pop: pops)
+	if (!type)
 	{
-		if (!type || *type == pop.getType())
-		{
-			totalPopulation += pop.getSize();
-		}
+		return popSummary.getPopulation();
 	}
 
-	return totalPopulation;
+	return popSummary.getPopulation(*type);
 }
 
 
 int Vic2::Province::getLiteracyWeightedPopulation(const std::optional<std::string>& type) const
 {
-	auto totalPopulation = 0;
-	for (const auto& pop: pops)
+	if (!type)
 	{
-		if (!type || *type == pop.getType())
-		{
-			totalPopulation += calculateLiteracyWeightedPop(pop);
-		}
+		return popSummary.getLiteracyWeightedPopulation();
 	}
-	return totalPopulation;
+
+	return popSummary.getLiteracyWeightedPopulation(*type);
 }
 
 
 double Vic2::Province::getPercentageWithCultures(const std::set<std::string>& cultures) const
 {
-	auto totalPopulation = 0;
-	auto populationOfCultures = 0;
-
-	for (const auto& pop: pops)
-	{
-		totalPopulation += pop.getSize();
-		if (cultures.contains(pop.getCulture()))
-		{
-			populationOfCultures += pop.getSize();
-		}
-	}
-
+	const auto totalPopulation = popSummary.getPopulation();
 	if (totalPopulation <= 0)
 	{
 		return 0.0;
 	}
-	return 1.0 * populationOfCultures / totalPopulation;
-}
-
-
-constexpr double minimumLiteracyWeighting = 0.1;
-constexpr double literacyWeighting = 0.9;
-int Vic2::Province::calculateLiteracyWeightedPop(const Pop& thePop)
-{
-	return static_cast<int>(thePop.getSize() * (thePop.getLiteracy() * literacyWeighting + minimumLiteracyWeighting));
+	return 1.0 * popSummary.getPopulationWithCultures(cultures) / totalPopulation;
 }
@@ -5,6 +5,7 @@
 
 #include "V2World/Pops/Pop.h"
 #include "V2World/Pops/PopFactory.h"
+#include "V2World/Pops/PopSummary.h"
 #include <optional>
 #include <set>
 #include <string>
@@ -36,12 +37,11 @@ class Province
 	[[nodiscard]] const auto& getController() const { return controller; }
 	[[nodiscard]] const auto& getCores() const { return cores; }
 	[[nodiscard]] const auto& getPops() const { return pops; }
+	[[nodiscard]] const auto& getPopSummary() const { return popSummary; }
 	[[nodiscard]] const auto& getNavalBaseLevel() const { return navalBaseLevel; }
 	[[nodiscard]] const auto& getRailLevel() const { return railLevel; }
 
   private:
-	[[nodiscard]] static int calculateLiteracyWeightedPop(const Pop& thePop);
-
 	int number = 0;
 
 	std::string owner;
@@ -49,6 +49,7 @@ class Province
 	std::set<std::string> cores;
 
 	std::vector<Pop> pops;
+	PopSummary popSummary; // kept in step with pops when they are set
 
 	int navalBaseLevel = 0;
 	int railLevel = 0;
@@ -55,6 +55,7 @@ class Province::Builder
 	Builder& setPops(std::vector<Pop> pops)
 	{
 		province->pops = std::move(pops);
+		province->popSummary = PopSummary(province->pops);
 		return *this;
 	}
 
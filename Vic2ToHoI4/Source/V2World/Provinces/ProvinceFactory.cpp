@@ -25,7 +25,7 @@ Vic2::Province::Factory::Factory(std::unique_ptr<Pop::Factory>&& _popFactory): p
 		 "aristocrats|artisans|bureaucrats|capitalists|clergymen|craftsmen|clerks|farmers|soldiers|officers|labourers|"
 		 "slaves|serfs",
 		 [this](const std::string& popType, std::istream& theStream) {
-			 province->pops.push_back(*popFactory->getPop(popType, theStream));
+			 province->pops.push_back(std::move(*popFactory->getPop(popType, theStream)));
 		 });
 	registerRegex(commonItems::catchallRegex, commonItems::ignoreItem);
 }
@@ -37,6 +37,7 @@ std::unique_ptr<Vic2::Province> Vic2::Province::Factory::getProvince(int number,
 	province->number = number;
 
 	parseStream(theStream);
+	province->popSummary = PopSummary(province->pops);
 
 	return std::move(province);
 }
\ No newline at end of file
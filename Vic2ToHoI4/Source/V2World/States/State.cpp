@@ -17,13 +17,11 @@ Vic2::workerStruct Vic2::State::countEmployedWorkers() const
 {
 	workerStruct workers;
 
-	for (const auto& province: provinces)
-	{
-		workers.craftsmen += static_cast<float>(province->getPopulation("craftsmen"));
-		workers.clerks += static_cast<float>(province->getPopulation("clerks"));
-		workers.artisans += static_cast<float>(province->getPopulation("artisans"));
-		workers.capitalists += static_cast<float>(province->getLiteracyWeightedPopulation("capitalists"));
-	}
+	const auto popSummary = getPopSummary();
+	workers.craftsmen = static_cast<float>(popSummary.getPopulation("craftsmen"));
+	workers.clerks = static_cast<float>(popSummary.getPopulation("clerks"));
+	workers.artisans = static_cast<float>(popSummary.getPopulation("artisans"));
+	workers.capitalists = static_cast<float>(popSummary.getLiteracyWeightedPopulation("capitalists"));
 
 	return workers;
 }
@@ -73,12 +71,24 @@ void Vic2::State::eatState(const State& state, const StateDefinitions& stateDefi
 }
 
 
+Vic2::PopSummary Vic2::State::getPopSummary() const
+{
+	PopSummary popSummary;
+	for (const auto& province: provinces)
+	{
+		popSummary.add(province->getPopSummary());
+	}
+
+	return popSummary;
+}
+
+
 int Vic2::State::getPopulation() const
 {
 	auto population = 0;
 	for (const auto& province: provinces)
 	{
-		population += province->getPopulation();
+		population += province->getTotalPopulation();
 	}
 
 	return population;
@@ -105,8 +115,9 @@ std::optional<int> Vic2::State::getUpperClassLocation() const
 {
 	for (const auto& province: provinces)
 	{
-		if ((province->getPopulation("aristocrats") > 0) || (province->getPopulation("bureaucrats") > 0) ||
-			 (province->getPopulation("capitalists") > 0))
+		if (const auto& popSummary = province->getPopSummary();
+			 (popSummary.getPopulation("aristocrats") > 0) || (popSummary.getPopulation("bureaucrats") > 0) ||
+			 (popSummary.getPopulation("capitalists") > 0))
 		{
 			return province->getNumber();
 		}
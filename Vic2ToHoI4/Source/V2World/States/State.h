@@ -38,6 +38,7 @@ class State
 	void setOwner(std::string newOwner) { owner = std::move(newOwner); }
 	void setLanguageCategory(std::string newLanguageCategory) { languageCategory = std::move(newLanguageCategory); }
 
+	[[nodiscard]] PopSummary getPopSummary() const;
 	[[nodiscard]] int getPopulation() const;
 	[[nodiscard]] float getAverageRailLevel() const;
 	[[nodiscard]] std::optional<int> getUpperClassLocation() const;
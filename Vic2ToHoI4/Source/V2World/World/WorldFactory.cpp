@@ -22,9 +22,9 @@ Vic2::World::Factory::Factory(const Configuration& theConfiguration):
 	 stateLanguageCategories(StateLanguageCategories::Factory{}.getCategories()),
 	 diplomacyFactory(std::make_unique<Diplomacy::Factory>())
 {
-	const auto [commonCountriesData_, allParties_] = importCommonCountriesData(theConfiguration);
-	commonCountriesData = commonCountriesData_;
-	allParties = allParties_;
+	auto [commonCountriesData_, allParties_] = importCommonCountriesData(theConfiguration);
+	commonCountriesData = std::move(commonCountriesData_);
+	allParties = std::move(allParties_);
 
 	registerKeyword("date", [](std::istream& theStream) {
 		const date theDate{commonItems::singleString{theStream}.getString()};
@@ -42,12 +42,12 @@ Vic2::World::Factory::Factory(const Configuration& theConfiguration):
 			 commonCountryData != commonCountriesData.end())
 		{
 			world->countries.emplace(countryTag,
-				 *countryFactory->createCountry(countryTag,
+				 std::move(*countryFactory->createCountry(countryTag,
 					  theStream,
 					  commonCountryData->second,
 					  allParties,
 					  *stateLanguageCategories,
-					  theConfiguration.getPercentOfCommanders()));
+					  theConfiguration.getPercentOfCommanders())));
 			tagsInOrder.push_back(countryTag);
 		}
 		else
@@ -60,7 +60,7 @@ Vic2::World::Factory::Factory(const Configuration& theConfiguration):
 		world->diplomacy = diplomacyFactory->getDiplomacy(theStream);
 	});
 	registerKeyword("active_war", [this](std::istream& theStream) {
-		wars.push_back(*warFactory.getWar(theStream));
+		wars.push_back(std::move(*warFactory.getWar(theStream)));
 	});
 	registerRegex(commonItems::catchallRegex, commonItems::ignoreItem);
 }
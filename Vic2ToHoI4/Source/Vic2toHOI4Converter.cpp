@@ -1,4 +1,5 @@
 #include "Configuration.h"
+#include "HOI4World/GameData.h"
 #include "HOI4World/HoI4World.h"
 #include "Log.h"
 #include "Mappers/Provinces/ProvinceMapper.h"
@@ -7,34 +8,101 @@
 #include "OutHoi4/OutMod.h"
 #include "V2World/World/World.h"
 #include "V2World/World/WorldFactory.h"
+#include <chrono>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 
 
 void checkMods(const Configuration& theConfiguration);
+void convertSave(Configuration& theConfiguration,
+	 const Mappers::ProvinceMapper& provinceMapper,
+	 Vic2::World::Factory& vic2WorldFactory,
+	 const HoI4::GameData& gameData);
+void convertBatch(const Configuration& batchConfiguration);
 void ConvertV2ToHoI4()
 {
 	const auto theConfiguration = Configuration::Factory{}.importConfiguration("configuration.txt");
 	checkMods(*theConfiguration);
-	clearOutputFolder(theConfiguration->getOutputName());
+	if (!theConfiguration->getBatchSaves().empty())
+	{
+		convertBatch(*theConfiguration);
+		return;
+	}
 
 	const auto provinceMapper =
 		 Mappers::ProvinceMapper::Factory(*theConfiguration).importProvinceMapper(*theConfiguration);
+	Vic2::World::Factory vic2WorldFactory(*theConfiguration);
+	const HoI4::GameData gameData(*theConfiguration);
+
+	convertSave(*theConfiguration, *provinceMapper, vic2WorldFactory, gameData);
+}
+
 
-	const auto sourceWorld = Vic2::World::Factory{*theConfiguration}.importWorld(*theConfiguration, *provinceMapper);
-	const HoI4::World destWorld(*sourceWorld, *provinceMapper, *theConfiguration);
+void convertSave(Configuration& theConfiguration,
+	 const Mappers::ProvinceMapper& provinceMapper,
+	 Vic2::World::Factory& vic2WorldFactory,
+	 const HoI4::GameData& gameData)
+{
+	const auto sourceWorld = vic2WorldFactory.importWorld(theConfiguration, provinceMapper);
+	const HoI4::World destWorld(*sourceWorld, provinceMapper, gameData, theConfiguration);
 
 	output(destWorld,
-		 theConfiguration->getOutputName(),
-		 theConfiguration->getDebug(),
-		 theConfiguration->getVic2Mods(),
-		 theConfiguration->getVic2ModPath(),
-		 *theConfiguration);
+		 theConfiguration.getOutputName(),
+		 theConfiguration.getDebug(),
+		 theConfiguration.getVic2Mods(),
+		 theConfiguration.getVic2ModPath(),
+		 theConfiguration);
 	Log(LogLevel::Progress) << "100%";
 	Log(LogLevel::Info) << "* Conversion complete *";
 }
 
 
+// Converts every save listed in the configuration's batch against one set of save-independent data. The saves are
+// converted one after another, as parts of the conversion still keep process-wide state.
+void convertBatch(const Configuration& batchConfiguration)
+{
+	const auto& batchSaves = batchConfiguration.getBatchSaves();
+	Log(LogLevel::Info) << "Converting a batch of " << batchSaves.size() << " saves";
+	const auto batchStart = std::chrono::steady_clock::now();
+
+	const auto provinceMapper =
+		 Mappers::ProvinceMapper::Factory(batchConfiguration).importProvinceMapper(batchConfiguration);
+	Vic2::World::Factory vic2WorldFactory(batchConfiguration);
+	const HoI4::GameData gameData(batchConfiguration);
+
+	std::vector<std::string> failedSaves;
+	for (const auto& [inputFile, outputName]: batchSaves)
+	{
+		Log(LogLevel::Info) << "* Converting " << inputFile << " to " << outputName << " *";
+		auto saveConfiguration = batchConfiguration;
+		saveConfiguration.setInputFile(inputFile);
+		saveConfiguration.setOutputName(outputName);
+		try
+		{
+			convertSave(saveConfiguration, *provinceMapper, vic2WorldFactory, gameData);
+		}
+		catch (const std::exception& e)
+		{
+			Log(LogLevel::Error) << "Could not convert " << inputFile << ": " << e.what();
+			failedSaves.push_back(inputFile);
+		}
+	}
+
+	const std::chrono::duration<double> batchTime = std::chrono::steady_clock::now() - batchStart;
+	const auto convertedSaves = batchSaves.size() - failedSaves.size();
+	Log(LogLevel::Info) << "Converted " << convertedSaves << " of " << batchSaves.size() << " saves in "
+							  << batchTime.count() << " seconds ("
+							  << (batchTime.count() > 0.0 ? convertedSaves * 3600.0 / batchTime.count() : 0.0)
+							  << " saves/hour)";
+	if (!failedSaves.empty())
+	{
+		throw std::runtime_error(std::to_string(failedSaves.size()) + " saves in the batch failed to convert");
+	}
+}
+
+
 void checkMods(const Configuration& theConfiguration)
 {
 	Log(LogLevel::Info) << "Double-checking Vic2 mods";
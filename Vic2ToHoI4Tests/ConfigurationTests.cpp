@@ -770,4 +770,40 @@ TEST(ConfigurationTests, PercentOfCommandersCanBeSet)
 	const auto theConfiguration = Configuration::Factory{}.importConfiguration(input);
 
 	ASSERT_EQ(0.05F, theConfiguration->getPercentOfCommanders());
-}
\ No newline at end of file
+}
+
+TEST(ConfigurationTests, BatchSavesDefaultToEmpty)
+{
+	std::stringstream input;
+	const auto theConfiguration = Configuration::Factory{}.importConfiguration(input);
+
+	ASSERT_TRUE(theConfiguration->getBatchSaves().empty());
+}
+
+
+TEST(ConfigurationTests, BatchSavesCanBeSet)
+{
+	std::stringstream input;
+	input << "batch = {\n";
+	input << "\tsave = { SaveGame = \"first.v2\" }\n";
+	input << "\tsave = { SaveGame = \"/saves/second.v2\" output_name = \"custom name\" }\n";
+	input << "}";
+	const auto theConfiguration = Configuration::Factory{}.importConfiguration(input);
+
+	ASSERT_EQ(2, theConfiguration->getBatchSaves().size());
+	EXPECT_EQ("first.v2", theConfiguration->getBatchSaves()[0].inputFile);
+	EXPECT_EQ("first", theConfiguration->getBatchSaves()[0].outputName);
+	EXPECT_EQ("/saves/second.v2", theConfiguration->getBatchSaves()[1].inputFile);
+	EXPECT_EQ("custom_name", theConfiguration->getBatchSaves()[1].outputName);
+}
+
+
+TEST(ConfigurationTests, BatchSavesMustBeVic2Saves)
+{
+	std::stringstream input;
+	input << "batch = {\n";
+	input << "\tsave = { SaveGame = \"first.vic\" }\n";
+	input << "}";
+	ASSERT_THROW(const auto theConfiguration = Configuration::Factory{}.importConfiguration(input),
+		 std::invalid_argument);
+}
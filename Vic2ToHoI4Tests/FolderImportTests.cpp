@@ -0,0 +1,56 @@
+#include "FolderImport.h"
+#include "gmock/gmock-matchers.h"
+#include "gtest/gtest.h"
+#include <fstream>
+
+
+
+namespace
+{
+
+std::string readWord(const std::string& path)
+{
+	std::ifstream file(path);
+	std::string word;
+	file >> word;
+	return word;
+}
+
+} // namespace
+
+
+
+TEST(FolderImportTests, MissingFolderGivesNoResults)
+{
+	const auto results = importFolder("./MissingFolder", [](const std::string& path, const std::string&) {
+		return readWord(path);
+	});
+
+	ASSERT_TRUE(results.empty());
+}
+
+
+TEST(FolderImportTests, ResultsArePairedWithFileNamesInFileNameOrder)
+{
+	const auto results = importFolder("./FolderImport", [](const std::string& path, const std::string&) {
+		return readWord(path);
+	});
+
+	ASSERT_THAT(results,
+		 testing::ElementsAre(std::make_pair("1-alpha.txt", "alpha"),
+			  std::make_pair("2-beta.txt", "beta"),
+			  std::make_pair("3-gamma.txt", "gamma")));
+}
+
+
+TEST(FolderImportTests, ResultsDoNotDependOnThreadCount)
+{
+	const auto function = [](const std::string& path, const std::string& fileName) {
+		return fileName + ':' + readWord(path);
+	};
+
+	const auto serialResults = importFolder("./FolderImport", function, 1);
+	const auto parallelResults = importFolder("./FolderImport", function, 8);
+
+	ASSERT_EQ(serialResults, parallelResults);
+}
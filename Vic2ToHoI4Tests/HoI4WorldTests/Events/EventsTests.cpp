@@ -0,0 +1,294 @@
+#include "HOI4World/Events/Events.h"
+#include "HOI4World/HoI4Localisation.h"
+#include "HOI4World/OnActions.h"
+#include "OutHoi4/Events/OutEvent.h"
+#include "V2World/Localisations/Vic2Localisations.h"
+#include "V2World/Politics/PartyBuilder.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <sstream>
+
+
+
+TEST(HoI4World_Events_EventsTests, OnTheRiseEventIsCreated)
+{
+	HoI4::Localisation localisation({}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {});
+	HoI4::Events events;
+	events.createPoliticalEvents({"democratic"}, localisation);
+
+	ASSERT_FALSE(events.getPoliticalEvents().empty());
+	std::stringstream actualOutput;
+	actualOutput << events.getPoliticalEvents()[0];
+
+	std::string expectedOutput;
+	expectedOutput += "country_event = {\n";
+	expectedOutput += "\tid = conv.political.1\n";
+	expectedOutput += "\ttitle = conv.political.1.t\n";
+	expectedOutput += "\tdesc = conv.political.1.d\n";
+	expectedOutput += "\tpicture = GFX_report_event_journalists_speech\n";
+	expectedOutput += "\n";
+	expectedOutput += "\n";
+	expectedOutput += "\ttrigger = {\n";
+	expectedOutput += "\t\tNOT = { has_government = democratic }\n";
+	expectedOutput += "\t\tdemocratic > 0.6\n";
+	expectedOutput += "\t\tNOT = { democratic > 0.7 }\n";
+	expectedOutput += "\t}\n";
+	expectedOutput += "\n";
+	expectedOutput += "\tfire_only_once = yes\n";
+	expectedOutput += "\n";
+	expectedOutput += "\tmean_time_to_happen = {\n";
+	expectedOutput += "\t\tdays = 30\n";
+	expectedOutput += "\t}\n";
+	expectedOutput += "\n";
+	expectedOutput += "\toption = {\n";
+	expectedOutput += "\t\tname = conv.political.1.a\n";
+	expectedOutput += "\t\tadd_political_power = -100\n";
+	expectedOutput += "\t\tset_politics = {\n";
+	expectedOutput += "\t\t\truling_party = democratic\n";
+	expectedOutput += "\t\t\telections_allowed = yes\n";
+	expectedOutput += "\t\t}\n";
+	expectedOutput += "\t}\n";
+	expectedOutput += "\n";
+	expectedOutput += "\toption = {\n";
+	expectedOutput += "\t\tname = conv.political.1.b\n";
+	expectedOutput += "\t\tai_chance = {\n";
+	expectedOutput += "\t\t\tfactor = 0\n";
+	expectedOutput += "\t\t}\n";
+	expectedOutput += "\t\tcustom_effect_tooltip = impending_civil_war_tt\n";
+	expectedOutput += "\t}\n";
+	expectedOutput += "}\n";
+
+	ASSERT_EQ(actualOutput.str(), expectedOutput);
+}
+
+
+TEST(HoI4World_Events_EventsTests, RevolutionEventIsCreated)
+{
+	HoI4::Localisation localisation({}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {});
+	HoI4::Events events;
+	events.createPoliticalEvents({"communism", "democratic"}, localisation);
+
+	const auto& politicalEvents = events.getPoliticalEvents();
+	const auto revolutionEvent =
+		 std::find_if(politicalEvents.begin(), politicalEvents.end(), [](const HoI4::Event& event) {
+			 return event.getId() == "conv.political.10";
+		 });
+	ASSERT_NE(revolutionEvent, politicalEvents.end());
+	std::stringstream actualOutput;
+	actualOutput << *revolutionEvent;
+
+	std::string expectedOutput;
+	expectedOutput += "country_event = {\n";
+	expectedOutput += "\tid = conv.political.10\n";
+	expectedOutput += "\ttitle = conv.political.10.t\n";
+	expectedOutput += "\tdesc = conv.political.10.d\n";
+	expectedOutput += "\tpicture = GFX_report_event_journalists_speech\n";
+	expectedOutput += "\n";
+	expectedOutput += "\n";
+	expectedOutput += "\ttrigger = {\n";
+	expectedOutput += "\t\tdemocratic > 0.7\n";
+	expectedOutput += "\t\tnum_of_controlled_states > 1\n";
+	expectedOutput += "\t\tNOT = { has_government = democratic }\n";
+	expectedOutput += "\t\thas_civil_war = no\n";
+	expectedOutput += "\t}\n";
+	expectedOutput += "\n";
+	expectedOutput += "\tmean_time_to_happen = {\n";
+	expectedOutput += "\t\tdays = 2\n";
+	expectedOutput += "\t}\n";
+	expectedOutput += "\n";
+	expectedOutput += "\timmediate = {\n";
+	expectedOutput += "\t\thidden_effect = { remove_ideas = democratic_revolutionaries }\n";
+	expectedOutput += "\t}\n";
+	expectedOutput += "\n";
+	expectedOutput += "\toption = {\n";
+	expectedOutput += "\t\tname = conv.political.10.a\n";
+	expectedOutput += "\t\tai_chance = {\n";
+	expectedOutput += "\t\t\tfactor = 0\n";
+	expectedOutput += "\t\t}\n";
+	expectedOutput += "\t\tstart_civil_war = {\n";
+	expectedOutput += "\t\t\tideology = democratic\n";
+	expectedOutput += "\t\t\tsize = 0.5\n";
+	expectedOutput += "\t\t}\n";
+	expectedOutput += "\t}\n";
+	expectedOutput += "\n";
+	expectedOutput += "\toption = {\n";
+	expectedOutput += "\t\tname = conv.political.10.b\n";
+	expectedOutput += "\t\tai_chance = {\n";
+	expectedOutput += "\t\t\tfactor = 0\n";
+	expectedOutput += "\t\t}\n";
+	expectedOutput += "\t\tif = {\n";
+	expectedOutput += "\t\t\tlimit = {\n";
+	expectedOutput += "\t\t\t\thas_government = communism\n";
+	expectedOutput += "\t\t\t}\n";
+	expectedOutput += "\t\t\tadd_timed_idea = { idea = communism_defeated days = 730 }\n";
+	expectedOutput += "\t\t\tstart_civil_war = {\n";
+	expectedOutput += "\t\t\t\truling_party = democratic\n";
+	expectedOutput += "\t\t\t\tideology = communism\n";
+	expectedOutput += "\t\t\t\tsize = 0.5\n";
+	expectedOutput += "\t\t\t}\n";
+	expectedOutput += "\t\t\thold_election = ROOT\n";
+	expectedOutput += "\t\t}\n";
+	expectedOutput += "\t}\n";
+	expectedOutput += "\n";
+	expectedOutput += "\toption = {\n";
+	expectedOutput += "\t\tname = conv.political.10.c\n";
+	expectedOutput += "\t\ttrigger = {\n";
+	expectedOutput += "\t\t\tis_ai = yes\n";
+	expectedOutput += "\t\t}\n";
+	expectedOutput += "\t\tadd_political_power = -100\n";
+	expectedOutput += "\t\tset_politics = {\n";
+	expectedOutput += "\t\t\truling_party = democratic\n";
+	expectedOutput += "\t\t\telections_allowed = yes\n";
+	expectedOutput += "\t\t}\n";
+	expectedOutput += "\t}\n";
+	expectedOutput += "}\n";
+
+	ASSERT_EQ(actualOutput.str(), expectedOutput);
+}
+
+
+TEST(HoI4World_Events_EventsTests, PartyChoiceEventIsCreated)
+{
+	HoI4::Localisation localisation({}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {});
+	const Vic2::Localisations vic2Localisations({}, {});
+	HoI4::OnActions onActions;
+	HoI4::Events events;
+	events.addPartyChoiceEvent("TAG",
+		 {*Vic2::Party::Builder{}.setName("TAG_conservative").setIdeology("conservative").Build(),
+			  *Vic2::Party::Builder{}.setName("TAG_liberal").setIdeology("liberal").Build(),
+			  *Vic2::Party::Builder{}.setName("TAG_reactionary").setIdeology("reactionary").Build()},
+		 onActions,
+		 {"neutrality"},
+		 vic2Localisations,
+		 localisation);
+
+	ASSERT_EQ(1, events.getElectionsEvents().size());
+	std::stringstream actualOutput;
+	actualOutput << events.getElectionsEvents()[0];
+
+	std::string expectedOutput;
+	expectedOutput += "country_event = {\n";
+	expectedOutput += "\tid = election.4\n";
+	expectedOutput += "\ttitle = election.4.t\n";
+	expectedOutput += "\tdesc = election.4.d\n";
+	expectedOutput += "\tpicture = GFX_report_event_usa_election_generic\n";
+	expectedOutput += "\n";
+	expectedOutput += "\tis_triggered_only = yes\n";
+	expectedOutput += "\n";
+	expectedOutput += "\ttrigger = {\n";
+	expectedOutput += "\t\ttag = TAG\n";
+	expectedOutput += "\t\tneutrality > 0.5\n";
+	expectedOutput += "\t}\n";
+	expectedOutput += "\n";
+	expectedOutput += "\toption = {\n";
+	expectedOutput += "\t\tname = election.4a\n";
+	expectedOutput += "\t\tset_party_name = { ideology = neutrality long_name = TAG_conservative_party name = "
+							"TAG_conservative_party }\n";
+	expectedOutput += "\t\tretire_country_leader = yes\n";
+	expectedOutput += "\t\tset_country_leader_ideology = conservatism_neutral\n";
+	expectedOutput += "\t}\n";
+	expectedOutput += "\n";
+	expectedOutput += "\toption = {\n";
+	expectedOutput += "\t\tname = election.4b\n";
+	expectedOutput += "\t\tset_party_name = { ideology = neutrality long_name = TAG_liberal_party name = "
+							"TAG_liberal_party }\n";
+	expectedOutput += "\t\tretire_country_leader = yes\n";
+	expectedOutput += "\t\tset_country_leader_ideology = liberalism_neutral\n";
+	expectedOutput += "\t}\n";
+	expectedOutput += "}\n";
+
+	ASSERT_EQ(actualOutput.str(), expectedOutput);
+}
+
+
+TEST(HoI4World_Events_EventsTests, PartyChoiceEventHasDemocraticOptionsWhenDemocracyIsMajor)
+{
+	HoI4::Localisation localisation({}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {});
+	const Vic2::Localisations vic2Localisations({}, {});
+	HoI4::OnActions onActions;
+	HoI4::Events events;
+	events.addPartyChoiceEvent("TAG",
+		 {*Vic2::Party::Builder{}.setName("TAG_socialist").setIdeology("socialist").Build()},
+		 onActions,
+		 {"democratic", "neutrality"},
+		 vic2Localisations,
+		 localisation);
+
+	ASSERT_EQ(1, events.getElectionsEvents().size());
+	std::stringstream actualOutput;
+	actualOutput << events.getElectionsEvents()[0];
+
+	std::string expectedOutput;
+	expectedOutput += "country_event = {\n";
+	expectedOutput += "\tid = election.4\n";
+	expectedOutput += "\ttitle = election.4.t\n";
+	expectedOutput += "\tdesc = election.4.d\n";
+	expectedOutput += "\tpicture = GFX_report_event_usa_election_generic\n";
+	expectedOutput += "\n";
+	expectedOutput += "\tis_triggered_only = yes\n";
+	expectedOutput += "\n";
+	expectedOutput += "\ttrigger = {\n";
+	expectedOutput += "\t\ttag = TAG\n";
+	expectedOutput += "\t\tOR = {\n";
+	expectedOutput += "\t\t\tdemocratic > 0.5\n";
+	expectedOutput += "\t\t\tneutrality > 0.5\n";
+	expectedOutput += "\t\t}\n";
+	expectedOutput += "\t}\n";
+	expectedOutput += "\n";
+	expectedOutput += "\toption = {\n";
+	expectedOutput += "\t\tname = election.4a\n";
+	expectedOutput += "\t\tset_party_name = { ideology = democratic long_name = TAG_socialist_party name = "
+							"TAG_socialist_party }\n";
+	expectedOutput += "\t\tretire_country_leader = yes\n";
+	expectedOutput += "\t\tset_country_leader_ideology = socialism\n";
+	expectedOutput += "\t}\n";
+	expectedOutput += "}\n";
+
+	ASSERT_EQ(actualOutput.str(), expectedOutput);
+}
+
+
+TEST(HoI4World_Events_EventsTests, WarGoalExpiredEventIsCreated)
+{
+	HoI4::Localisation localisation({}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {});
+	HoI4::Events events;
+	events.createWarJustificationEvents({"fascism", "neutrality"}, localisation);
+
+	ASSERT_FALSE(events.getWarJustificationEvents().empty());
+	std::stringstream actualOutput;
+	actualOutput << events.getWarJustificationEvents().back();
+
+	std::string expectedOutput;
+	expectedOutput += "country_event = {\n";
+	expectedOutput += "\tid = war_justification.301\n";
+	expectedOutput += "\ttitle = war_justification.301.t\n";
+	expectedOutput += "\tdesc = war_justification.301.d\n";
+	expectedOutput += "\tpicture = GFX_report_event_iww_demonstration\n";
+	expectedOutput += "\n";
+	expectedOutput += "\tis_triggered_only = yes\n";
+	expectedOutput += "\n";
+	expectedOutput += "\ttrigger = {\n";
+	expectedOutput += "\t\thas_war = no\n";
+	expectedOutput += "\t}\n";
+	expectedOutput += "\n";
+	expectedOutput += "\toption = {\n";
+	expectedOutput += "\t\tname = war_justification.301.a\n";
+	expectedOutput += "\t\ttrigger = { has_government = fascism }\n";
+	expectedOutput += "\t\tadd_political_power = -30\n";
+	expectedOutput += "\t\tadd_war_support = -0.03\n";
+	expectedOutput += "\t\tadd_popularity = {\n";
+	expectedOutput += "\t\t\tideology = fascism\n";
+	expectedOutput += "\t\t\tpopularity = -0.05\n";
+	expectedOutput += "\t\t}\n";
+	expectedOutput += "\t}\n";
+	expectedOutput += "\n";
+	expectedOutput += "\toption = {\n";
+	expectedOutput += "\t\tname = war_justification.301.b\n";
+	expectedOutput += "\t\ttrigger = { has_government = neutrality }\n";
+	expectedOutput += "\t\tadd_political_power = -30\n";
+	expectedOutput += "\t\tadd_war_support = -0.03\n";
+	expectedOutput += "\t}\n";
+	expectedOutput += "}\n";
+
+	ASSERT_EQ(actualOutput.str(), expectedOutput);
+}
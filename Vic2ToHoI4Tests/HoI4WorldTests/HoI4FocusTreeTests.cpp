@@ -0,0 +1,100 @@
+#include "HOI4World/HoI4Focus.h"
+#include "HOI4World/HoI4FocusTree.h"
+#include "gtest/gtest.h"
+#include <sstream>
+
+
+
+namespace
+{
+
+std::shared_ptr<HoI4Focus> createFocus(const std::string& id)
+{
+	auto focus = std::make_shared<HoI4Focus>();
+	focus->id = id;
+	return focus;
+}
+
+std::vector<std::string> getFocusIds(const HoI4FocusTree& focusTree)
+{
+	std::vector<std::string> ids;
+	for (const auto& focus: focusTree.getFocuses())
+	{
+		ids.push_back(focus->id);
+	}
+	return ids;
+}
+
+} // namespace
+
+
+
+TEST(HoI4World_HoI4FocusTreeTests, FocusesAreInOrderAdded)
+{
+	HoI4FocusTree focusTree;
+	focusTree.addFocus(createFocus("first"));
+	focusTree.addFocus(createFocus("second"));
+	focusTree.addFocus(createFocus("third"));
+
+	ASSERT_EQ(std::vector<std::string>({"first", "second", "third"}), getFocusIds(focusTree));
+}
+
+
+TEST(HoI4World_HoI4FocusTreeTests, RemovedFocusesAreNotOutput)
+{
+	HoI4FocusTree focusTree;
+	focusTree.addFocus(createFocus("first"));
+	focusTree.addFocus(createFocus("second"));
+	focusTree.addFocus(createFocus("third"));
+
+	focusTree.removeFocus("second");
+
+	ASSERT_EQ(std::vector<std::string>({"first", "third"}), getFocusIds(focusTree));
+}
+
+
+TEST(HoI4World_HoI4FocusTreeTests, RemovingMissingFocusChangesNothing)
+{
+	HoI4FocusTree focusTree;
+	focusTree.addFocus(createFocus("first"));
+
+	focusTree.removeFocus("missing");
+	focusTree.removeFocus("first");
+	focusTree.removeFocus("first");
+
+	ASSERT_TRUE(getFocusIds(focusTree).empty());
+}
+
+
+TEST(HoI4World_HoI4FocusTreeTests, FocusCanBeAddedAgainAfterRemoval)
+{
+	HoI4FocusTree focusTree;
+	focusTree.addFocus(createFocus("first"));
+	focusTree.addFocus(createFocus("second"));
+
+	focusTree.removeFocus("first");
+	focusTree.addFocus(createFocus("first"));
+
+	ASSERT_EQ(std::vector<std::string>({"second", "first"}), getFocusIds(focusTree));
+}
+
+
+TEST(HoI4World_HoI4FocusTreeTests, CustomizedCopyAppendsCountryToReferencedFocuses)
+{
+	std::stringstream input;
+	input << "= {\n";
+	input << "\tid = army_effort\n";
+	input << "\tprerequisite = { focus = first focus = second }\n";
+	input << "\tmutually_exclusive = { focus = third }\n";
+	input << "\trelative_position_id = first\n";
+	input << "}";
+	const HoI4Focus focus(input);
+
+	const auto customizedFocus = focus.makeCustomizedCopy("TAG");
+
+	ASSERT_EQ("army_effortTAG", customizedFocus->id);
+	ASSERT_EQ("army_effort", customizedFocus->text);
+	ASSERT_EQ(std::vector<std::string>({"= { focus = firstTAG focus = secondTAG }"}), customizedFocus->prerequisites);
+	ASSERT_EQ("= { focus = thirdTAG }", customizedFocus->mutuallyExclusive);
+	ASSERT_EQ("firstTAG", customizedFocus->relativePositionId);
+}
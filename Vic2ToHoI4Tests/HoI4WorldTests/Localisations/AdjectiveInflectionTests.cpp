@@ -0,0 +1,113 @@
+#include "HOI4World/Localisations/AdjectiveInflection.h"
+#include "gtest/gtest.h"
+#include <regex>
+
+
+
+namespace
+{
+
+// covers every form of matcher and replacement used by languageReplacements.txt
+const std::vector<std::string> matchers{"^(.+)$",
+	 "(.+)ès$",
+	 "(.+)ol$",
+	 "^de (.+)",
+	 "^d'(.+)",
+	 "^luang prabang(.+)",
+	 "belga",
+	 "eslovaca ",
+	 "luang prabangi"};
+const std::vector<std::string> formats{"$1", "$1es", "$1's", "Grecques", "$&x", "$0y", "$$1", "$`a$'", "$2z", "a$b"};
+const std::vector<std::string> adjectives{"",
+	 "belga",
+	 "BELGA",
+	 "belgas",
+	 "eslovaca ",
+	 "eslovaca",
+	 "français",
+	 "Français",
+	 "ès",
+	 "xÈs",
+	 "espagnol",
+	 "ESPAGNOL",
+	 "ol",
+	 "de France",
+	 "De france",
+	 "de ",
+	 "d'Ivoire",
+	 "d'",
+	 "Luang Prabangi",
+	 "luang prabang",
+	 "x\nol"};
+
+} // namespace
+
+
+
+TEST(HoI4World_Localisations_AdjectiveInflectionTests, MatchersMatchLikeRegexes)
+{
+	for (const auto& pattern: matchers)
+	{
+		const HoI4::AdjectiveMatcher matcher(pattern);
+		ASSERT_TRUE(matcher.isValid()) << pattern;
+
+		const std::regex regex(pattern, std::regex::icase);
+		for (const auto& adjective: adjectives)
+		{
+			EXPECT_EQ(std::regex_match(adjective, regex), matcher.match(adjective).has_value())
+				 << pattern << " " << adjective;
+		}
+	}
+}
+
+
+TEST(HoI4World_Localisations_AdjectiveInflectionTests, ReplacementsReplaceLikeRegexes)
+{
+	for (const auto& pattern: matchers)
+	{
+		const HoI4::AdjectiveMatcher matcher(pattern);
+		const std::regex regex(pattern, std::regex::icase);
+		for (const auto& adjective: adjectives)
+		{
+			const auto stem = matcher.match(adjective);
+			if (!stem)
+			{
+				continue;
+			}
+			for (const auto& format: formats)
+			{
+				EXPECT_EQ(std::regex_replace(adjective, regex, format),
+					 HoI4::AdjectiveReplacement(format).apply(adjective, *stem))
+					 << pattern << " " << adjective << " " << format;
+			}
+		}
+	}
+}
+
+
+TEST(HoI4World_Localisations_AdjectiveInflectionTests, StemIsTextMatchedByGroup)
+{
+	const HoI4::AdjectiveMatcher matcher("^De (.+)ol$");
+
+	ASSERT_EQ(std::string_view("espagn"), matcher.match("de espagnol"));
+	ASSERT_EQ(std::string_view(""), HoI4::AdjectiveMatcher("belga").match("Belga"));
+}
+
+
+TEST(HoI4World_Localisations_AdjectiveInflectionTests, EscapedCharactersAreLiteral)
+{
+	const HoI4::AdjectiveMatcher matcher(R"((.+)\.$)");
+
+	ASSERT_TRUE(matcher.isValid());
+	ASSERT_TRUE(matcher.match("abbr."));
+	ASSERT_FALSE(matcher.match("abbrs"));
+}
+
+
+TEST(HoI4World_Localisations_AdjectiveInflectionTests, OtherRegexSyntaxIsUnsupported)
+{
+	ASSERT_FALSE(HoI4::AdjectiveMatcher("(.+)(er|ol)$").isValid());
+	ASSERT_FALSE(HoI4::AdjectiveMatcher("[a-z]+").isValid());
+	ASSERT_FALSE(HoI4::AdjectiveMatcher("(.+)x(.+)").isValid());
+	ASSERT_FALSE(HoI4::AdjectiveMatcher("(.+)x(.+)").match("axb"));
+}
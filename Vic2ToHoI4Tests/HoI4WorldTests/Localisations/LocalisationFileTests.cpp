@@ -0,0 +1,96 @@
+#include "HOI4World/Localisations/LocalisationFile.h"
+#include "gmock/gmock-matchers.h"
+#include "gtest/gtest.h"
+#include <sstream>
+
+
+
+using LocalisationPair = std::pair<std::string_view, std::string_view>;
+
+
+
+TEST(HoI4World_Localisations_LocalisationFileTests, EmptyFileHasNoLocalisations)
+{
+	std::stringstream input;
+	const HoI4::LocalisationFile file(input);
+
+	ASSERT_TRUE(file.getLanguage().empty());
+	ASSERT_TRUE(file.getLocalisations().empty());
+}
+
+
+TEST(HoI4World_Localisations_LocalisationFileTests, LanguageAndLocalisationsAreRead)
+{
+	std::stringstream input;
+	input << "\xEF\xBB\xBFl_english:\n";
+	input << " KEY_ONE:0 \"First text\"\n";
+	input << " KEY_TWO: \"Second text\"\n";
+	const HoI4::LocalisationFile file(input);
+
+	ASSERT_EQ("english", file.getLanguage());
+	EXPECT_THAT(file.getLocalisations(),
+		 testing::ElementsAre(LocalisationPair{"KEY_ONE", "First text"}, LocalisationPair{"KEY_TWO", "Second text"}));
+}
+
+
+TEST(HoI4World_Localisations_LocalisationFileTests, FilesWithoutByteOrderMarkAreRead)
+{
+	std::stringstream input;
+	input << "l_french:\n";
+	input << " KEY:0 \"text\"\n";
+	const HoI4::LocalisationFile file(input);
+
+	ASSERT_EQ("french", file.getLanguage());
+	EXPECT_THAT(file.getLocalisations(), testing::ElementsAre(LocalisationPair{"KEY", "text"}));
+}
+
+
+TEST(HoI4World_Localisations_LocalisationFileTests, CommentsBlankLinesAndCarriageReturnsAreSkipped)
+{
+	std::stringstream input;
+	input << "l_english:\r\n";
+	input << "\r\n";
+	input << " # KEY_COMMENT:0 \"commented out\"\r\n";
+	input << "\tKEY:0 \"text\" # trailing comment\r\n";
+	const HoI4::LocalisationFile file(input);
+
+	ASSERT_EQ("english", file.getLanguage());
+	EXPECT_THAT(file.getLocalisations(), testing::ElementsAre(LocalisationPair{"KEY", "text"}));
+}
+
+
+TEST(HoI4World_Localisations_LocalisationFileTests, EscapedQuotesAreKept)
+{
+	std::stringstream input;
+	input << "l_english:\n";
+	input << " KEY:0 \"He said \\\"hello\\\"\"\n";
+	const HoI4::LocalisationFile file(input);
+
+	EXPECT_THAT(file.getLocalisations(), testing::ElementsAre(LocalisationPair{"KEY", R"(He said \"hello\")"}));
+}
+
+
+TEST(HoI4World_Localisations_LocalisationFileTests, LongLinesAreNotTruncated)
+{
+	const std::string longText(5000, 'a');
+	std::stringstream input;
+	input << "l_english:\n";
+	input << " KEY:0 \"" << longText << "\"";
+	const HoI4::LocalisationFile file(input);
+
+	EXPECT_THAT(file.getLocalisations(), testing::ElementsAre(LocalisationPair{"KEY", longText}));
+}
+
+
+TEST(HoI4World_Localisations_LocalisationFileTests, LocalisationsSurviveMoves)
+{
+	std::stringstream input;
+	input << "l_english:\n";
+	input << " KEY:0 \"text\"\n";
+	HoI4::LocalisationFile file(input);
+
+	const auto movedFile = std::move(file);
+
+	ASSERT_EQ("english", movedFile.getLanguage());
+	EXPECT_THAT(movedFile.getLocalisations(), testing::ElementsAre(LocalisationPair{"KEY", "text"}));
+}
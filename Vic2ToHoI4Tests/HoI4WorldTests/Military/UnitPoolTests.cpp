@@ -0,0 +1,87 @@
+#include "HOI4World/Military/UnitPool.h"
+#include "gtest/gtest.h"
+
+
+
+TEST(HoI4World_Military_UnitPoolTests, UnitTypesAreNumberedInOrderOfFirstUse)
+{
+	HoI4::UnitTypes unitTypes;
+
+	ASSERT_EQ(0, unitTypes.getIndex("infantry"));
+	ASSERT_EQ(1, unitTypes.getIndex("cavalry"));
+	ASSERT_EQ(0, unitTypes.getIndex("infantry"));
+	ASSERT_EQ(std::vector<std::string>({"infantry", "cavalry"}), unitTypes.getNames());
+}
+
+
+TEST(HoI4World_Military_UnitPoolTests, EmptyPoolSuppliesNothing)
+{
+	const HoI4::UnitPool units;
+
+	ASSERT_FALSE(units.hasHadUnits());
+	ASSERT_FALSE(units.canSupply({HoI4::UnitRequirement{0, std::nullopt, 1}}));
+	ASSERT_TRUE(units.canSupply({}));
+}
+
+
+TEST(HoI4World_Military_UnitPoolTests, SubstitutesCountTowardsRequirements)
+{
+	HoI4::UnitPool units;
+	units.addRegiment(0, HoI4::SizedRegiment{1.0, 0.0, 0.0});
+	units.addRegiment(1, HoI4::SizedRegiment{1.0, 0.0, 0.0});
+
+	ASSERT_FALSE(units.canSupply({HoI4::UnitRequirement{0, std::nullopt, 2}}));
+	ASSERT_TRUE(units.canSupply({HoI4::UnitRequirement{0, 1, 2}}));
+}
+
+
+TEST(HoI4World_Military_UnitPoolTests, TakeUsesEarliestRegimentsFirst)
+{
+	HoI4::UnitPool units;
+	units.addRegiment(0, HoI4::SizedRegiment{1.0, 10.0, 1.0});
+	units.addRegiment(0, HoI4::SizedRegiment{2.0, 40.0, 2.0});
+
+	auto totalExperience = 0.0;
+	auto totalStrength = 0.0;
+	ASSERT_EQ(0.0, units.take(0, 2.0, totalExperience, totalStrength));
+
+	ASSERT_EQ(50.0, totalExperience);
+	ASSERT_EQ(3.0, totalStrength);
+	ASSERT_FALSE(units.canSupply({HoI4::UnitRequirement{0, std::nullopt, 2}}));
+	ASSERT_TRUE(units.canSupply({HoI4::UnitRequirement{0, std::nullopt, 1}}));
+
+	const auto remaining = units.getRemainingRegiments(0);
+	ASSERT_EQ(1, remaining.size());
+	ASSERT_EQ(1.0, remaining[0].unitSize);
+}
+
+
+TEST(HoI4World_Military_UnitPoolTests, TakeReturnsWhatCouldNotBeSupplied)
+{
+	HoI4::UnitPool units;
+	units.addRegiment(0, HoI4::SizedRegiment{1.0, 0.0, 0.0});
+
+	auto totalExperience = 0.0;
+	auto totalStrength = 0.0;
+	ASSERT_EQ(2.0, units.take(0, 3.0, totalExperience, totalStrength));
+	ASSERT_EQ(1.0, units.take(1, 1.0, totalExperience, totalStrength));
+	ASSERT_TRUE(units.getRemainingRegiments(0).empty());
+}
+
+
+TEST(HoI4World_Military_UnitPoolTests, RemainingUnitsCanBeAdded)
+{
+	HoI4::UnitPool localUnits;
+	localUnits.addRegiment(1, HoI4::SizedRegiment{1.0, 0.0, 0.0});
+	localUnits.addRegiment(1, HoI4::SizedRegiment{2.0, 0.0, 0.0});
+	auto totalExperience = 0.0;
+	auto totalStrength = 0.0;
+	localUnits.take(1, 1.0, totalExperience, totalStrength);
+
+	HoI4::UnitPool remainingUnits;
+	remainingUnits.addRemainingUnits(localUnits);
+
+	ASSERT_TRUE(remainingUnits.hasHadUnits());
+	ASSERT_EQ(1, remainingUnits.getRemainingRegiments(1).size());
+	ASSERT_TRUE(remainingUnits.canSupply({HoI4::UnitRequirement{1, std::nullopt, 2}}));
+}
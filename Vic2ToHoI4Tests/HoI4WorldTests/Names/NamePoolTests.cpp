@@ -0,0 +1,64 @@
+#include "HOI4World/Names/NamePool.h"
+#include "gmock/gmock-matchers.h"
+#include "gtest/gtest.h"
+
+
+
+TEST(HoI4World_Names_NamePoolTests, NamesDefaultToEmpty)
+{
+	const HoI4::NamePool pool;
+
+	ASSERT_TRUE(pool.empty());
+	ASSERT_TRUE(pool.getNames().empty());
+	ASSERT_FALSE(pool.pick("TAG", "purpose"));
+}
+
+
+TEST(HoI4World_Names_NamePoolTests, NamesAreKeptInOrder)
+{
+	const HoI4::NamePool pool({"name1", "", "name3"});
+
+	EXPECT_THAT(pool.getNames(), testing::ElementsAre("name1", "", "name3"));
+}
+
+
+TEST(HoI4World_Names_NamePoolTests, PickedNamesDependOnlyOnKeyAndPurpose)
+{
+	const HoI4::NamePool pool({"name1", "name2", "name3", "name4"});
+
+	const auto name = pool.pick("TAG", "purpose");
+	ASSERT_TRUE(name);
+	EXPECT_THAT(pool.getNames(), testing::Contains(*name));
+	ASSERT_EQ(name, pool.pick("TAG", "purpose"));
+	ASSERT_EQ(name, HoI4::NamePool({"name1", "name2", "name3", "name4"}).pick("TAG", "purpose"));
+}
+
+
+TEST(HoI4World_Names_NamePoolTests, TakenNamesAreRemoved)
+{
+	HoI4::NamePool pool({"name1", "name2", "name3"});
+
+	const auto first = pool.take("TAG", "purpose");
+	const auto second = pool.take("TAG", "purpose");
+	const auto third = pool.take("TAG", "purpose");
+	const auto fourth = pool.take("TAG", "purpose");
+
+	ASSERT_TRUE(first);
+	ASSERT_TRUE(second);
+	ASSERT_TRUE(third);
+	EXPECT_THAT((std::vector{*first, *second, *third}), testing::UnorderedElementsAre("name1", "name2", "name3"));
+	ASSERT_FALSE(fourth);
+	ASSERT_TRUE(pool.empty());
+}
+
+
+TEST(HoI4World_Names_NamePoolTests, TakingFromCopyLeavesOriginalUnchanged)
+{
+	const HoI4::NamePool pool({"name1", "name2"});
+	auto copy = pool;
+
+	ASSERT_TRUE(copy.take("TAG", "purpose"));
+
+	EXPECT_THAT(pool.getNames(), testing::ElementsAre("name1", "name2"));
+	ASSERT_EQ(1, copy.getNames().size());
+}
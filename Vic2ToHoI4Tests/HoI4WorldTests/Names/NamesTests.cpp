@@ -0,0 +1,65 @@
+#include "HOI4World/Names/Names.h"
+#include "gmock/gmock-matchers.h"
+#include "gtest/gtest.h"
+
+
+
+namespace
+{
+
+HoI4::Names makeNames()
+{
+	return HoI4::Names({{"culture", {"male1", "male2", "male3", "male4"}}},
+		 {},
+		 {{"culture", {"surname1", "surname2", "surname3", "surname4"}}},
+		 {},
+		 {},
+		 {{"culture", {"car1", "car2", "car3"}}},
+		 {},
+		 {},
+		 {},
+		 {},
+		 {},
+		 {});
+}
+
+} // namespace
+
+
+
+TEST(HoI4World_Names_NamesTests, MissingCultureGivesNoMaleName)
+{
+	const auto names = makeNames();
+
+	ASSERT_FALSE(names.getMaleName("missing_culture", "TAG"));
+}
+
+
+TEST(HoI4World_Names_NamesTests, MaleNameDependsOnlyOnCultureAndKey)
+{
+	const auto names = makeNames();
+
+	const auto first = names.getMaleName("culture", "TAG");
+	ASSERT_TRUE(first);
+	ASSERT_TRUE(names.getMaleName("culture", "OTH"));
+	ASSERT_TRUE(names.getSurname("culture", "TAG"));
+
+	ASSERT_EQ(first, names.getMaleName("culture", "TAG"));
+	ASSERT_EQ(first, makeNames().getMaleName("culture", "TAG"));
+}
+
+
+TEST(HoI4World_Names_NamesTests, TakenCompanyNamesAreNotGivenAgain)
+{
+	auto names = makeNames();
+
+	const auto first = names.takeCarCompanyName("culture", "TAG_tank_manufacturer");
+	const auto second = names.takeCarCompanyName("culture", "TAG_tank_manufacturer");
+	const auto third = names.takeCarCompanyName("culture", "TAG_tank_manufacturer");
+	const auto fourth = names.takeCarCompanyName("culture", "TAG_tank_manufacturer");
+
+	ASSERT_TRUE(first && second && third);
+	ASSERT_THAT(std::vector<std::string>({*first, *second, *third}),
+		 testing::UnorderedElementsAre("car1", "car2", "car3"));
+	ASSERT_FALSE(fourth);
+}
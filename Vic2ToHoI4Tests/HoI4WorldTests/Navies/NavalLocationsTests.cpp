@@ -0,0 +1,104 @@
+#include "HOI4World/Navies/NavalLocations.h"
+#include "HOI4World/States/HoI4StateBuilder.h"
+#include "Mappers/Provinces/ProvinceMapperBuilder.h"
+#include "gtest/gtest.h"
+
+
+
+namespace
+{
+
+HoI4::State makeState(int id, const std::string& owner, std::optional<int> navalBase)
+{
+	if (!navalBase)
+	{
+		return *HoI4::State::Builder{}.setId(id).setOwner(owner).Build();
+	}
+
+	auto state = *HoI4::State::Builder{}.setId(id).setOwner(owner).setProvinces({*navalBase}).Build();
+	state.addNavalBase(1, *navalBase);
+	return state;
+}
+
+} // namespace
+
+
+
+TEST(HoI4World_Navies_NavalLocationsTests, BackupNavalLocationDefaultsToZero)
+{
+	const HoI4::NavalLocations navalLocations({}, {}, HoI4::ProvinceDefinitions({}, {}, {}));
+
+	ASSERT_EQ(0, navalLocations.getBackupNavalLocation("TAG"));
+}
+
+
+TEST(HoI4World_Navies_NavalLocationsTests, BackupNavalLocationIsBaseOfLastOwnedStateWithBase)
+{
+	std::map<int, HoI4::State> states;
+	states.emplace(1, makeState(1, "TAG", 10));
+	states.emplace(2, makeState(2, "TAG", 20));
+	states.emplace(3, makeState(3, "TAG", std::nullopt));
+	states.emplace(4, makeState(4, "OTH", 40));
+
+	const HoI4::NavalLocations navalLocations(states, {}, HoI4::ProvinceDefinitions({}, {}, {}));
+
+	ASSERT_EQ(20, navalLocations.getBackupNavalLocation("TAG"));
+	ASSERT_EQ(40, navalLocations.getBackupNavalLocation("OTH"));
+}
+
+
+TEST(HoI4World_Navies_NavalLocationsTests, MissingLocationUsesBackup)
+{
+	const HoI4::NavalLocations navalLocations({}, {}, HoI4::ProvinceDefinitions({}, {}, {}));
+
+	const auto [location, base] =
+		 navalLocations.getLocationAndBase(std::nullopt, 5, *Mappers::ProvinceMapper::Builder{}.Build());
+
+	ASSERT_EQ(5, location);
+	ASSERT_EQ(5, base);
+}
+
+
+TEST(HoI4World_Navies_NavalLocationsTests, SeaProvinceIsUsedWithBackupBase)
+{
+	const HoI4::NavalLocations navalLocations({}, {}, HoI4::ProvinceDefinitions({}, {100}, {}));
+
+	const auto [location, base] = navalLocations.getLocationAndBase(1,
+		 5,
+		 *Mappers::ProvinceMapper::Builder{}.addVic2ToHoI4ProvinceMap(1, {100}).Build());
+
+	ASSERT_EQ(100, location);
+	ASSERT_EQ(5, base);
+}
+
+
+TEST(HoI4World_Navies_NavalLocationsTests, StateMainNavalBaseIsUsedForLandProvince)
+{
+	std::map<int, HoI4::State> states;
+	states.emplace(1, makeState(1, "TAG", 11));
+
+	const HoI4::NavalLocations navalLocations(states, {{10, 1}, {11, 1}}, HoI4::ProvinceDefinitions({}, {}, {}));
+
+	const auto [location, base] = navalLocations.getLocationAndBase(1,
+		 5,
+		 *Mappers::ProvinceMapper::Builder{}.addVic2ToHoI4ProvinceMap(1, {10}).Build());
+
+	ASSERT_EQ(11, location);
+	ASSERT_EQ(11, base);
+}
+
+
+TEST(HoI4World_Navies_NavalLocationsTests, UnplaceableLocationUsesBackup)
+{
+	std::map<int, HoI4::State> states;
+	states.emplace(1, makeState(1, "TAG", std::nullopt));
+
+	const HoI4::NavalLocations navalLocations(states, {{10, 1}}, HoI4::ProvinceDefinitions({}, {}, {}));
+
+	const auto [location, base] = navalLocations.getLocationAndBase(1,
+		 5,
+		 *Mappers::ProvinceMapper::Builder{}.addVic2ToHoI4ProvinceMap(1, {10, 12}).Build());
+
+	ASSERT_EQ(5, location);
+	ASSERT_EQ(5, base);
+}
@@ -117,8 +117,7 @@ TEST_F(HoI4World_Navies_NaviesTests, NaviesConvertToLegacy)
 
 	std::stringstream mtgUnitMappingStream;
 	HoI4::MtgUnitMappings mtgUnitMap(mtgUnitMappingStream);
-	std::map<int, int> provinceToStateIDMap;
-	std::map<int, HoI4::State> states;
+	const HoI4::NavalLocations navalLocations({}, {}, provinceDefinitions);
 
 	std::stringstream input;
 	input << "legacy_ship_type = {\n";
@@ -135,10 +134,8 @@ TEST_F(HoI4World_Navies_NaviesTests, NaviesConvertToLegacy)
 		 unitMappings,
 		 mtgUnitMap,
 		 theVariants,
-		 provinceToStateIDMap,
-		 states,
+		 navalLocations,
 		 "TAG",
-		 provinceDefinitions,
 		 provinceMapper);
 	std::ostringstream output;
 	outputLegacyNavies(navies, ownedTechs, "TAG", output);
@@ -201,18 +198,15 @@ TEST_F(HoI4World_Navies_NaviesTests, OnlyConvertToAvailableLegacyShipType)
 	std::stringstream input;
 	HoI4::MtgUnitMappings unitMap(input);
 
-	std::map<int, int> provinceToStateIDMap;
-	std::map<int, HoI4::State> states;
+	const HoI4::NavalLocations navalLocations({}, {}, provinceDefinitions);
 
 	HoI4::Navies navies(sourceArmies,
 		 0,
 		 legacyUnitMap,
 		 unitMap,
 		 *limitedShipVariants,
-		 provinceToStateIDMap,
-		 states,
+		 navalLocations,
 		 "TAG",
-		 provinceDefinitions,
 		 provinceMapper);
 	std::ostringstream output;
 	outputMtgNavies(navies, *HoI4::technologies::Builder{}.Build(), "TAG", output);
@@ -255,18 +249,15 @@ TEST_F(HoI4World_Navies_NaviesTests, NaviesWithoutShipsDontConvertToLegacy)
 
 	std::stringstream mtgUnitMappingStream;
 	HoI4::MtgUnitMappings mtgUnitMap(mtgUnitMappingStream);
-	std::map<int, int> provinceToStateIDMap;
-	std::map<int, HoI4::State> states;
+	const HoI4::NavalLocations navalLocations({}, {}, provinceDefinitions);
 
 	HoI4::Navies navies(sourceArmies,
 		 0,
 		 unitMappings,
 		 mtgUnitMap,
 		 *theShipVariants,
-		 provinceToStateIDMap,
-		 states,
+		 navalLocations,
 		 "TAG",
-		 provinceDefinitions,
 		 provinceMapper);
 	std::ostringstream output;
 	outputLegacyNavies(navies, *HoI4::technologies::Builder{}.Build(), "TAG", output);
@@ -317,18 +308,15 @@ TEST_F(HoI4World_Navies_NaviesTests, NonNavalUnitsArentAddedToLegacyNavy)
 
 	std::stringstream mtgUnitMappingStream;
 	HoI4::MtgUnitMappings mtgUnitMap(mtgUnitMappingStream);
-	std::map<int, int> provinceToStateIDMap;
-	std::map<int, HoI4::State> states;
+	const HoI4::NavalLocations navalLocations({}, {}, provinceDefinitions);
 
 	HoI4::Navies navies(sourceArmies,
 		 0,
 		 unitMappings,
 		 mtgUnitMap,
 		 *theShipVariants,
-		 provinceToStateIDMap,
-		 states,
+		 navalLocations,
 		 "TAG",
-		 provinceDefinitions,
 		 provinceMapper);
 	std::ostringstream output;
 	outputLegacyNavies(navies, *HoI4::technologies::Builder{}.Build(), "TAG", output);
@@ -382,8 +370,7 @@ TEST_F(HoI4World_Navies_NaviesTests, LegacyNavyNamesConvert)
 
 	std::stringstream mtgUnitMappingStream;
 	HoI4::MtgUnitMappings mtgUnitMap(mtgUnitMappingStream);
-	std::map<int, int> provinceToStateIDMap;
-	std::map<int, HoI4::State> states;
+	const HoI4::NavalLocations navalLocations({}, {}, provinceDefinitions);
 
 	std::stringstream input;
 	input << "legacy_ship_type = {\n";
@@ -399,10 +386,8 @@ TEST_F(HoI4World_Navies_NaviesTests, LegacyNavyNamesConvert)
 		 unitMappings,
 		 mtgUnitMap,
 		 theVariants,
-		 provinceToStateIDMap,
-		 states,
+		 navalLocations,
 		 "TAG",
-		 provinceDefinitions,
 		 provinceMapper);
 	std::ostringstream output;
 	outputLegacyNavies(navies, ownedTechs, "TAG", output);
@@ -440,8 +425,7 @@ TEST_F(HoI4World_Navies_NaviesTests, LegacyCanHave1936DestroyerInProduction)
 
 	std::stringstream mtgUnitMappingStream;
 	HoI4::MtgUnitMappings mtgUnitMap(mtgUnitMappingStream);
-	std::map<int, int> provinceToStateIDMap;
-	std::map<int, HoI4::State> states;
+	const HoI4::NavalLocations navalLocations({}, {}, provinceDefinitions);
 
 	std::stringstream input;
 	HoI4::PossibleShipVariants possibleVariants(input);
@@ -453,10 +437,8 @@ TEST_F(HoI4World_Navies_NaviesTests, LegacyCanHave1936DestroyerInProduction)
 		 unitMappings,
 		 mtgUnitMap,
 		 theVariants,
-		 provinceToStateIDMap,
-		 states,
+		 navalLocations,
 		 "TAG",
-		 provinceDefinitions,
 		 provinceMapper);
 	std::ostringstream output;
 	outputLegacyNavies(navies, ownedTechs, "TAG", output);
@@ -493,8 +475,7 @@ TEST_F(HoI4World_Navies_NaviesTests, LegacyCanHaveEarlyDestroyerInProduction)
 
 	std::stringstream mtgUnitMappingStream;
 	HoI4::MtgUnitMappings mtgUnitMap(mtgUnitMappingStream);
-	std::map<int, int> provinceToStateIDMap;
-	std::map<int, HoI4::State> states;
+	const HoI4::NavalLocations navalLocations({}, {}, provinceDefinitions);
 
 	std::stringstream input;
 	HoI4::PossibleShipVariants possibleVariants(input);
@@ -506,10 +487,8 @@ TEST_F(HoI4World_Navies_NaviesTests, LegacyCanHaveEarlyDestroyerInProduction)
 		 unitMappings,
 		 mtgUnitMap,
 		 theVariants,
-		 provinceToStateIDMap,
-		 states,
+		 navalLocations,
 		 "TAG",
-		 provinceDefinitions,
 		 provinceMapper);
 	std::ostringstream output;
 	outputLegacyNavies(navies, ownedTechs, "TAG", output);
@@ -546,8 +525,7 @@ TEST_F(HoI4World_Navies_NaviesTests, LegacyCanHave1936BattleshipInProduction)
 
 	std::stringstream mtgUnitMappingStream;
 	HoI4::MtgUnitMappings mtgUnitMap(mtgUnitMappingStream);
-	std::map<int, int> provinceToStateIDMap;
-	std::map<int, HoI4::State> states;
+	const HoI4::NavalLocations navalLocations({}, {}, provinceDefinitions);
 
 	std::stringstream input;
 	HoI4::PossibleShipVariants possibleVariants(input);
@@ -559,10 +537,8 @@ TEST_F(HoI4World_Navies_NaviesTests, LegacyCanHave1936BattleshipInProduction)
 		 unitMappings,
 		 mtgUnitMap,
 		 theVariants,
-		 provinceToStateIDMap,
-		 states,
+		 navalLocations,
 		 "TAG",
-		 provinceDefinitions,
 		 provinceMapper);
 	std::ostringstream output;
 	outputLegacyNavies(navies, ownedTechs, "TAG", output);
@@ -599,8 +575,7 @@ TEST_F(HoI4World_Navies_NaviesTests, LegacyCanHaveEarlyBattleshipInProduction)
 
 	std::stringstream mtgUnitMappingStream;
 	HoI4::MtgUnitMappings mtgUnitMap(mtgUnitMappingStream);
-	std::map<int, int> provinceToStateIDMap;
-	std::map<int, HoI4::State> states;
+	const HoI4::NavalLocations navalLocations({}, {}, provinceDefinitions);
 
 	std::stringstream input;
 	HoI4::PossibleShipVariants possibleVariants(input);
@@ -612,10 +587,8 @@ TEST_F(HoI4World_Navies_NaviesTests, LegacyCanHaveEarlyBattleshipInProduction)
 		 unitMappings,
 		 mtgUnitMap,
 		 theVariants,
-		 provinceToStateIDMap,
-		 states,
+		 navalLocations,
 		 "TAG",
-		 provinceDefinitions,
 		 provinceMapper);
 	std::ostringstream output;
 	outputLegacyNavies(navies, ownedTechs, "TAG", output);
@@ -677,18 +650,15 @@ TEST_F(HoI4World_Navies_NaviesTests, NaviesConvertToMtg)
 	mtgUnitMappingStream << "}";
 	HoI4::MtgUnitMappings mtgUnitMap(mtgUnitMappingStream);
 
-	std::map<int, int> provinceToStateIDMap;
-	std::map<int, HoI4::State> states;
+	const HoI4::NavalLocations navalLocations({}, {}, provinceDefinitions);
 
 	HoI4::Navies navies(sourceArmies,
 		 0,
 		 unitMap,
 		 mtgUnitMap,
 		 *theShipVariants,
-		 provinceToStateIDMap,
-		 states,
+		 navalLocations,
 		 "TAG",
-		 provinceDefinitions,
 		 provinceMapper);
 	std::ostringstream output;
 	outputMtgNavies(navies, *HoI4::technologies::Builder{}.Build(), "TAG", output);
@@ -758,18 +728,15 @@ TEST_F(HoI4World_Navies_NaviesTests, OnlyConvertToAvailableMtgShipType)
 	mtgUnitMappingStream << "}";
 	HoI4::MtgUnitMappings mtgUnitMap(mtgUnitMappingStream);
 
-	std::map<int, int> provinceToStateIDMap;
-	std::map<int, HoI4::State> states;
+	const HoI4::NavalLocations navalLocations({}, {}, provinceDefinitions);
 
 	HoI4::Navies navies(sourceArmies,
 		 0,
 		 unitMap,
 		 mtgUnitMap,
 		 *limitedShipVariants,
-		 provinceToStateIDMap,
-		 states,
+		 navalLocations,
 		 "TAG",
-		 provinceDefinitions,
 		 provinceMapper);
 	std::ostringstream output;
 	outputMtgNavies(navies, *HoI4::technologies::Builder{}.Build(), "TAG", output);
@@ -832,18 +799,15 @@ TEST_F(HoI4World_Navies_NaviesTests, ConvertedNaviesGetExperience)
 	mtgUnitMappingStream << "}";
 	HoI4::MtgUnitMappings mtgUnitMap(mtgUnitMappingStream);
 
-	std::map<int, int> provinceToStateIDMap;
-	std::map<int, HoI4::State> states;
+	const HoI4::NavalLocations navalLocations({}, {}, provinceDefinitions);
 
 	HoI4::Navies navies(sourceArmies,
 		 0,
 		 unitMap,
 		 mtgUnitMap,
 		 *theShipVariants,
-		 provinceToStateIDMap,
-		 states,
+		 navalLocations,
 		 "TAG",
-		 provinceDefinitions,
 		 provinceMapper);
 	std::ostringstream output;
 	outputMtgNavies(navies, *HoI4::technologies::Builder{}.Build(), "TAG", output);
@@ -898,18 +862,15 @@ TEST_F(HoI4World_Navies_NaviesTests, NaviesWithoutShipsDontConvertToMtg)
 	mtgUnitMappingStream << "}";
 	HoI4::MtgUnitMappings mtgUnitMap(mtgUnitMappingStream);
 
-	std::map<int, int> provinceToStateIDMap;
-	std::map<int, HoI4::State> states;
+	const HoI4::NavalLocations navalLocations({}, {}, provinceDefinitions);
 
 	HoI4::Navies navies(sourceArmies,
 		 0,
 		 unitMap,
 		 mtgUnitMap,
 		 *theShipVariants,
-		 provinceToStateIDMap,
-		 states,
+		 navalLocations,
 		 "TAG",
-		 provinceDefinitions,
 		 provinceMapper);
 	std::ostringstream output;
 	outputMtgNavies(navies, *HoI4::technologies::Builder{}.Build(), "TAG", output);
@@ -962,18 +923,15 @@ TEST_F(HoI4World_Navies_NaviesTests, NonNavalUnitsArentAddedToMtgNavy)
 	mtgUnitMappingStream << "}";
 	HoI4::MtgUnitMappings mtgUnitMap(mtgUnitMappingStream);
 
-	std::map<int, int> provinceToStateIDMap;
-	std::map<int, HoI4::State> states;
+	const HoI4::NavalLocations navalLocations({}, {}, provinceDefinitions);
 
 	HoI4::Navies navies(sourceArmies,
 		 0,
 		 unitMap,
 		 mtgUnitMap,
 		 *theShipVariants,
-		 provinceToStateIDMap,
-		 states,
+		 navalLocations,
 		 "TAG",
-		 provinceDefinitions,
 		 provinceMapper);
 	std::ostringstream output;
 	outputMtgNavies(navies, *HoI4::technologies::Builder{}.Build(), "TAG", output);
@@ -1026,18 +984,15 @@ TEST_F(HoI4World_Navies_NaviesTests, MtgNavyNamesConvert)
 	mtgUnitMappingStream << "}";
 	HoI4::MtgUnitMappings mtgUnitMap(mtgUnitMappingStream);
 
-	std::map<int, int> provinceToStateIDMap;
-	std::map<int, HoI4::State> states;
+	const HoI4::NavalLocations navalLocations({}, {}, provinceDefinitions);
 
 	HoI4::Navies navies(sourceArmies,
 		 0,
 		 unitMap,
 		 mtgUnitMap,
 		 *theShipVariants,
-		 provinceToStateIDMap,
-		 states,
+		 navalLocations,
 		 "TAG",
-		 provinceDefinitions,
 		 provinceMapper);
 	std::ostringstream output;
 	outputMtgNavies(navies, *HoI4::technologies::Builder{}.Build(), "TAG", output);
@@ -1076,18 +1031,15 @@ TEST_F(HoI4World_Navies_NaviesTests, MtgCanHave1936DestroyerInProduction)
 	std::stringstream mtgUnitMappingStream;
 	HoI4::MtgUnitMappings mtgUnitMap(mtgUnitMappingStream);
 
-	std::map<int, int> provinceToStateIDMap;
-	std::map<int, HoI4::State> states;
+	const HoI4::NavalLocations navalLocations({}, {}, provinceDefinitions);
 
 	HoI4::Navies navies(sourceArmies,
 		 0,
 		 unitMap,
 		 mtgUnitMap,
 		 *theShipVariants,
-		 provinceToStateIDMap,
-		 states,
+		 navalLocations,
 		 "TAG",
-		 provinceDefinitions,
 		 provinceMapper);
 	std::ostringstream output;
 	outputMtgNavies(navies,
@@ -1129,18 +1081,15 @@ TEST_F(HoI4World_Navies_NaviesTests, MtgCanHaveEarlyDestroyerInProduction)
 	std::stringstream mtgUnitMappingStream;
 	HoI4::MtgUnitMappings mtgUnitMap(mtgUnitMappingStream);
 
-	std::map<int, int> provinceToStateIDMap;
-	std::map<int, HoI4::State> states;
+	const HoI4::NavalLocations navalLocations({}, {}, provinceDefinitions);
 
 	HoI4::Navies navies(sourceArmies,
 		 0,
 		 unitMap,
 		 mtgUnitMap,
 		 *theShipVariants,
-		 provinceToStateIDMap,
-		 states,
+		 navalLocations,
 		 "TAG",
-		 provinceDefinitions,
 		 provinceMapper);
 	std::ostringstream output;
 	outputMtgNavies(navies,
@@ -1182,18 +1131,15 @@ TEST_F(HoI4World_Navies_NaviesTests, MtgCanHave1936BattleshipInProduction)
 	std::stringstream mtgUnitMappingStream;
 	HoI4::MtgUnitMappings mtgUnitMap(mtgUnitMappingStream);
 
-	std::map<int, int> provinceToStateIDMap;
-	std::map<int, HoI4::State> states;
+	const HoI4::NavalLocations navalLocations({}, {}, provinceDefinitions);
 
 	HoI4::Navies navies(sourceArmies,
 		 0,
 		 unitMap,
 		 mtgUnitMap,
 		 *theShipVariants,
-		 provinceToStateIDMap,
-		 states,
+		 navalLocations,
 		 "TAG",
-		 provinceDefinitions,
 		 provinceMapper);
 	std::ostringstream output;
 	outputMtgNavies(navies,
@@ -1235,18 +1181,15 @@ TEST_F(HoI4World_Navies_NaviesTests, MtgCanHaveEarlyBattleshipInProduction)
 	std::stringstream mtgUnitMappingStream;
 	HoI4::MtgUnitMappings mtgUnitMap(mtgUnitMappingStream);
 
-	std::map<int, int> provinceToStateIDMap;
-	std::map<int, HoI4::State> states;
+	const HoI4::NavalLocations navalLocations({}, {}, provinceDefinitions);
 
 	HoI4::Navies navies(sourceArmies,
 		 0,
 		 unitMap,
 		 mtgUnitMap,
 		 *theShipVariants,
-		 provinceToStateIDMap,
-		 states,
+		 navalLocations,
 		 "TAG",
-		 provinceDefinitions,
 		 provinceMapper);
 	std::ostringstream output;
 	outputMtgNavies(navies,
@@ -0,0 +1,81 @@
+#include "HOI4World/ScriptTemplate.h"
+#include "gtest/gtest.h"
+
+
+
+TEST(HoI4World_ScriptTemplateTests, ScriptWithoutSlotsIsRenderedUnchanged)
+{
+	const HoI4::ScriptTemplate script("= {\n\ttag = GER\n}", {"$TARGET"});
+
+	ASSERT_EQ("= {\n\ttag = GER\n}", script.render({{"$TARGET", "FRA"}}));
+}
+
+
+TEST(HoI4World_ScriptTemplateTests, EveryOccurrenceOfBoundSlotsIsReplaced)
+{
+	const HoI4::ScriptTemplate script("= {\n\ttag = $TARGET\n\thas_war_with = $TARGET\n\tdate > $STARTDATE\n}",
+		 {"$TARGET", "$STARTDATE"});
+
+	ASSERT_EQ("= {\n\ttag = FRA\n\thas_war_with = FRA\n\tdate > 1936.1.1\n}",
+		 script.render({{"$TARGET", "FRA"}, {"$STARTDATE", "1936.1.1"}}));
+}
+
+
+TEST(HoI4World_ScriptTemplateTests, UnboundSlotsAreLeftInPlace)
+{
+	const HoI4::ScriptTemplate script("$TARGET = { $TAG }", {"$TARGET", "$TAG"});
+
+	ASSERT_EQ("$TARGET = { GER }", script.render({{"$TAG", "GER"}}));
+}
+
+
+TEST(HoI4World_ScriptTemplateTests, BoundValuesAreNotSearchedForSlots)
+{
+	const HoI4::ScriptTemplate script("#COMMUNISM $TARGET", {"#COMMUNISM", "$TARGET"});
+
+	ASSERT_EQ("target = $TARGET FRA", script.render({{"#COMMUNISM", "target = $TARGET"}, {"$TARGET", "FRA"}}));
+}
+
+
+TEST(HoI4World_ScriptTemplateTests, LongerSlotIsPreferredWhenSlotsStartTogether)
+{
+	const HoI4::ScriptTemplate script("var:neighbor_war_defender var:neighbor_war_defender_2",
+		 {"var:neighbor_war_defender", "var:neighbor_war_defender_2"});
+
+	ASSERT_EQ("FRA ITA",
+		 script.render({{"var:neighbor_war_defender", "FRA"}, {"var:neighbor_war_defender_2", "ITA"}}));
+}
+
+
+TEST(HoI4World_ScriptTemplateTests, SlotsBoundToNothingRemoveTheirLine)
+{
+	const HoI4::ScriptTemplate script("= {\n\tOR = {\n\t\t#COMMUNISM\n\t\t#FASCISM\n\t}\n}", {"#COMMUNISM", "#FASCISM"});
+
+	ASSERT_EQ("= {\n\tOR = {\n\t\tfascist = yes\n\t}\n}",
+		 script.render({{"#COMMUNISM", std::nullopt}, {"#FASCISM", "fascist = yes"}}));
+}
+
+
+TEST(HoI4World_ScriptTemplateTests, RemovingTwoSlotsOnOneLineOnlyRemovesThatLine)
+{
+	const HoI4::ScriptTemplate script("first\nsecond #RADICAL and #RADICAL kept\nthird", {"#RADICAL"});
+
+	ASSERT_EQ("first kept\nthird", script.render({{"#RADICAL", std::nullopt}}));
+}
+
+
+TEST(HoI4World_ScriptTemplateTests, SlotOnFirstLineIsNotRemoved)
+{
+	const HoI4::ScriptTemplate script("#RADICAL\nsecond", {"#RADICAL"});
+
+	ASSERT_EQ("#RADICAL\nsecond", script.render({{"#RADICAL", std::nullopt}}));
+}
+
+
+TEST(HoI4World_ScriptTemplateTests, TemplateCanBeRenderedRepeatedly)
+{
+	const HoI4::ScriptTemplate script("declare_war_on = { target = $TARGET }", {"$TARGET"});
+
+	ASSERT_EQ("declare_war_on = { target = FRA }", script.render({{"$TARGET", "FRA"}}));
+	ASSERT_EQ("declare_war_on = { target = ITA }", script.render({{"$TARGET", "ITA"}}));
+}
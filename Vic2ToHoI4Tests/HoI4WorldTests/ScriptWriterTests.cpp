@@ -0,0 +1,77 @@
+#include "HOI4World/ScriptWriter.h"
+#include "gtest/gtest.h"
+
+
+
+TEST(HoI4World_ScriptWriterTests, EmptyWriterGivesEmptyBlock)
+{
+	HoI4::ScriptWriter writer(2);
+
+	ASSERT_TRUE(writer.finish().empty());
+}
+
+
+TEST(HoI4World_ScriptWriterTests, FirstLineIsNotIndentedAndLastLineHasNoNewline)
+{
+	HoI4::ScriptWriter writer(2);
+	writer.open("add_popularity").set("ideology", "fascism").set("popularity", "0.05").close();
+
+	ASSERT_EQ("add_popularity = {\n\t\t\tideology = fascism\n\t\t\tpopularity = 0.05\n\t\t}", writer.finish());
+}
+
+
+TEST(HoI4World_ScriptWriterTests, OpenWithoutKeyStartsAnAnonymousBlock)
+{
+	HoI4::ScriptWriter writer(1);
+	writer.open().set("days", 150).close();
+
+	ASSERT_EQ("= {\n\t\tdays = 150\n\t}", writer.finish());
+}
+
+
+TEST(HoI4World_ScriptWriterTests, NestedBlocksAreIndentedOneTabPerLevel)
+{
+	HoI4::ScriptWriter writer(0);
+	writer.open("if").open("limit").line("NOT = { has_government = fascism }").close().set("x", "y").close();
+
+	ASSERT_EQ("if = {\n\tlimit = {\n\t\tNOT = { has_government = fascism }\n\t}\n\tx = y\n}", writer.finish());
+}
+
+
+TEST(HoI4World_ScriptWriterTests, LinesJoinTextAndNumbers)
+{
+	HoI4::ScriptWriter writer(0);
+	writer.open(42).line("country_event = { hours = 2 id = NFEvents.", 7, " }").set("add", -15).close();
+
+	ASSERT_EQ("42 = {\n\tcountry_event = { hours = 2 id = NFEvents.7 }\n\tadd = -15\n}", writer.finish());
+}
+
+
+TEST(HoI4World_ScriptWriterTests, WriterCanBeReusedAfterFinishing)
+{
+	HoI4::ScriptWriter writer(1);
+	writer.open().set("a", 1).close();
+	ASSERT_EQ("= {\n\t\ta = 1\n\t}", writer.finish());
+
+	writer.open().set("b", 2).close();
+	ASSERT_EQ("= {\n\t\tb = 2\n\t}", writer.finish());
+}
+
+
+TEST(HoI4World_ScriptWriterTests, InnerWriterDoesNotDisturbOuterBlock)
+{
+	HoI4::ScriptWriter outer(0);
+	outer.open("outer");
+	{
+		HoI4::ScriptWriter inner(0);
+		inner.set("inner", "yes");
+		ASSERT_EQ("inner = yes", inner.finish());
+	}
+	{
+		HoI4::ScriptWriter abandoned(0);
+		abandoned.set("abandoned", "yes");
+	}
+	outer.set("value", 1).close();
+
+	ASSERT_EQ("outer = {\n\tvalue = 1\n}", outer.finish());
+}
@@ -1,5 +1,4 @@
 #include "HOI4World/ShipTypes/LegacyShipVariant.h"
-#include "HOI4World/TechnologiesBuilder.h"
 #include "gtest/gtest.h"
 #include <sstream>
 
@@ -137,89 +136,4 @@ TEST(HoI4World_ShipTypes_LegacyShipVariantTests, OnlySetObsoleteByYes)
 	expectedOutput << "\n";
 
 	ASSERT_EQ(expectedOutput.str(), output.str());
-}
-
-
-TEST(HoI4World_ShipTypes_LegacyShipVariantTests, NoRequiredTechsMeansVariantIsValid)
-{
-	std::stringstream input;
-	input << " = {\n";
-	input << "}";
-	const HoI4::LegacyShipVariant theLegacyShipVariant(input);
-
-	ASSERT_TRUE(theLegacyShipVariant.isValidVariant(*HoI4::technologies::Builder{}.Build()));
-}
-
-
-TEST(HoI4World_ShipTypes_LegacyShipVariantTests, MissingRequiredTechMeansVariantIsInvalid)
-{
-	std::stringstream input;
-	input << " = {\n";
-	input << "\trequired_techs = {\n";
-	input << "\t\trequired_tech1\n";
-	input << "\t}\n";
-	input << "}";
-	const HoI4::LegacyShipVariant theLegacyShipVariant(input);
-
-	ASSERT_FALSE(theLegacyShipVariant.isValidVariant(*HoI4::technologies::Builder{}.Build()));
-}
-
-
-TEST(HoI4World_ShipTypes_LegacyShipVariantTests, HavingRequiredTechsMeansVariantIsValid)
-{
-	std::stringstream input;
-	input << " = {\n";
-	input << "\trequired_techs = {\n";
-	input << "\t\trequired_tech1\n";
-	input << "\t}\n";
-	input << "}";
-	const HoI4::LegacyShipVariant theLegacyShipVariant(input);
-
-	ASSERT_TRUE(
-		 theLegacyShipVariant.isValidVariant(*HoI4::technologies::Builder{}.addTechnology("required_tech1").Build()));
-}
-
-
-TEST(HoI4World_ShipTypes_LegacyShipVariantTests, HavingOnlySomeRequiredTechsMeansVariantIsInvalid)
-{
-	std::stringstream input;
-	input << " = {\n";
-	input << "\trequired_techs = {\n";
-	input << "\t\trequired_tech1\n";
-	input << "\t\trequired_tech2\n";
-	input << "\t}\n";
-	input << "}";
-	const HoI4::LegacyShipVariant theLegacyShipVariant(input);
-
-	ASSERT_FALSE(
-		 theLegacyShipVariant.isValidVariant(*HoI4::technologies::Builder{}.addTechnology("required_tech1").Build()));
-}
-
-
-TEST(HoI4World_ShipTypes_LegacyShipVariantTests, HavingBlockingTechsMeansVariantIsInvalid)
-{
-	std::stringstream input;
-	input << " = {\n";
-	input << "\tblocking_techs = {\n";
-	input << "\t\trequired_tech1\n";
-	input << "\t}\n";
-	input << "}";
-	const HoI4::LegacyShipVariant theLegacyShipVariant(input);
-
-	ASSERT_FALSE(
-		 theLegacyShipVariant.isValidVariant(*HoI4::technologies::Builder{}.addTechnology("required_tech1").Build()));
-}
-
-
-TEST(HoI4World_ShipTypes_LegacyShipVariantTests, HavingNoBlockingTechsMeansVariantIsValid)
-{
-	std::stringstream input;
-	input << " = {\n";
-	input << "\tblocking_techs = {\n";
-	input << "\t\trequired_tech1\n";
-	input << "\t}\n";
-	input << "}";
-	const HoI4::LegacyShipVariant theLegacyShipVariant(input);
-
-	ASSERT_TRUE(theLegacyShipVariant.isValidVariant(*HoI4::technologies::Builder{}.Build()));
 }
\ No newline at end of file
@@ -1,5 +1,5 @@
 #include "HOI4World/ShipTypes/MtgShipVariant.h"
-#include "HOI4World/TechnologiesBuilder.h"
+#include "OutHoi4/ShipTypes/OutMtgShipVariant.h"
 #include "gtest/gtest.h"
 #include <sstream>
 
@@ -81,17 +81,16 @@ TEST(HoI4World_ShipTypes_MtgShipVariantTests, NameGroupCanBeInput)
 }
 
 
-TEST(HoI4World_ShipTypes_MtgShipVariantTests, OwningCountryTagCanBeInput)
+TEST(HoI4World_ShipTypes_MtgShipVariantTests, OwningCountryTagIsAddedToNameGroup)
 {
 	std::stringstream input;
 	input << " = {\n";
 	input << "\tname_group = NAME_GROUP\n";
 	input << "}";
 	HoI4::MtgShipVariant theMtgShipVariant(input);
-	theMtgShipVariant.setOwningCountryTag("TAG");
 
 	std::stringstream output;
-	output << theMtgShipVariant;
+	outputMtgShipVariant(output, theMtgShipVariant, "TAG");
 
 	std::stringstream expectedOutput;
 	expectedOutput << "\tcreate_equipment_variant = {\n";
@@ -175,89 +174,4 @@ TEST(HoI4World_ShipTypes_MtgShipVariantTests, OnlySetObsoleteByYes)
 	expectedOutput << "\t\tparent_version = 0\n";
 	expectedOutput << "\t}\n";
 	ASSERT_EQ(expectedOutput.str(), output.str());
-}
-
-
-TEST(HoI4World_ShipTypes_MtgShipVariantTests, NoRequiredTechsMeansVariantIsValid)
-{
-	std::stringstream input;
-	input << " = {\n";
-	input << "}";
-	const HoI4::MtgShipVariant theMtgShipVariant(input);
-
-	ASSERT_TRUE(theMtgShipVariant.isValidVariant(*HoI4::technologies::Builder{}.Build()));
-}
-
-
-TEST(HoI4World_ShipTypes_MtgShipVariantTests, MissingRequiredTechMeansVariantIsInvalid)
-{
-	std::stringstream input;
-	input << " = {\n";
-	input << "\trequired_techs = {\n";
-	input << "\t\trequired_tech1\n";
-	input << "\t}\n";
-	input << "}";
-	const HoI4::MtgShipVariant theMtgShipVariant(input);
-
-	ASSERT_FALSE(theMtgShipVariant.isValidVariant(*HoI4::technologies::Builder{}.Build()));
-}
-
-
-TEST(HoI4World_ShipTypes_MtgShipVariantTests, HavingRequiredTechsMeansVariantIsValid)
-{
-	std::stringstream input;
-	input << " = {\n";
-	input << "\trequired_techs = {\n";
-	input << "\t\trequired_tech1\n";
-	input << "\t}\n";
-	input << "}";
-	const HoI4::MtgShipVariant theMtgShipVariant(input);
-
-	ASSERT_TRUE(
-		 theMtgShipVariant.isValidVariant(*HoI4::technologies::Builder{}.addTechnology("required_tech1").Build()));
-}
-
-
-TEST(HoI4World_ShipTypes_MtgShipVariantTests, HavingOnlySomeRequiredTechsMeansVariantIsInvalid)
-{
-	std::stringstream input;
-	input << " = {\n";
-	input << "\trequired_techs = {\n";
-	input << "\t\trequired_tech1\n";
-	input << "\t\trequired_tech2\n";
-	input << "\t}\n";
-	input << "}";
-	const HoI4::MtgShipVariant theMtgShipVariant(input);
-
-	ASSERT_FALSE(
-		 theMtgShipVariant.isValidVariant(*HoI4::technologies::Builder{}.addTechnology("required_tech1").Build()));
-}
-
-
-TEST(HoI4World_ShipTypes_MtgShipVariantTests, HavingBlockingTechsMeansVariantIsInvalid)
-{
-	std::stringstream input;
-	input << " = {\n";
-	input << "\tblocking_techs = {\n";
-	input << "\t\trequired_tech1\n";
-	input << "\t}\n";
-	input << "}";
-	const HoI4::MtgShipVariant theMtgShipVariant(input);
-
-	ASSERT_FALSE(
-		 theMtgShipVariant.isValidVariant(*HoI4::technologies::Builder{}.addTechnology("required_tech1").Build()));
-}
-
-
-TEST(HoI4World_ShipTypes_MtgShipVariantTests, HavingNoBlockingTechsMeansVariantIsValid)
-{
-	std::stringstream input;
-	input << " = {\n";
-	input << "\tblocking_techs = {\n";
-	input << "\t\trequired_tech1\n";
-	input << "\t}\n";
-	input << "}";
-	const HoI4::MtgShipVariant theMtgShipVariant(input);
-
-	ASSERT_TRUE(theMtgShipVariant.isValidVariant(*HoI4::technologies::Builder{}.Build()));
 }
\ No newline at end of file
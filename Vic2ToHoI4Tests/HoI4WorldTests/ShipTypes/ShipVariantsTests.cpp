@@ -460,4 +460,62 @@ TEST(HoI4World_ShipTypes_shipVariantsTests, LegacyVariantsCanBeBlocked)
 	expectedOutput << "\tlimit = { has_dlc = \"Man the Guns\" }\n";
 	expectedOutput << "}\n";
 	ASSERT_EQ(expectedOutput.str(), output.str());
-}
\ No newline at end of file
+}
+
+
+TEST(HoI4World_ShipTypes_shipVariantsTests, CountriesShareVariantsWithTheirOwnNameGroups)
+{
+	std::stringstream input;
+	input << "mtg_ship_type = {\n";
+	input << "\tname = \"Early submarine\"\n";
+	input << "\ttype = ship_hull_submarine_1\n";
+	input << "\tname_group = SS_HISTORICAL\n";
+	input << "}\n";
+	HoI4::PossibleShipVariants possibleVariants(input);
+
+	const HoI4::ShipVariants firstVariants(possibleVariants, *HoI4::technologies::Builder{}.Build(), "ONE");
+	const HoI4::ShipVariants secondVariants(possibleVariants, *HoI4::technologies::Builder{}.Build(), "TWO");
+
+	std::stringstream firstOutput;
+	firstOutput << firstVariants;
+	std::stringstream secondOutput;
+	secondOutput << secondVariants;
+
+	EXPECT_NE(firstOutput.str().find("name_group = ONE_SS_HISTORICAL"), std::string::npos);
+	EXPECT_NE(secondOutput.str().find("name_group = TWO_SS_HISTORICAL"), std::string::npos);
+}
+
+
+TEST(HoI4World_ShipTypes_shipVariantsTests, FirstValidMtgVariantOfANameIsUsed)
+{
+	std::stringstream input;
+	input << "mtg_ship_type = {\n";
+	input << "\trequired_techs = {\n";
+	input << "\t\ttech1\n";
+	input << "\t}\n";
+	input << "\tname = \"Early submarine\"\n";
+	input << "\ttype = ship_hull_submarine_1\n";
+	input << "\tname_group = SS_HISTORICAL\n";
+	input << "}\n";
+	input << "mtg_ship_type = {\n";
+	input << "\tname = \"Early submarine\"\n";
+	input << "\ttype = ship_hull_submarine_2\n";
+	input << "\tname_group = SS_HISTORICAL\n";
+	input << "}\n";
+	input << "mtg_ship_type = {\n";
+	input << "\tname = \"Early submarine\"\n";
+	input << "\ttype = ship_hull_submarine_3\n";
+	input << "\tname_group = SS_HISTORICAL\n";
+	input << "}\n";
+	HoI4::PossibleShipVariants possibleVariants(input);
+
+	const HoI4::ShipVariants theVariants(possibleVariants, *HoI4::technologies::Builder{}.Build(), "TAG");
+
+	std::stringstream output;
+	output << theVariants;
+
+	EXPECT_TRUE(theVariants.hasMtgVariant("Early submarine"));
+	EXPECT_EQ(output.str().find("ship_hull_submarine_1"), std::string::npos);
+	EXPECT_NE(output.str().find("ship_hull_submarine_2"), std::string::npos);
+	EXPECT_EQ(output.str().find("ship_hull_submarine_3"), std::string::npos);
+}
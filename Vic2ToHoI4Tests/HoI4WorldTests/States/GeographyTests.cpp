@@ -0,0 +1,107 @@
+#include "HOI4World/States/Geography.h"
+#include "HOI4World/States/HoI4StateBuilder.h"
+#include "gtest/gtest.h"
+#include "gmock/gmock-matchers.h"
+
+
+
+namespace
+{
+
+std::map<int, HoI4::State> makeStates()
+{
+	std::map<int, HoI4::State> states;
+	states.emplace(1, *HoI4::State::Builder().setId(1).setOwner("TAG").addCore("TAG").setProvinces({10, 11}).Build());
+	states.emplace(3,
+		 *HoI4::State::Builder().setId(3).setOwner("TWO").addCore("TAG").addCore("TWO").setProvinces({30}).Build());
+	states.emplace(4, *HoI4::State::Builder().setId(4).setOwner("TAG").setProvinces({40}).Build());
+	states.emplace(5, *HoI4::State::Builder().setId(5).setProvinces({50}).Build());
+	return states;
+}
+
+
+const std::map<int, int> provinceToStateIdMap{{10, 1}, {11, 1}, {30, 3}, {40, 4}, {50, 5}};
+
+} // namespace
+
+
+
+TEST(HoI4World_States_GeographyTests, ProvincesMapToTheirStates)
+{
+	const HoI4::Geography geography(makeStates(), provinceToStateIdMap);
+
+	EXPECT_EQ(1, geography.getStateOfProvince(10));
+	EXPECT_EQ(1, geography.getStateOfProvince(11));
+	EXPECT_EQ(3, geography.getStateOfProvince(30));
+	EXPECT_EQ(5, geography.getStateOfProvince(50));
+}
+
+
+TEST(HoI4World_States_GeographyTests, UnknownProvincesHaveNoState)
+{
+	const HoI4::Geography geography(makeStates(), provinceToStateIdMap);
+
+	EXPECT_EQ(std::nullopt, geography.getStateOfProvince(-1));
+	EXPECT_EQ(std::nullopt, geography.getStateOfProvince(0));
+	EXPECT_EQ(std::nullopt, geography.getStateOfProvince(20));
+	EXPECT_EQ(std::nullopt, geography.getStateOfProvince(51));
+}
+
+
+TEST(HoI4World_States_GeographyTests, StatesMapToTheirOwners)
+{
+	const HoI4::Geography geography(makeStates(), provinceToStateIdMap);
+
+	EXPECT_EQ("TAG", geography.getOwnerOfState(1));
+	EXPECT_EQ("TWO", geography.getOwnerOfState(3));
+	EXPECT_EQ(std::nullopt, geography.getOwnerOfState(2));
+	EXPECT_EQ(std::nullopt, geography.getOwnerOfState(5));
+	EXPECT_EQ(std::nullopt, geography.getOwnerOfState(6));
+}
+
+
+TEST(HoI4World_States_GeographyTests, ProvincesMapToTheOwnersOfTheirStates)
+{
+	const HoI4::Geography geography(makeStates(), provinceToStateIdMap);
+
+	EXPECT_EQ("TAG", geography.getOwnerOfProvince(11));
+	EXPECT_EQ("TWO", geography.getOwnerOfProvince(30));
+	EXPECT_EQ(std::nullopt, geography.getOwnerOfProvince(50));
+	EXPECT_EQ(std::nullopt, geography.getOwnerOfProvince(60));
+}
+
+
+TEST(HoI4World_States_GeographyTests, StatesKnowHowManyProvincesTheyHave)
+{
+	const HoI4::Geography geography(makeStates(), provinceToStateIdMap);
+
+	EXPECT_EQ(2, geography.getNumProvincesInState(1));
+	EXPECT_EQ(1, geography.getNumProvincesInState(3));
+	EXPECT_EQ(0, geography.getNumProvincesInState(2));
+	EXPECT_EQ(0, geography.getNumProvincesInState(6));
+	EXPECT_EQ(0, geography.getNumProvincesInState(-1));
+}
+
+
+TEST(HoI4World_States_GeographyTests, OwnedAndCoredStatesAreListedInOrder)
+{
+	const HoI4::Geography geography(makeStates(), provinceToStateIdMap);
+
+	EXPECT_THAT(geography.getOwnedStates("TAG"), testing::ElementsAre(1, 4));
+	EXPECT_THAT(geography.getOwnedStates("TWO"), testing::ElementsAre(3));
+	EXPECT_THAT(geography.getCoredStates("TAG"), testing::ElementsAre(1, 3));
+	EXPECT_THAT(geography.getCoredStates("TWO"), testing::ElementsAre(3));
+	EXPECT_TRUE(geography.getOwnedStates("NON").empty());
+	EXPECT_TRUE(geography.getCoredStates("NON").empty());
+}
+
+
+TEST(HoI4World_States_GeographyTests, EmptyInputsGiveNoAnswers)
+{
+	const HoI4::Geography geography({}, {});
+
+	EXPECT_EQ(std::nullopt, geography.getStateOfProvince(1));
+	EXPECT_EQ(std::nullopt, geography.getOwnerOfState(1));
+	EXPECT_TRUE(geography.getOwnedStates("TAG").empty());
+	EXPECT_TRUE(geography.getCoredStates("TAG").empty());
+}
@@ -273,9 +273,11 @@ TEST(HoI4World_States_StateTests, TotalFactoriesCanBeSet)
 	theState.addCores({"TAG"});
 
 	const HoI4::CoastalProvinces theCoastalProvinces;
+	HoI4::State::FactoryRemainders remainders;
 	theState.convertIndustry(0.0001,
 		 *HoI4::StateCategories::Builder{}.addCategory(8, "mockedCategory").Build(),
-		 theCoastalProvinces);
+		 theCoastalProvinces,
+		 remainders);
 
 	ASSERT_EQ(6, theState.getMilFactories() + theState.getCivFactories() + theState.getDockyards());
 }
@@ -293,9 +295,11 @@ TEST(HoI4World_States_StateTests, TotalFactoriesHalvedByMissingCore)
 
 	HoI4::State theState(sourceState, 42, "TAG");
 
+	HoI4::State::FactoryRemainders remainders;
 	theState.convertIndustry(0.0001,
 		 *HoI4::StateCategories::Builder{}.addCategory(8, "mockedCategory").Build(),
-		 *HoI4::CoastalProvinces::Builder{}.Build());
+		 *HoI4::CoastalProvinces::Builder{}.Build(),
+		 remainders);
 
 	ASSERT_EQ(3, theState.getMilFactories() + theState.getCivFactories() + theState.getDockyards());
 }
@@ -314,14 +318,48 @@ TEST(HoI4World_States_StateTests, TotalFactoriesCappedAtTwelve)
 	HoI4::State theState(sourceState, 42, "TAG");
 	theState.addCores({"TAG"});
 
+	HoI4::State::FactoryRemainders remainders;
 	theState.convertIndustry(0.0001,
 		 *HoI4::StateCategories::Builder{}.addCategory(14, "mockedCategory").Build(),
-		 *HoI4::CoastalProvinces::Builder{}.Build());
+		 *HoI4::CoastalProvinces::Builder{}.Build(),
+		 remainders);
 
 	ASSERT_EQ(12, theState.getMilFactories() + theState.getCivFactories() + theState.getDockyards());
 }
 
 
+TEST(HoI4World_States_StateTests, FactorySplitDoesNotDependOnEarlierConversions)
+{
+	const auto sourceState = *Vic2::State::Builder{}
+											.setEmployedWorkers(60000)
+											.setProvinces({Vic2::Province::Builder{}
+																	 .setNumber(0)
+																	 .setPops({*Vic2::Pop::Builder{}.setSize(70000).build()})
+																	 .build()})
+											.build();
+	const auto stateCategories = HoI4::StateCategories::Builder{}.addCategory(8, "mockedCategory").Build();
+	const HoI4::CoastalProvinces theCoastalProvinces;
+
+	const auto convertCountry = [&sourceState, &stateCategories, &theCoastalProvinces]() {
+		std::vector<std::pair<int, int>> factories;
+		HoI4::State::FactoryRemainders remainders;
+		for (auto stateId = 1; stateId <= 3; ++stateId)
+		{
+			HoI4::State theState(sourceState, stateId, "TAG");
+			theState.addCores({"TAG"});
+			theState.convertIndustry(0.0001, *stateCategories, theCoastalProvinces, remainders);
+			factories.emplace_back(theState.getMilFactories(), theState.getCivFactories());
+		}
+		return factories;
+	};
+
+	const auto firstConversion = convertCountry();
+	const auto secondConversion = convertCountry();
+
+	ASSERT_EQ(firstConversion, secondConversion);
+}
+
+
 TEST(HoI4World_States_StateTests, categoryCanBeChanged)
 {
 	const auto sourceState = *Vic2::State::Builder{}
@@ -334,9 +372,11 @@ TEST(HoI4World_States_StateTests, categoryCanBeChanged)
 											.build();
 	HoI4::State theState(sourceState, 42, "TAG");
 
+	HoI4::State::FactoryRemainders remainders;
 	theState.convertIndustry(0.0001,
 		 *HoI4::StateCategories::Builder{}.addCategory(14, "mockedCategory").Build(),
-		 *HoI4::CoastalProvinces::Builder{}.Build());
+		 *HoI4::CoastalProvinces::Builder{}.Build(),
+		 remainders);
 
 	ASSERT_EQ("mockedCategory", theState.getCategory());
 }
@@ -358,9 +398,11 @@ TEST(HoI4World_States_StateTests, InfrastructureAddedPerTwoRailLevels)
 
 	HoI4::State theState(sourceState, 42, "TAG");
 
+	HoI4::State::FactoryRemainders remainders;
 	theState.convertIndustry(0.0001,
 		 *HoI4::StateCategories::Builder{}.addCategory(2, "mockedCategory").Build(),
-		 *HoI4::CoastalProvinces::Builder{}.Build());
+		 *HoI4::CoastalProvinces::Builder{}.Build(),
+		 remainders);
 
 	ASSERT_EQ(6, theState.getInfrastructure());
 }
@@ -379,9 +421,11 @@ TEST(HoI4World_States_StateTests, InfrastructureForOverFourFactories)
 
 	HoI4::State theState(sourceState, 42, "TAG");
 
+	HoI4::State::FactoryRemainders remainders;
 	theState.convertIndustry(0.0001,
 		 *HoI4::StateCategories::Builder{}.addCategory(7, "mockedCategory").Build(),
-		 *HoI4::CoastalProvinces::Builder{}.Build());
+		 *HoI4::CoastalProvinces::Builder{}.Build(),
+		 remainders);
 
 	ASSERT_EQ(7, theState.getInfrastructure());
 }
@@ -400,9 +444,11 @@ TEST(HoI4World_States_StateTests, InfrastructureForOverSixFactories)
 
 	HoI4::State theState(sourceState, 42, "TAG");
 
+	HoI4::State::FactoryRemainders remainders;
 	theState.convertIndustry(0.0001,
 		 *HoI4::StateCategories::Builder{}.addCategory(9, "mockedCategory").Build(),
-		 *HoI4::CoastalProvinces::Builder{}.Build());
+		 *HoI4::CoastalProvinces::Builder{}.Build(),
+		 remainders);
 
 	ASSERT_EQ(8, theState.getInfrastructure());
 }
@@ -421,9 +467,11 @@ TEST(HoI4World_States_StateTests, InfrastructureForOverTenFactories)
 
 	HoI4::State theState(sourceState, 42, "TAG");
 
+	HoI4::State::FactoryRemainders remainders;
 	theState.convertIndustry(0.0001,
 		 *HoI4::StateCategories::Builder{}.addCategory(13, "mockedCategory").Build(),
-		 *HoI4::CoastalProvinces::Builder{}.Build());
+		 *HoI4::CoastalProvinces::Builder{}.Build(),
+		 remainders);
 
 	ASSERT_EQ(9, theState.getInfrastructure());
 }
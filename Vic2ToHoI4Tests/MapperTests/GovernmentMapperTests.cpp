@@ -0,0 +1,111 @@
+#include "Mappers/GovernmentMapper.h"
+#include "Mappers/GovernmentMapperBuilder.h"
+#include "gtest/gtest.h"
+
+
+
+TEST(Mappers_GovernmentMapperTests, NoMappingsGiveNeutrality)
+{
+	const auto theMapper = governmentMapper::Builder{}.Build();
+
+	ASSERT_EQ("neutrality", theMapper->getIdeologyForCountry("TAG", "absolute_monarchy", "conservative", false));
+	ASSERT_EQ("neutrality", theMapper->getLeaderIdeologyForCountry("TAG", "absolute_monarchy", "conservative", false));
+}
+
+
+TEST(Mappers_GovernmentMapperTests, FirstMatchingMappingIsUsed)
+{
+	const auto theMapper = governmentMapper::Builder{}
+										.addGovernmentMapping({"absolute_monarchy", "", "absolutist", "absolute_leader", ""})
+										.addGovernmentMapping({"absolute_monarchy", "", "neutrality", "second_leader", ""})
+										.Build();
+
+	ASSERT_EQ("absolutist", theMapper->getIdeologyForCountry("TAG", "absolute_monarchy", "conservative", false));
+	ASSERT_EQ("absolute_leader",
+		 theMapper->getLeaderIdeologyForCountry("TAG", "absolute_monarchy", "conservative", false));
+}
+
+
+TEST(Mappers_GovernmentMapperTests, EarlierWildcardMappingBeatsLaterSpecificMapping)
+{
+	const auto theMapper = governmentMapper::Builder{}
+										.addGovernmentMapping({"", "", "wildcard", "wildcard_leader", "socialist"})
+										.addGovernmentMapping({"democracy", "", "democratic", "liberalism", "socialist"})
+										.Build();
+
+	ASSERT_EQ("wildcard", theMapper->getIdeologyForCountry("TAG", "democracy", "socialist", false));
+}
+
+
+TEST(Mappers_GovernmentMapperTests, UnknownGovernmentAndIdeologyUseWildcardMappings)
+{
+	const auto theMapper = governmentMapper::Builder{}
+										.addGovernmentMapping({"democracy", "", "democratic", "liberalism", ""})
+										.addGovernmentMapping({"", "", "fallback", "fallback_leader", ""})
+										.Build();
+
+	ASSERT_EQ("fallback", theMapper->getIdeologyForCountry("TAG", "unknown_government", "unknown_ideology", false));
+	ASSERT_EQ("democratic", theMapper->getIdeologyForCountry("TAG", "democracy", "unknown_ideology", false));
+}
+
+
+TEST(Mappers_GovernmentMapperTests, TagRequirementIsChecked)
+{
+	const auto theMapper = governmentMapper::Builder{}
+										.addGovernmentMapping({"democracy", "ENG", "democratic", "liberalism", ""})
+										.addGovernmentMapping({"democracy", "", "neutrality", "conservatism", ""})
+										.Build();
+
+	ASSERT_EQ("democratic", theMapper->getIdeologyForCountry("ENG", "democracy", "liberal", false));
+	ASSERT_EQ("neutrality", theMapper->getIdeologyForCountry("FRA", "democracy", "liberal", false));
+}
+
+
+TEST(Mappers_GovernmentMapperTests, IndexedLookupsMatchLinearScan)
+{
+	const std::vector<governmentMapping> mappings{
+		 {"democracy", "ENG", "eng_democracy", "eng_democracy_leader", "liberal"},
+		 {"democracy", "", "democracy_liberal", "democracy_liberal_leader", "liberal"},
+		 {"", "", "any_socialist", "any_socialist_leader", "socialist"},
+		 {"democracy", "", "democracy_any", "democracy_any_leader", ""},
+		 {"absolute_monarchy", "FRA", "fra_monarchy", "fra_monarchy_leader", ""},
+		 {"absolute_monarchy", "", "monarchy_conservative", "monarchy_conservative_leader", "conservative"},
+		 {"", "FRA", "fra_any", "fra_any_leader", ""},
+		 {"", "", "fallback", "fallback_leader", ""},
+	};
+
+	governmentMapper::Builder builder;
+	for (const auto& mapping: mappings)
+	{
+		builder.addGovernmentMapping(mapping);
+	}
+	const auto theMapper = builder.Build();
+
+	const auto linearScan = [&mappings](const std::string& tag,
+										const std::string& government,
+										const std::string& rulingIdeology) -> std::string {
+		for (const auto& mapping: mappings)
+		{
+			if ((mapping.vic2Government.empty() || mapping.vic2Government == government) &&
+				 (mapping.rulingPartyRequired.empty() || mapping.rulingPartyRequired == rulingIdeology) &&
+				 (mapping.tagRequired.empty() || mapping.tagRequired == tag))
+			{
+				return mapping.HoI4GovernmentIdeology;
+			}
+		}
+		return "neutrality";
+	};
+
+	for (const auto& tag: {"ENG", "FRA", "GER"})
+	{
+		for (const auto& government: {"democracy", "absolute_monarchy", "hms_government", ""})
+		{
+			for (const auto& rulingIdeology: {"liberal", "socialist", "conservative", "reactionary", ""})
+			{
+				ASSERT_EQ(linearScan(tag, government, rulingIdeology),
+					 theMapper->getIdeologyForCountry(tag, government, rulingIdeology, false))
+					 << tag << " " << government << " " << rulingIdeology;
+			}
+		}
+	}
+}
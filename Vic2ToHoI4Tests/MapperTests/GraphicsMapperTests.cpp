@@ -0,0 +1,69 @@
+#include "Mappers/GraphicsMappedBuilder.h"
+#include "Mappers/GraphicsMapper.h"
+#include "gtest/gtest.h"
+
+
+
+namespace
+{
+
+const std::vector<std::string> portraits{"portrait_1.dds",
+	 "portrait_2.dds",
+	 "portrait_3.dds",
+	 "portrait_4.dds",
+	 "portrait_5.dds",
+	 "portrait_6.dds",
+	 "portrait_7.dds",
+	 "portrait_8.dds"};
+
+} // namespace
+
+
+
+TEST(Mappers_GraphicsMapperTests, MissingLeaderPortraitsGiveUnknownLeader)
+{
+	const auto theMapper = graphicsMapper::Builder{}.Build();
+
+	ASSERT_EQ("gfx/leaders/leader_unknown.dds", theMapper->getLeaderPortrait("group", "fascism", "TAG"));
+}
+
+
+TEST(Mappers_GraphicsMapperTests, MissingMinisterPortraitsGiveUnknownIdea)
+{
+	const auto theMapper = graphicsMapper::Builder{}.Build();
+
+	ASSERT_EQ("gfx/interface/ideas/idea_unknown.dds",
+		 theMapper->getIdeologyMinisterPortrait("group", "fascism", "TAG"));
+}
+
+
+TEST(Mappers_GraphicsMapperTests, LeaderPortraitsDoNotDependOnCountryOrder)
+{
+	const auto forwardMapper = graphicsMapper::Builder{}.addLeaderPortraits("group", "fascism", portraits).Build();
+	const auto firstInForwardOrder = forwardMapper->getLeaderPortrait("group", "fascism", "ONE");
+	const auto secondInForwardOrder = forwardMapper->getLeaderPortrait("group", "fascism", "TWO");
+
+	const auto reverseMapper = graphicsMapper::Builder{}.addLeaderPortraits("group", "fascism", portraits).Build();
+	const auto secondInReverseOrder = reverseMapper->getLeaderPortrait("group", "fascism", "TWO");
+	const auto firstInReverseOrder = reverseMapper->getLeaderPortrait("group", "fascism", "ONE");
+
+	ASSERT_EQ(firstInForwardOrder, firstInReverseOrder);
+	ASSERT_EQ(secondInForwardOrder, secondInReverseOrder);
+}
+
+
+TEST(Mappers_GraphicsMapperTests, MinisterPortraitsDoNotDependOnCountryOrder)
+{
+	const auto forwardMapper =
+		 graphicsMapper::Builder{}.addIdeologyMinisterPortraits("group", "fascism", portraits).Build();
+	const auto firstInForwardOrder = forwardMapper->getIdeologyMinisterPortrait("group", "fascism", "ONE");
+	const auto secondInForwardOrder = forwardMapper->getIdeologyMinisterPortrait("group", "fascism", "TWO");
+
+	const auto reverseMapper =
+		 graphicsMapper::Builder{}.addIdeologyMinisterPortraits("group", "fascism", portraits).Build();
+	const auto secondInReverseOrder = reverseMapper->getIdeologyMinisterPortrait("group", "fascism", "TWO");
+	const auto firstInReverseOrder = reverseMapper->getIdeologyMinisterPortrait("group", "fascism", "ONE");
+
+	ASSERT_EQ(firstInForwardOrder, firstInReverseOrder);
+	ASSERT_EQ(secondInForwardOrder, secondInReverseOrder);
+}
\ No newline at end of file
@@ -0,0 +1,47 @@
+#include "Mappers/Provinces/DenseProvinceMapping.h"
+#include "gmock/gmock-matchers.h"
+#include "gtest/gtest.h"
+
+
+
+TEST(Mappers_Provinces_DenseProvinceMappingTests, MappingDefaultsToEmpty)
+{
+	const Mappers::DenseProvinceMapping mapping;
+
+	ASSERT_TRUE(mapping.getProvinces(1).empty());
+	ASSERT_FALSE(mapping.contains(1));
+}
+
+
+TEST(Mappers_Provinces_DenseProvinceMappingTests, ProvincesCanBeMapped)
+{
+	const Mappers::DenseProvinceMapping mapping({{1, {10, 11}}, {4, {40}}, {2, {20}}});
+
+	ASSERT_THAT(mapping.getProvinces(1), testing::ElementsAre(10, 11));
+	ASSERT_THAT(mapping.getProvinces(2), testing::ElementsAre(20));
+	ASSERT_THAT(mapping.getProvinces(4), testing::ElementsAre(40));
+}
+
+
+TEST(Mappers_Provinces_DenseProvinceMappingTests, UnmappedProvincesAreEmpty)
+{
+	const Mappers::DenseProvinceMapping mapping({{1, {10, 11}}, {4, {40}}});
+
+	ASSERT_TRUE(mapping.getProvinces(0).empty());
+	ASSERT_TRUE(mapping.getProvinces(3).empty());
+	ASSERT_TRUE(mapping.getProvinces(5).empty());
+	ASSERT_TRUE(mapping.getProvinces(-1).empty());
+	ASSERT_FALSE(mapping.contains(3));
+	ASSERT_FALSE(mapping.contains(5));
+	ASSERT_FALSE(mapping.contains(-1));
+}
+
+
+TEST(Mappers_Provinces_DenseProvinceMappingTests, ProvincesMappedToNothingAreContained)
+{
+	const Mappers::DenseProvinceMapping mapping({{1, {}}, {2, {20}}});
+
+	ASSERT_TRUE(mapping.contains(1));
+	ASSERT_TRUE(mapping.getProvinces(1).empty());
+	ASSERT_TRUE(mapping.contains(2));
+}
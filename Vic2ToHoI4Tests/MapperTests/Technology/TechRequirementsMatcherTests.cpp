@@ -0,0 +1,51 @@
+#include "Mappers/Technology/TechRequirementsMatcher.h"
+#include "gmock/gmock-matchers.h"
+#include "gtest/gtest.h"
+#include <string>
+
+
+
+TEST(Mappers_Technology_TechRequirementsMatcherTests, NoMappingsGiveNoMatches)
+{
+	const Mappers::TechRequirementsMatcher matcher;
+
+	ASSERT_TRUE(matcher.getMatchingMappings({"tech"}).empty());
+}
+
+
+TEST(Mappers_Technology_TechRequirementsMatcherTests, MappingWithoutRequirementsAlwaysMatches)
+{
+	Mappers::TechRequirementsMatcher matcher;
+	matcher.addMapping({});
+
+	ASSERT_THAT(matcher.getMatchingMappings({}), testing::ElementsAre(0));
+}
+
+
+TEST(Mappers_Technology_TechRequirementsMatcherTests, MappingsMatchOnlyWhenAllRequirementsAreHeld)
+{
+	Mappers::TechRequirementsMatcher matcher;
+	matcher.addMapping({"tech1"});
+	matcher.addMapping({"tech1", "invention1"});
+	matcher.addMapping({"tech2"});
+
+	ASSERT_THAT(matcher.getMatchingMappings({"tech1", "unmapped_tech"}), testing::ElementsAre(0));
+	ASSERT_THAT(matcher.getMatchingMappings({"tech1", "invention1", "tech2"}), testing::ElementsAre(0, 1, 2));
+	ASSERT_THAT(matcher.getMatchingMappings({"invention1", "tech2"}), testing::ElementsAre(2));
+}
+
+
+TEST(Mappers_Technology_TechRequirementsMatcherTests, RequirementsBeyondOneWordAreMatched)
+{
+	Mappers::TechRequirementsMatcher matcher;
+	std::set<std::string> allTechs;
+	for (auto i = 0; i < 200; ++i)
+	{
+		allTechs.insert("tech" + std::to_string(i));
+		matcher.addMapping({"tech" + std::to_string(i)});
+	}
+	matcher.addMapping({"tech0", "tech199"});
+
+	ASSERT_THAT(matcher.getMatchingMappings({"tech0", "tech199"}), testing::ElementsAre(0, 199, 200));
+	ASSERT_EQ(201, matcher.getMatchingMappings(allTechs).size());
+}
@@ -0,0 +1,246 @@
+#include "OutHoi4/OutputSink.h"
+#include "gmock/gmock-matchers.h"
+#include "gtest/gtest.h"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+
+
+namespace
+{
+
+std::optional<std::string> readFile(const std::string& path)
+{
+	std::ifstream file(path);
+	if (!file.is_open())
+	{
+		return std::nullopt;
+	}
+	std::stringstream contents;
+	contents << file.rdbuf();
+	return contents.str();
+}
+
+
+// the sink copies base files instead of linking them where the file system has no hard links
+bool hardLinksAreSupported()
+{
+	std::filesystem::create_directories("OutputSink/linkProbe");
+	std::ofstream("OutputSink/linkProbe/source.txt").close();
+	std::filesystem::remove("OutputSink/linkProbe/link.txt");
+
+	std::error_code error;
+	std::filesystem::create_hard_link("OutputSink/linkProbe/source.txt", "OutputSink/linkProbe/link.txt", error);
+	return !error;
+}
+
+} // namespace
+
+
+
+TEST(OutHoi4_OutputSinkTests, OutputFileIsNotOpenUntilGivenAPath)
+{
+	HoI4::OutputFile file;
+	ASSERT_FALSE(file.is_open());
+
+	HoI4::MemorySink sink("output/mod", "blankMod/output");
+	const HoI4::OutputSinkScope scope(sink);
+	file.open("output/mod/file.txt");
+	ASSERT_TRUE(file.is_open());
+	file.close();
+	ASSERT_FALSE(file.is_open());
+}
+
+
+TEST(OutHoi4_OutputSinkTests, OutputFileReachesTheActiveSinkWhenClosed)
+{
+	HoI4::MemorySink sink("output/mod", "blankMod/output");
+	const HoI4::OutputSinkScope scope(sink);
+
+	HoI4::OutputFile file("output/mod/file.txt");
+	file << "text " << 42;
+	ASSERT_EQ(std::nullopt, sink.getFile("output/mod/file.txt"));
+
+	file.close();
+	ASSERT_EQ("text 42", sink.getFile("output/mod/file.txt"));
+}
+
+
+TEST(OutHoi4_OutputSinkTests, OutputFileReachesTheActiveSinkWhenDestroyed)
+{
+	HoI4::MemorySink sink("output/mod", "blankMod/output");
+	const HoI4::OutputSinkScope scope(sink);
+
+	{
+		HoI4::OutputFile file("output/mod/file.txt");
+		file << "text";
+	}
+
+	ASSERT_EQ("text", sink.getFile("output/mod/file.txt"));
+}
+
+
+TEST(OutHoi4_OutputSinkTests, OutputFileCanBeReopened)
+{
+	HoI4::MemorySink sink("output/mod", "blankMod/output");
+	const HoI4::OutputSinkScope scope(sink);
+
+	HoI4::OutputFile file("output/mod/first.txt");
+	file << "first";
+	file.close();
+	file.open("output/mod/second.txt");
+	file << "second";
+	file.close();
+
+	ASSERT_EQ("first", sink.getFile("output/mod/first.txt"));
+	ASSERT_EQ("second", sink.getFile("output/mod/second.txt"));
+}
+
+
+TEST(OutHoi4_OutputSinkTests, MovedOutputFileIsOnlyWrittenOnce)
+{
+	HoI4::MemorySink sink("output/mod", "blankMod/output");
+	const HoI4::OutputSinkScope scope(sink);
+
+	{
+		HoI4::OutputFile first("output/mod/file.txt", std::ios_base::app);
+		first << "text";
+		HoI4::OutputFile second(std::move(first));
+	}
+
+	ASSERT_EQ("text", sink.getFile("output/mod/file.txt"));
+}
+
+
+TEST(OutHoi4_OutputSinkTests, AppendsAreGatheredInOrder)
+{
+	HoI4::MemorySink sink("output/mod", "blankMod/output");
+	const HoI4::OutputSinkScope scope(sink);
+
+	HoI4::OutputFile("output/mod/appended.txt", std::ios_base::app) << "first ";
+	HoI4::OutputFile("output/mod/appended.txt", std::ios_base::app) << "second";
+	HoI4::OutputFile("output/mod/written.txt") << "first ";
+	HoI4::OutputFile("output/mod/written.txt", std::ios_base::app) << "second";
+
+	ASSERT_EQ("first second", sink.getFile("output/mod/appended.txt"));
+	ASSERT_TRUE(sink.getFiles().at("output/mod/appended.txt").continuesExistingFile);
+	ASSERT_EQ("first second", sink.getFile("output/mod/written.txt"));
+	ASSERT_FALSE(sink.getFiles().at("output/mod/written.txt").continuesExistingFile);
+}
+
+
+TEST(OutHoi4_OutputSinkTests, WritingReplacesEarlierText)
+{
+	HoI4::MemorySink sink("output/mod", "blankMod/output");
+	const HoI4::OutputSinkScope scope(sink);
+
+	HoI4::OutputFile("output/mod/file.txt", std::ios_base::app) << "first";
+	HoI4::OutputFile("output/mod/file.txt") << "second";
+
+	ASSERT_EQ("second", sink.getFile("output/mod/file.txt"));
+	ASSERT_FALSE(sink.getFiles().at("output/mod/file.txt").continuesExistingFile);
+}
+
+
+TEST(OutHoi4_OutputSinkTests, PathsAreNormalized)
+{
+	HoI4::MemorySink sink("output/mod", "blankMod/output");
+
+	sink.writeFile("output\\mod//folder/file.txt", "text");
+
+	ASSERT_EQ("text", sink.getFile("output/mod/folder/file.txt"));
+}
+
+
+TEST(OutHoi4_OutputSinkTests, BinaryFilesAreMarked)
+{
+	HoI4::MemorySink sink("output/mod", "blankMod/output");
+
+	sink.writeBinaryFile("output/mod/image.tga", std::string("\0\n\r", 3));
+	sink.writeFile("output/mod/text.txt", "text");
+
+	ASSERT_EQ(std::string("\0\n\r", 3), sink.getFile("output/mod/image.tga"));
+	ASSERT_TRUE(sink.getFiles().at("output/mod/image.tga").binary);
+	ASSERT_FALSE(sink.getFiles().at("output/mod/text.txt").binary);
+}
+
+
+TEST(OutHoi4_OutputSinkTests, ScopeRestoresThePreviousSink)
+{
+	HoI4::MemorySink outerSink("output/mod", "blankMod/output");
+	HoI4::MemorySink innerSink("output/mod", "blankMod/output");
+
+	const HoI4::OutputSinkScope outerScope(outerSink);
+	{
+		const HoI4::OutputSinkScope innerScope(innerSink);
+		ASSERT_EQ(&innerSink, &HoI4::getOutputSink());
+	}
+
+	ASSERT_EQ(&outerSink, &HoI4::getOutputSink());
+}
+
+
+TEST(OutHoi4_OutputSinkTests, DirectorySinkWritesStraightToDisk)
+{
+	HoI4::DirectorySink sink;
+
+	sink.writeFile("OutputSinkDirectory/folder/file.txt", "first\n");
+	sink.appendToFile("OutputSinkDirectory/folder/file.txt", "second\n");
+
+	ASSERT_EQ("first\nsecond\n", readFile("OutputSinkDirectory/folder/file.txt"));
+}
+
+
+TEST(OutHoi4_OutputSinkTests, CommitLaysFilesOverTheBaseFolder)
+{
+	HoI4::MemorySink sink("OutputSink/mod", "OutputSink/base");
+	sink.writeFile("OutputSink/mod/replaced.txt", "replacement\n");
+	sink.appendToFile("OutputSink/mod/sub/extended.txt", "second\n");
+	sink.writeFile("OutputSink/mod/new/deeper/file.txt", "new\n");
+	sink.writeFile("OutputSink/mod.mod", "descriptor\n");
+
+	sink.commit(2);
+
+	EXPECT_EQ("kept\n", readFile("OutputSink/mod/kept.txt"));
+	EXPECT_EQ("replacement\n", readFile("OutputSink/mod/replaced.txt"));
+	EXPECT_EQ("first\nsecond\n", readFile("OutputSink/mod/sub/extended.txt"));
+	EXPECT_EQ("new\n", readFile("OutputSink/mod/new/deeper/file.txt"));
+	EXPECT_EQ("descriptor\n", readFile("OutputSink/mod.mod"));
+	EXPECT_EQ("first\n", readFile("OutputSink/base/sub/extended.txt"));
+}
+
+
+TEST(OutHoi4_OutputSinkTests, CommitOnlyCopiesBaseFilesTheModContinues)
+{
+	HoI4::MemorySink sink("OutputSink/linkedMod", "OutputSink/base");
+	sink.appendToFile("OutputSink/linkedMod/sub/extended.txt", "second\n");
+	sink.commit(2);
+
+	HoI4::DirectorySink().appendToFile("OutputSink/linkedMod/sub/extended.txt", "third\n");
+
+	EXPECT_EQ("first\n", readFile("OutputSink/base/sub/extended.txt"));
+	EXPECT_EQ("first\nsecond\nthird\n", readFile("OutputSink/linkedMod/sub/extended.txt"));
+	EXPECT_EQ(1, std::filesystem::hard_link_count("OutputSink/linkedMod/sub/extended.txt"));
+	EXPECT_EQ("kept\n", readFile("OutputSink/linkedMod/kept.txt"));
+	if (hardLinksAreSupported())
+	{
+		EXPECT_LT(1, std::filesystem::hard_link_count("OutputSink/linkedMod/kept.txt"));
+	}
+}
+
+
+TEST(OutHoi4_OutputSinkTests, CommitReplacesEarlierMod)
+{
+	HoI4::DirectorySink().writeFile("OutputSink/replacedMod/stale.txt", "stale\n");
+
+	HoI4::MemorySink sink("OutputSink/replacedMod", "OutputSink/base");
+	sink.writeFile("OutputSink/replacedMod/fresh.txt", "fresh\n");
+	sink.commit(2);
+
+	EXPECT_EQ(std::nullopt, readFile("OutputSink/replacedMod/stale.txt"));
+	EXPECT_EQ("fresh\n", readFile("OutputSink/replacedMod/fresh.txt"));
+	EXPECT_EQ("kept\n", readFile("OutputSink/replacedMod/kept.txt"));
+	EXPECT_EQ(std::nullopt, readFile("OutputSink/replacedMod-replaced/stale.txt"));
+	EXPECT_EQ(std::nullopt, readFile("OutputSink/replacedMod-incomplete/fresh.txt"));
+}
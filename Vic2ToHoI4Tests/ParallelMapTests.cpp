@@ -0,0 +1,74 @@
+#include "ParallelMap.h"
+#include "gmock/gmock-matchers.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <atomic>
+#include <string>
+
+
+
+TEST(ParallelMapTests, NoInputsGiveNoResults)
+{
+	const std::vector<int> inputs;
+
+	const auto results = parallelMap(inputs, [](const int& input) {
+		return input;
+	});
+
+	ASSERT_TRUE(results.empty());
+}
+
+
+TEST(ParallelMapTests, ResultsAreInInputOrder)
+{
+	const std::vector<int> inputs{1, 2, 3, 4, 5};
+
+	const auto results = parallelMap(
+		 inputs,
+		 [](const int& input) {
+			 return std::to_string(input * 2);
+		 },
+		 4);
+
+	ASSERT_THAT(results, testing::ElementsAre("2", "4", "6", "8", "10"));
+}
+
+
+TEST(ParallelMapTests, ResultsDoNotDependOnThreadCount)
+{
+	std::vector<int> inputs;
+	for (auto i = 0; i < 1000; ++i)
+	{
+		inputs.push_back(i);
+	}
+	const auto function = [](const int& input) {
+		return input * input;
+	};
+
+	const auto serialResults = parallelMap(inputs, function, 1);
+	const auto parallelResults = parallelMap(inputs, function, 8);
+
+	ASSERT_EQ(serialResults, parallelResults);
+}
+
+
+TEST(ParallelMapTests, ForEachVisitsEveryInputOnce)
+{
+	std::vector<int> inputs;
+	for (auto i = 0; i < 1000; ++i)
+	{
+		inputs.push_back(i);
+	}
+
+	std::vector<std::atomic<int>> visits(inputs.size());
+	parallelForEach(
+		 inputs,
+		 [&visits](const int& input) {
+			 ++visits[input];
+		 },
+		 8);
+
+	ASSERT_TRUE(std::ranges::all_of(visits, [](const std::atomic<int>& visitCount) {
+		return visitCount == 1;
+	}));
+}
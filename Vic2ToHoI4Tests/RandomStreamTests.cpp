@@ -0,0 +1,44 @@
+#include "RandomStream.h"
+#include "gtest/gtest.h"
+
+
+
+TEST(RandomStreamTests, SameKeyAndPurposeGiveSameSequence)
+{
+	RandomStream first{"TAG", "purpose"};
+	RandomStream second{"TAG", "purpose"};
+
+	for (auto i = 0; i < 10; ++i)
+	{
+		ASSERT_EQ(first.next(), second.next());
+	}
+}
+
+
+TEST(RandomStreamTests, DifferentPurposesGiveDifferentSequences)
+{
+	RandomStream first{"TAG", "purpose"};
+	RandomStream second{"TAG", "other_purpose"};
+
+	ASSERT_NE(first.next(), second.next());
+}
+
+
+TEST(RandomStreamTests, KeyAndPurposeAreNotConcatenated)
+{
+	RandomStream first{"TA", "Gpurpose"};
+	RandomStream second{"TAG", "purpose"};
+
+	ASSERT_NE(first.next(), second.next());
+}
+
+
+TEST(RandomStreamTests, PickStaysWithinSize)
+{
+	RandomStream stream{"TAG", "purpose"};
+
+	for (auto i = 0; i < 1000; ++i)
+	{
+		ASSERT_LT(stream.pick(7), 7);
+	}
+}
@@ -2644,6 +2644,55 @@ TEST(Vic2World_Countries_CountryTests, EatCountryHasNoEffectOnSelf)
 }
 
 
+TEST(Vic2World_Countries_CountryTests, MergeStatesCombinesPartialStatesIntoFirstInOrder)
+{
+	const auto stateDefinitions =
+		 Vic2::StateDefinitions::Builder{}
+			  .setProvinceToIDMap({{1, "MERGE_STATE"}, {2, "MERGE_STATE"}, {3, "MERGE_STATE"}, {42, "UNMERGED_STATE"}})
+			  .setStateMap({{1, {1, 2, 3}}, {2, {1, 2, 3}}, {3, {1, 2, 3}}, {42, {42}}})
+			  .build();
+
+	std::stringstream theStream;
+	theStream << "= {\n";
+	theStream << "\truling_party = 1\n";
+	theStream << "\tstate=\n";
+	theStream << "\t{\n";
+	theStream << "\t\tprovinces = { 1 }\n";
+	theStream << "\t}\n";
+	theStream << "\tstate=\n";
+	theStream << "\t{\n";
+	theStream << "\t\tprovinces = { 42 }\n";
+	theStream << "\t}\n";
+	theStream << "\tstate=\n";
+	theStream << "\t{\n";
+	theStream << "\t\tprovinces = { 2 }\n";
+	theStream << "\t}\n";
+	theStream << "\tstate=\n";
+	theStream << "\t{\n";
+	theStream << "\t\tprovinces = { 3 }\n";
+	theStream << "\t}\n";
+	theStream << "}";
+	auto country = Vic2::Country::Factory{*Configuration::Builder{}.setVic2Path("./countries/blank/").build(),
+		 *stateDefinitions,
+		 Vic2::CultureGroups::Factory{}.getCultureGroups(*Configuration::Builder{}.build())}
+							 .createCountry("TAG",
+								  theStream,
+								  *Vic2::CommonCountryData::Builder{}.Build(),
+								  std::vector<Vic2::Party>{*Vic2::Party::Builder{}.Build()},
+								  *Vic2::StateLanguageCategories::Builder{}.build(),
+								  0.05F);
+
+	ASSERT_EQ(4, country->getStates().size());
+	country->mergeStates(*stateDefinitions);
+
+	ASSERT_EQ(2, country->getStates().size());
+	ASSERT_EQ("MERGE_STATE", country->getStates()[0].getStateID());
+	ASSERT_THAT(country->getStates()[0].getProvinceNumbers(), testing::UnorderedElementsAre(1, 2, 3));
+	ASSERT_FALSE(country->getStates()[0].isPartialState());
+	ASSERT_EQ("UNMERGED_STATE", country->getStates()[1].getStateID());
+}
+
+
 TEST(Vic2World_Countries_CountryTests, ProvincesCanBePlacedInStates)
 {
 	std::stringstream theStream;
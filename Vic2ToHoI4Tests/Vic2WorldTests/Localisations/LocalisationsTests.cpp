@@ -76,6 +76,18 @@ TEST(Vic2World_Localisations_LocalisationsTests, MissingLocalisationsReplacedWit
 }
 
 
+TEST(Vic2World_Localisations_LocalisationsTests, MissingColumnsReplacedWithEnglish)
+{
+	const auto configuration = Configuration::Builder{}.setVic2Path("./").build();
+	const auto localisations = Vic2::Localisations::Factory{}.importLocalisations(*configuration);
+
+	ASSERT_EQ("english_short_loc", localisations->getTextInLanguage("short_key", "english"));
+	ASSERT_EQ("french_short_loc", localisations->getTextInLanguage("short_key", "french"));
+	ASSERT_EQ("english_short_loc", localisations->getTextInLanguage("short_key", "german"));
+	ASSERT_EQ("english_short_loc", localisations->getTextInLanguage("short_key", "finnish"));
+}
+
+
 TEST(Vic2World_Localisations_LocalisationsTests, TextInAllLanguagesTextInAllLanguages)
 {
 	const auto configuration = Configuration::Builder{}.setVic2Path("./").build();
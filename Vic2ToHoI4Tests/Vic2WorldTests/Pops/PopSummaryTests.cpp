@@ -0,0 +1,69 @@
+#include "V2World/Pops/PopBuilder.h"
+#include "V2World/Pops/PopSummary.h"
+#include "gmock/gmock-matchers.h"
+#include "gtest/gtest.h"
+
+
+
+TEST(Vic2World_Pops_PopSummaryTests, SummaryDefaultsToEmpty)
+{
+	const Vic2::PopSummary popSummary;
+
+	ASSERT_EQ(0, popSummary.getPopulation());
+	ASSERT_EQ(0, popSummary.getPopulation("farmers"));
+	ASSERT_EQ(0, popSummary.getLiteracyWeightedPopulation());
+	ASSERT_EQ(0, popSummary.getLiteracyWeightedPopulation("farmers"));
+	ASSERT_TRUE(popSummary.getCultureSizes().empty());
+}
+
+
+TEST(Vic2World_Pops_PopSummaryTests, PopulationIsTotalledByType)
+{
+	const Vic2::PopSummary popSummary(std::vector{*Vic2::Pop::Builder{}.setType("farmers").setSize(3).build(),
+		 *Vic2::Pop::Builder{}.setType("clerks").setSize(5).build(),
+		 *Vic2::Pop::Builder{}.setType("farmers").setSize(7).build()});
+
+	ASSERT_EQ(15, popSummary.getPopulation());
+	ASSERT_EQ(10, popSummary.getPopulation("farmers"));
+	ASSERT_EQ(5, popSummary.getPopulation("clerks"));
+	ASSERT_EQ(0, popSummary.getPopulation("capitalists"));
+}
+
+
+TEST(Vic2World_Pops_PopSummaryTests, LiteracyWeightedPopulationIsTotalledByType)
+{
+	const Vic2::PopSummary popSummary(
+		 std::vector{*Vic2::Pop::Builder{}.setType("capitalists").setSize(100).setLiteracy(1.0).build(),
+			  *Vic2::Pop::Builder{}.setType("farmers").setSize(100).setLiteracy(0.0).build()});
+
+	ASSERT_EQ(110, popSummary.getLiteracyWeightedPopulation());
+	ASSERT_EQ(100, popSummary.getLiteracyWeightedPopulation("capitalists"));
+	ASSERT_EQ(10, popSummary.getLiteracyWeightedPopulation("farmers"));
+}
+
+
+TEST(Vic2World_Pops_PopSummaryTests, PopulationIsTotalledByCulture)
+{
+	const Vic2::PopSummary popSummary(std::vector{*Vic2::Pop::Builder{}.setCulture("culture").setSize(3).build(),
+		 *Vic2::Pop::Builder{}.setCulture("culture_two").setSize(5).build(),
+		 *Vic2::Pop::Builder{}.setCulture("culture").setSize(7).build()});
+
+	ASSERT_THAT(popSummary.getCultureSizes(),
+		 testing::UnorderedElementsAre(testing::Pair("culture", 10), testing::Pair("culture_two", 5)));
+	ASSERT_EQ(15, popSummary.getPopulationWithCultures({"culture", "culture_two"}));
+	ASSERT_EQ(5, popSummary.getPopulationWithCultures({"culture_two", "culture_three"}));
+}
+
+
+TEST(Vic2World_Pops_PopSummaryTests, SummariesCanBeAdded)
+{
+	Vic2::PopSummary popSummary(
+		 std::vector{*Vic2::Pop::Builder{}.setType("farmers").setCulture("culture").setSize(3).build()});
+	popSummary.add(Vic2::PopSummary(
+		 std::vector{*Vic2::Pop::Builder{}.setType("farmers").setCulture("culture_two").setSize(5).build()}));
+
+	ASSERT_EQ(8, popSummary.getPopulation());
+	ASSERT_EQ(8, popSummary.getPopulation("farmers"));
+	ASSERT_THAT(popSummary.getCultureSizes(),
+		 testing::UnorderedElementsAre(testing::Pair("culture", 3), testing::Pair("culture_two", 5)));
+}